@@ -11,15 +11,28 @@
 #include <wx/wx.h>
 #include <wx/string.h>
 #include <wx/ffile.h>
+#include <wx/file.h>
+#include <wx/filename.h>
 #include <wx/log.h>
 
+#ifdef __WXMSW__
+#include <wx/msw/wrapwin.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <algorithm>
 #include <fstream>
+#include <map>
 #include <sstream>
 #include <vector>
 
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "AudioManager.h"
 #include "kiss_fft/tools/kiss_fftr.h"
@@ -67,6 +80,102 @@ int AudioData::__nextId = 0;
 
 #define PCMFUDGE 32768
 
+// waveform peak buckets are 64, 256, 1024 and 4096 samples
+#define PEAK_BASE_SAMPLES 64
+#define PEAK_LEVELS 4
+
+// kiss_fftr keeps working buffers inside its config so a plan cannot be shared between threads.
+// Each thread instead keeps its own plans by size along with the output buffer and the MIDI note
+// bucket ranges so repeated spectrum analysis does not allocate or call exp2f for every window
+namespace
+{
+    struct SpectrumScratch
+    {
+        std::map<int, kiss_fftr_cfg> plans;
+        std::vector<kiss_fft_cpx> out;
+        std::map<std::pair<int, long>, std::vector<std::pair<int, int>>> buckets;
+
+        ~SpectrumScratch()
+        {
+            for (auto& it : plans) {
+                free(it.second);
+            }
+        }
+
+        kiss_fftr_cfg GetPlan(int nfft)
+        {
+            auto it = plans.find(nfft);
+            if (it != plans.end()) return it->second;
+            kiss_fftr_cfg cfg = kiss_fftr_alloc(nfft, 0/*is_inverse_fft*/, nullptr, nullptr);
+            if (cfg != nullptr) {
+                plans[nfft] = cfg;
+            }
+            return cfg;
+        }
+
+        const std::vector<std::pair<int, int>>& GetBuckets(int n, long rate)
+        {
+            auto& b = buckets[{ n, rate }];
+            if (b.empty()) {
+                b.reserve(127);
+                for (int j = 0; j < 127; j++) {
+                    // choose the right bucket for this MIDI note
+                    double freq = 440.0 * exp2f(((double)j - 69.0) / 12.0);
+                    int start = freq * (double)n / (double)rate;
+                    double freqnext = 440.0 * exp2f(((double)j + 1.0 - 69.0) / 12.0);
+                    int end = freqnext * (double)n / (double)rate;
+                    b.push_back({ start, end });
+                }
+            }
+            return b;
+        }
+    };
+    thread_local SpectrumScratch __spectrumScratch;
+}
+
+// Runs an FFT over n samples and reduces it to the log magnitude of the 127 MIDI notes
+static bool CalculateNoteSpectrum(const float* in, int n, long rate, std::vector<float>& res, float& max)
+{
+    res.clear();
+    n &= ~1; // real FFT must be even
+    if (n <= 0 || rate <= 0) return false;
+
+    auto& scratch = __spectrumScratch;
+    kiss_fftr_cfg cfg = scratch.GetPlan(n);
+    if (cfg == nullptr) return false;
+
+    int outcount = n / 2 + 1;
+    if (scratch.out.size() < (size_t)outcount) {
+        scratch.out.resize(outcount);
+    }
+    kiss_fft_cpx* out = scratch.out.data();
+    kiss_fftr(cfg, in, out);
+
+    res.reserve(127);
+    for (const auto& b : scratch.GetBuckets(n, rate)) {
+        float val = 0.0;
+
+        // got through all buckets up to the next note and take the maximums
+        if (b.second < outcount - 1) {
+            for (int k = b.first; k <= b.second; k++) {
+                kiss_fft_cpx* cur = out + k;
+                val = std::max(val, sqrtf(cur->r * cur->r + cur->i * cur->i));
+            }
+        }
+
+        float db = log10(val);
+        if (db < 0.0) {
+            db = 0.0;
+        }
+
+        res.push_back(db);
+        if (db > max) {
+            max = db;
+        }
+    }
+    return true;
+}
+
 void fill_audio(void *udata, Uint8 *stream, int len)
 {
     //SDL 2.0
@@ -473,49 +582,8 @@ std::vector<float> SDL::GetOutputSpectrum(int ms)
     }
 
     // Now do the spectrum analysing
-    int outcount = n / 2 + 1;
-    kiss_fftr_cfg cfg;
-    kiss_fft_cpx* out = (kiss_fft_cpx*)malloc(sizeof(kiss_fft_cpx) * (outcount));
-    if (out != nullptr)
-    {
-        if ((cfg = kiss_fftr_alloc(outcount, 0/*is_inverse_fft*/, nullptr, nullptr)) != nullptr)
-        {
-            kiss_fftr(cfg, in, out);
-            free(cfg);
-        }
-
-        for (j = 0; j < 127; j++)
-        {
-            // choose the right bucket for this MIDI note
-            double freq = 440.0 * exp2f(((double)j - 69.0) / 12.0);
-            int start = freq * (double)n / (double)DEFAULT_RATE;
-            double freqnext = 440.0 * exp2f(((double)j + 1.0 - 69.0) / 12.0);
-            int end = freqnext * (double)n / (double)DEFAULT_RATE;
-
-            float val = 0.0;
-
-            // got through all buckets up to the next note and take the maximums
-            if (end < outcount - 1)
-            {
-                for (int k = start; k <= end; k++)
-                {
-                    kiss_fft_cpx* cur = out + k;
-                    val = std::max(val, sqrtf(cur->r * cur->r + cur->i * cur->i));
-                    //float valscaled = valnew * scaling;
-                }
-            }
-
-            float db = log10(val);
-            if (db < 0.0)
-            {
-                db = 0.0;
-            }
-
-            res.push_back(db);
-        }
-
-        free(out);
-    }
+    float max = 0.0;
+    CalculateNoteSpectrum(in, n, DEFAULT_RATE, res, max);
 
     free(in);
 
@@ -555,49 +623,8 @@ std::vector<float> SDL::GetInputSpectrum(int ms)
     }
 
     // Now do the spectrum analysing
-    int outcount = n / 2 + 1;
-    kiss_fftr_cfg cfg;
-    kiss_fft_cpx* out = (kiss_fft_cpx*)malloc(sizeof(kiss_fft_cpx) * (outcount));
-    if (out != nullptr)
-    {
-        if ((cfg = kiss_fftr_alloc(outcount, 0/*is_inverse_fft*/, nullptr, nullptr)) != nullptr)
-        {
-            kiss_fftr(cfg, in, out);
-            free(cfg);
-        }
-
-        for (j = 0; j < 127; j++)
-        {
-            // choose the right bucket for this MIDI note
-            double freq = 440.0 * exp2f(((double)j - 69.0) / 12.0);
-            int start = freq * (double)n / (double)DEFAULT_RATE;
-            double freqnext = 440.0 * exp2f(((double)j + 1.0 - 69.0) / 12.0);
-            int end = freqnext * (double)n / (double)DEFAULT_RATE;
-
-            float val = 0.0;
-
-            // got through all buckets up to the next note and take the maximums
-            if (end < outcount - 1)
-            {
-                for (int k = start; k <= end; k++)
-                {
-                    kiss_fft_cpx* cur = out + k;
-                    val = std::max(val, sqrtf(cur->r * cur->r + cur->i * cur->i));
-                    //float valscaled = valnew * scaling;
-                }
-            }
-
-            float db = log10(val);
-            if (db < 0.0)
-            {
-                db = 0.0;
-            }
-
-            res.push_back(db);
-        }
-
-        free(out);
-    }
+    float max = 0.0;
+    CalculateNoteSpectrum(in, n, DEFAULT_RATE, res, max);
 
     free(in);
 
@@ -1322,6 +1349,8 @@ AudioManager::AudioManager(const std::string& audio_file, int intervalMS)
 	// extra is the extra bytes added to the data we read. This allows analysis functions to exceed the file length without causing memory exceptions
 	_extra = 32769;
 
+    _analysisCache = std::make_unique<AudioAnalysisCache>(audio_file);
+
 	// Open the media file
     logger_base.debug("Audio Manager Constructor: Loading media file.");
     OpenMediaFile();
@@ -1355,58 +1384,9 @@ AudioManager::AudioManager(const std::string& audio_file, int intervalMS)
     AddAudioDeviceChangeListener([this]() {AudioDeviceChanged();});
 }
 
-std::list<float> AudioManager::CalculateSpectrumAnalysis(const float* in, int n, float& max, int id) const
+void AudioManager::CalculateSpectrumAnalysis(const float* in, int n, float& max, std::vector<float>& res) const
 {
-	std::list<float> res;
-	int outcount = n / 2 + 1;
-	kiss_fftr_cfg cfg;
-	kiss_fft_cpx* out = (kiss_fft_cpx*)malloc(sizeof(kiss_fft_cpx) * (outcount));
-	if (out != nullptr)
-	{
-		if ((cfg = kiss_fftr_alloc(n, 0/*is_inverse_fft*/, nullptr, nullptr)) != nullptr)
-		{
-			kiss_fftr(cfg, in, out);
-			free(cfg);
-		}
-
-		for (int j = 0; j < 127; j++)
-		{
-            // choose the right bucket for this MIDI note
-            double freq = 440.0 * exp2f(((double)j - 69.0) / 12.0);
-            int start = freq * (double)n / (double)_rate;
-            double freqnext = 440.0 * exp2f(((double)j + 1.0 - 69.0) / 12.0);
-            int end = freqnext * (double)n / (double)_rate;
-
-            float val = 0.0;
-
-            // got through all buckets up to the next note and take the maximums
-            if (end < outcount-1)
-            {
-                for (int k = start; k <= end; k++)
-                {
-                    kiss_fft_cpx* cur = out + k;
-                    val = std::max(val, sqrtf(cur->r * cur->r + cur->i * cur->i));
-                    //float valscaled = valnew * scaling;
-                }
-            }
-
-			float db = log10(val);
-			if (db < 0.0)
-			{
-				db = 0.0;
-			}
-
-			res.push_back(db);
-			if (db > max)
-			{
-				max = db;
-			}
-		}
-
-		free(out);
-	}
-
-	return res;
+    CalculateNoteSpectrum(in, n, _rate, res, max);
 }
 
 void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManagerProgressCallback fn)
@@ -1429,6 +1409,13 @@ void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManager
         wxMilliSleep(100);
     }
 
+    if (LoadNotesFromAnalysisCache())
+    {
+        _polyphonicTranscriptionDone = true;
+        logger_base.info("DoPolyphonicTranscription: Polyphonic transcription loaded from analysis cache in %ld.", sw.Time());
+        return;
+    }
+
     static log4cpp::Category &logger_pianodata = log4cpp::Category::getInstance(std::string("log_pianodata"));
     logger_pianodata.debug("Processing polyphonic transcription on file " + _audio_file);
     logger_pianodata.debug("Interval %d.", _intervalMS);
@@ -1562,6 +1549,8 @@ void AudioManager::DoPolyphonicTranscription(wxProgressDialog* dlg, AudioManager
 
         //done with VAMP Polyphonic Transcriber
         delete pt;
+
+        SaveNotesToAnalysisCache();
     }
     _polyphonicTranscriptionDone = true;
     logger_base.info("DoPolyphonicTranscription: Polyphonic transcription completed in %ld.", sw.Time());
@@ -1611,6 +1600,12 @@ void AudioManager::DoPrepareFrameData()
 
     _frameData.clear();
 
+    if (LoadFrameDataFromAnalysisCache()) {
+        _frameDataPrepared = true;
+        logger_base.info("DoPrepareFrameData: Audio frame data loaded from analysis cache in %ld. Frames: %d", sw.Time(), (int)_frameData.size());
+        return;
+    }
+
 	// samples per frame
 	int samplesperframe = _rate * _intervalMS / 1000;
 	int frames = _lengthMS / _intervalMS;
@@ -1632,11 +1627,67 @@ void AudioManager::DoPrepareFrameData()
 	_bigmin = 1;
 	_bigspectogrammax = -1;
 
-	size_t step = 2048;
-	float *pdata[2];
+	const int step = 2048;
+
+    // the data is all loaded so read it directly rather than locking for every sample
+    const float* leftData = GetRawLeftDataPtr(0);
+    auto sampleAt = [this, leftData](long offset) {
+        return (leftData != nullptr && offset <= _trackSize) ? leftData[offset] : 0.0f;
+    };
+
+    // The spectrogram windows are a fixed size and dont line up with the frames so calculate every
+    // window up front across the job pool and then merge them into the frames they belong to.
+    // Windows are only taken while a whole window fits inside the song.
+    int windows = totalsamples > 0 ? (totalsamples - 1) / step : 0;
+    std::vector<std::vector<float>> spectra(windows);
+    std::vector<float> spectraMax(windows, 0.0f);
+    parallel_for(0, windows, [this, leftData, step, &spectra, &spectraMax](int w) {
+        long pos = (long)w * step;
+        if (leftData != nullptr && pos <= _trackSize) {
+            CalculateSpectrumAnalysis(leftData + pos, step, spectraMax[w], spectra[w]);
+        }
+    }, 16);
+
+    // raw data max/min/spread for each frame
+    std::vector<float> frameMax(frames);
+    std::vector<float> frameMin(frames);
+    std::vector<float> frameSpread(frames);
+    parallel_for(0, frames, [samplesperframe, &sampleAt, &frameMax, &frameMin, &frameSpread](int i) {
+		// accumulators
+		float max = -100.0;
+		float min = 100.0;
+		float spread = -100;
 
-	int pos = 0;
+		for (int j = 0; j < samplesperframe; j++)
+		{
+			float data = sampleAt((long)i * samplesperframe + j);
+
+			// Max data
+			if (data > max)
+			{
+				max = data;
+			}
+
+			// Min data
+			if (data < min)
+			{
+				min = data;
+			}
+
+			// Spread data
+			if (max - min > spread)
+			{
+				spread = max - min;
+			}
+		}
+        frameMax[i] = max;
+        frameMin[i] = min;
+        frameSpread[i] = spread;
+    }, 64);
+
+	int window = 0;
 	std::list<float> spectrogram;
+    _frameData.reserve(frames);
 
 	// process each frome of the song
 	for (int i = 0; i < frames; i++)
@@ -1644,54 +1695,36 @@ void AudioManager::DoPrepareFrameData()
 		std::vector<std::list<float>> aFrameData;
 		aFrameData.resize(5); // preallocate the spots we will need
 
-		// accumulators
-		float max = -100.0;
-		float min = 100.0;
-		float spread = -100;
-
 		// clear the data if we are about to get new data ... dont clear it if we wont
 		// this happens because the spectrogram function has a fixed window based on the parameters we set and it
 		// does not match our time slices exactly so we have to select which one to use
-		if (pos < i * samplesperframe + samplesperframe  && pos + step < totalsamples)
+		if (window < windows && (long)window * step < (long)i * samplesperframe + samplesperframe)
 		{
 			spectrogram.clear();
 		}
 
-		// only get the data if we are not ahead of the music
-		while (pos < i * samplesperframe + samplesperframe && pos + step < totalsamples)
+		// only take the windows if we are not ahead of the music
+		while (window < windows && (long)window * step < (long)i * samplesperframe + samplesperframe)
 		{
-			std::list<float> subspectrogram;
-			pdata[0] = GetRawLeftDataPtr(pos);
-            wxASSERT(pdata[0] != nullptr);
-			pdata[1] = GetRawRightDataPtr(pos);
-			float max2 = 0;
-
-			if (pdata[0] == nullptr)
-			{
-				subspectrogram.clear();
-			}
-			else
-			{
-				subspectrogram = CalculateSpectrumAnalysis(pdata[0], step, max2, i);
-			}
+			const std::vector<float>& subspectrogram = spectra[window];
 
 			// and keep track of the larges value so we can normalise it
-			if (max2 > _bigspectogrammax)
+			if (spectraMax[window] > _bigspectogrammax)
 			{
-				_bigspectogrammax = max2;
+				_bigspectogrammax = spectraMax[window];
 			}
-			pos += step;
+			window++;
 
 			// either take the newly calculated values or if we are merging two results take the maximum of each value
 			if (spectrogram.size() == 0)
 			{
-				spectrogram = subspectrogram;
+				spectrogram.assign(subspectrogram.begin(), subspectrogram.end());
 			}
 			else
 			{
 				if (subspectrogram.size() > 0)
 				{
-					std::list<float>::iterator sub = subspectrogram.begin();
+					auto sub = subspectrogram.begin();
 					for (std::list<float>::iterator fr = spectrogram.begin(); fr != spectrogram.end(); ++fr)
 					{
 						if (*sub > *fr)
@@ -1704,30 +1737,9 @@ void AudioManager::DoPrepareFrameData()
 			}
 		}
 
-		// now do the raw data analysis for the frame
-		for (int j = 0; j < samplesperframe; j++)
-		{
-			float data = GetRawLeftData(i * samplesperframe + j);
-
-			// Max data
-			if (data > max)
-			{
-				max = data;
-			}
-
-			// Min data
-			if (data < min)
-			{
-				min = data;
-			}
-
-			// Spread data
-			if (max - min > spread)
-			{
-				spread = max - min;
-			}
-		}
-
+		float max = frameMax[i];
+		float min = frameMin[i];
+		float spread = frameSpread[i];
 		if (max > _bigmax)
 		{
 			_bigmax = max;
@@ -1742,18 +1754,12 @@ void AudioManager::DoPrepareFrameData()
 		}
 
 		// Now save the results for the frame
-		std::list<float> maxlist;
-		maxlist.push_back(max);
-		std::list<float> minlist;
-		minlist.push_back(min);
-		std::list<float> spreadlist;
-		spreadlist.push_back(spread);
-		aFrameData[0] = maxlist;
-		aFrameData[1] = minlist;
-		aFrameData[2] = spreadlist;
+		aFrameData[0].push_back(max);
+		aFrameData[1].push_back(min);
+		aFrameData[2].push_back(spread);
 		aFrameData[3] = spectrogram;
 
-		_frameData.push_back(aFrameData);
+		_frameData.push_back(std::move(aFrameData));
 	}
 
 	// normalise data ... basically scale the data so the highest value is the scale value.
@@ -1786,6 +1792,8 @@ void AudioManager::DoPrepareFrameData()
 	// flag the fact that the data is all ready
 	_frameDataPrepared = true;
 
+    SaveFrameDataToAnalysisCache();
+
 	logger_base.info("DoPrepareFrameData: Audio frame data processing complete in %ld. Frames: %d", sw.Time(), frames);
 }
 
@@ -2228,6 +2236,13 @@ int AudioManager::OpenMediaFile()
 		_pcmdata = nullptr;
 	}
 
+    // if we have seen this file before skip decoding it
+    if (LoadFromAnalysisCache())
+    {
+        _sdlid = __sdl.AddAudio(_pcmdatasize, _pcmdata, 100, _rate, _trackSize, _lengthMS);
+        return err;
+    }
+
 	// Initialize FFmpeg codecs
     #if LIBAVFORMAT_VERSION_MAJOR < 58
     av_register_all();
@@ -2536,6 +2551,8 @@ void AudioManager::DoLoadAudioData(AVFormatContext* formatContext, AVCodecContex
     avformat_close_input(&formatContext);
 
     logger_base.debug("DoLoadAudioData: Song data loaded in %ld. Read: %ld", sw.Time(), read);
+
+    SaveToAnalysisCache();
 }
 
 void AudioManager::LoadAudioFromFrame( AVFormatContext* formatContext, AVCodecContext* codecContext, AVPacket* decodingPacket, AVFrame* frame, SwrContext* au_convert_ctx, bool receivedEOF, int out_channels, uint8_t* out_buffer, long& read, int& lastpct )
@@ -2888,6 +2905,7 @@ void AudioManager::SwitchTo(AUDIOSAMPLETYPE type, int lowNote, int highNote) {
         fad->lowNote = 0;
         fad->highNote = 0;
         fad->type = AUDIOSAMPLETYPE::RAW;
+        BuildPeaks(fad);
         _filtered.push_back(fad);
     }
 
@@ -2898,6 +2916,13 @@ void AudioManager::SwitchTo(AUDIOSAMPLETYPE type, int lowNote, int highNote) {
             // This assumes the vocals are in one track
             // grab it from my cache if i have it
             fad = GetFilteredAudioData(type, -1, -1);
+            if (fad == nullptr) {
+                fad = LoadFilteredFromAnalysisCache(type, 0, 0);
+                if (fad != nullptr) {
+                    BuildPeaks(fad);
+                    _filtered.push_back(fad);
+                }
+            }
             if (fad == nullptr) {
                 fad = new FilteredAudioData();
                 long datasize = sizeof(float) * (_trackSize + _extra);
@@ -2928,6 +2953,8 @@ void AudioManager::SwitchTo(AUDIOSAMPLETYPE type, int lowNote, int highNote) {
                 fad->highNote = 0;
                 fad->type = type;
                 NormaliseFilteredAudioData(fad);
+                SaveFilteredToAnalysisCache(fad);
+                BuildPeaks(fad);
                 _filtered.push_back(fad);
             }
         }
@@ -2944,6 +2971,15 @@ void AudioManager::SwitchTo(AUDIOSAMPLETYPE type, int lowNote, int highNote) {
         // grab it from my cache if i have it
         fad = GetFilteredAudioData(AUDIOSAMPLETYPE::ANY, lowNote, highNote);
 
+        // then from the analysis cache
+        if (fad == nullptr) {
+            fad = LoadFilteredFromAnalysisCache(type, lowNote, highNote);
+            if (fad != nullptr) {
+                BuildPeaks(fad);
+                _filtered.push_back(fad);
+            }
+        }
+
         // if we didnt find it ... create it
         if (fad == nullptr) {
             double lowHz = MidiToFrequency(lowNote);
@@ -3009,6 +3045,8 @@ void AudioManager::SwitchTo(AUDIOSAMPLETYPE type, int lowNote, int highNote) {
             fad->highNote = highNote;
             fad->type = type;
             NormaliseFilteredAudioData(fad);
+            SaveFilteredToAnalysisCache(fad);
+            BuildPeaks(fad);
             _filtered.push_back(fad);
         }
     }
@@ -3069,9 +3107,60 @@ void AudioManager::GetLeftDataMinMax(long start, long end, float& minimum, float
         return;
     }
 
-    for (int j = start; j < std::min(end, _trackSize); j++) {
-        minimum = std::min(minimum, fad->data0[j]);
-        maximum = std::max(maximum, fad->data0[j]);
+    // walk the range using the largest peak buckets that fit so wide ranges only touch a handful of values
+    long j = std::max(start, 0L);
+    end = std::min(end, _trackSize);
+    while (j < end) {
+        int level = (int)fad->peakMin.size() - 1;
+        long size = (long)PEAK_BASE_SAMPLES << (2 * level);
+        while (level >= 0 && (j % size != 0 || j + size > end)) {
+            level--;
+            size >>= 2;
+        }
+        if (level < 0) {
+            minimum = std::min(minimum, fad->data0[j]);
+            maximum = std::max(maximum, fad->data0[j]);
+            j++;
+        } else {
+            minimum = std::min(minimum, fad->peakMin[level][j / size]);
+            maximum = std::max(maximum, fad->peakMax[level][j / size]);
+            j += size;
+        }
+    }
+}
+
+void AudioManager::BuildPeaks(FilteredAudioData* fad) const
+{
+    fad->peakMin.resize(PEAK_LEVELS);
+    fad->peakMax.resize(PEAK_LEVELS);
+
+    // only whole buckets are kept ... the ragged end of the track is read from the samples
+    long buckets = _trackSize / PEAK_BASE_SAMPLES;
+    fad->peakMin[0].resize(buckets);
+    fad->peakMax[0].resize(buckets);
+    const float* data = fad->data0;
+    parallel_for(0, buckets, [fad, data](int b) {
+        const float* p = data + (long)b * PEAK_BASE_SAMPLES;
+        float mn = p[0];
+        float mx = p[0];
+        for (int i = 1; i < PEAK_BASE_SAMPLES; i++) {
+            mn = std::min(mn, p[i]);
+            mx = std::max(mx, p[i]);
+        }
+        fad->peakMin[0][b] = mn;
+        fad->peakMax[0][b] = mx;
+    }, 1024);
+
+    for (int level = 1; level < PEAK_LEVELS; level++) {
+        const auto& lmin = fad->peakMin[level - 1];
+        const auto& lmax = fad->peakMax[level - 1];
+        buckets = lmin.size() / 4;
+        fad->peakMin[level].resize(buckets);
+        fad->peakMax[level].resize(buckets);
+        for (long b = 0; b < buckets; b++) {
+            fad->peakMin[level][b] = std::min(std::min(lmin[b * 4], lmin[b * 4 + 1]), std::min(lmin[b * 4 + 2], lmin[b * 4 + 3]));
+            fad->peakMax[level][b] = std::max(std::max(lmax[b * 4], lmax[b * 4 + 1]), std::max(lmax[b * 4 + 2], lmax[b * 4 + 3]));
+        }
     }
 }
 
@@ -3202,6 +3291,593 @@ std::string AudioManager::Hash()
     return _hash;
 }
 
+#pragma region Analysis Cache
+
+#define AUDIO_ANALYSIS_CACHE_VERSION 1
+
+std::string AudioAnalysisCache::__folder;
+
+struct AudioAnalysisCache::Header
+{
+    char magic[4];
+    uint32_t version;
+    uint64_t mediaSize;
+    int64_t mediaTime;
+    char hash[32];
+    uint64_t reserved;
+};
+
+struct AudioAnalysisCacheSectionHeader
+{
+    uint32_t section;
+    int32_t key1;
+    int32_t key2;
+    uint32_t reserved;
+    uint64_t size;
+};
+
+namespace
+{
+    // Read only memory mapping of a whole file
+    class MappedCacheFile
+    {
+    public:
+        MappedCacheFile(const std::string& filename)
+        {
+#ifdef __WXMSW__
+            _file = ::CreateFileW(wxString(filename).wc_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (_file == INVALID_HANDLE_VALUE) return;
+            LARGE_INTEGER size;
+            if (!::GetFileSizeEx(_file, &size) || size.QuadPart == 0) return;
+            _map = ::CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (_map == nullptr) return;
+            _data = (const uint8_t*)::MapViewOfFile(_map, FILE_MAP_READ, 0, 0, 0);
+            if (_data != nullptr) _size = size.QuadPart;
+#else
+            _fd = open(filename.c_str(), O_RDONLY);
+            if (_fd < 0) return;
+            struct stat st;
+            if (fstat(_fd, &st) != 0 || st.st_size == 0) return;
+            void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, _fd, 0);
+            if (data == MAP_FAILED) return;
+            _data = (const uint8_t*)data;
+            _size = st.st_size;
+#endif
+        }
+        ~MappedCacheFile()
+        {
+#ifdef __WXMSW__
+            if (_data != nullptr) ::UnmapViewOfFile(_data);
+            if (_map != nullptr) ::CloseHandle(_map);
+            if (_file != INVALID_HANDLE_VALUE) ::CloseHandle(_file);
+#else
+            if (_data != nullptr) munmap((void*)_data, _size);
+            if (_fd >= 0) close(_fd);
+#endif
+        }
+        const uint8_t* Data() const { return _data; }
+        uint64_t Size() const { return _size; }
+
+    private:
+#ifdef __WXMSW__
+        HANDLE _file = INVALID_HANDLE_VALUE;
+        HANDLE _map = nullptr;
+#else
+        int _fd = -1;
+#endif
+        const uint8_t* _data = nullptr;
+        uint64_t _size = 0;
+    };
+
+    // Sequential reader over a cache section ... any read past the end fails and stays failed
+    class CacheSectionReader
+    {
+    public:
+        CacheSectionReader(const uint8_t* data, uint64_t size) : _data(data), _size(size) {}
+
+        template<typename T>
+        bool Get(T& value)
+        {
+            const uint8_t* p = GetBlock(sizeof(T));
+            if (p == nullptr) return false;
+            memcpy(&value, p, sizeof(T));
+            return true;
+        }
+        const uint8_t* GetBlock(uint64_t size)
+        {
+            if (!_ok || _pos + size > _size) {
+                _ok = false;
+                return nullptr;
+            }
+            const uint8_t* p = _data + _pos;
+            _pos += size;
+            return p;
+        }
+        bool GetString(std::string& s)
+        {
+            uint32_t len = 0;
+            if (!Get(len)) return false;
+            const uint8_t* p = GetBlock(len);
+            if (p == nullptr) return false;
+            s.assign((const char*)p, len);
+            return true;
+        }
+        bool GetFloats(std::list<float>& l)
+        {
+            uint32_t count = 0;
+            if (!Get(count)) return false;
+            const uint8_t* p = GetBlock((uint64_t)count * sizeof(float));
+            if (p == nullptr) return false;
+            l.clear();
+            for (uint32_t i = 0; i < count; i++) {
+                float f;
+                memcpy(&f, p + i * sizeof(float), sizeof(float));
+                l.push_back(f);
+            }
+            return true;
+        }
+        bool IsOk() const { return _ok; }
+
+    private:
+        const uint8_t* _data;
+        uint64_t _size;
+        uint64_t _pos = 0;
+        bool _ok = true;
+    };
+
+    class CacheSectionWriter
+    {
+    public:
+        template<typename T>
+        void Put(const T& value)
+        {
+            const uint8_t* p = (const uint8_t*)&value;
+            _data.insert(_data.end(), p, p + sizeof(T));
+        }
+        void PutString(const std::string& s)
+        {
+            Put((uint32_t)s.size());
+            _data.insert(_data.end(), s.begin(), s.end());
+        }
+        void PutFloats(const std::list<float>& l)
+        {
+            Put((uint32_t)l.size());
+            for (float f : l) {
+                Put(f);
+            }
+        }
+        const std::vector<uint8_t>& Data() const { return _data; }
+
+    private:
+        std::vector<uint8_t> _data;
+    };
+}
+
+void AudioAnalysisCache::SetFolder(const std::string& folder)
+{
+    __folder = folder;
+}
+
+AudioAnalysisCache::AudioAnalysisCache(const std::string& mediaFile)
+{
+    if (__folder == "" || mediaFile == "") return;
+
+    wxFileName fn(mediaFile);
+    if (!fn.FileExists()) return;
+    _mediaSize = fn.GetSize().GetValue();
+    _mediaTime = fn.GetModificationTime().GetValue().GetValue();
+
+    // the media name keeps the cache readable but the path hash keeps songs with the same name apart
+    uint64_t pathHash = 14695981039346656037ULL;
+    for (unsigned char c : mediaFile) {
+        pathHash = (pathHash ^ c) * 1099511628211ULL;
+    }
+    _cacheFile = __folder + wxFileName::GetPathSeparator() + fn.GetName().ToStdString() + "_" + wxString::Format("%016llx", (unsigned long long)pathHash).ToStdString() + ".xaudiocache";
+}
+
+bool AudioAnalysisCache::ReadHeader(Header& header) const
+{
+    if (!IsEnabled() || !wxFile::Exists(_cacheFile)) return false;
+    wxFile f;
+    if (!f.Open(_cacheFile, wxFile::read)) return false;
+    if (f.Read(&header, sizeof(header)) != sizeof(header)) return false;
+    return memcmp(header.magic, "xLAC", 4) == 0 && header.version == AUDIO_ANALYSIS_CACHE_VERSION;
+}
+
+bool AudioAnalysisCache::HeaderMatchesMedia(const Header& header) const
+{
+    return header.mediaSize == _mediaSize && header.mediaTime == _mediaTime;
+}
+
+bool AudioAnalysisCache::IsValid() const
+{
+    std::unique_lock<std::recursive_mutex> lock(_lock);
+    Header header;
+    return ReadHeader(header) && HeaderMatchesMedia(header);
+}
+
+std::string AudioAnalysisCache::GetHash() const
+{
+    std::unique_lock<std::recursive_mutex> lock(_lock);
+    Header header;
+    if (!ReadHeader(header)) return "";
+    return std::string(header.hash, strnlen(header.hash, sizeof(header.hash)));
+}
+
+bool AudioAnalysisCache::DoRead(SECTION section, int32_t key1, int32_t key2, const SectionReader& reader) const
+{
+    MappedCacheFile map(_cacheFile);
+    if (map.Data() == nullptr || map.Size() < sizeof(Header)) return false;
+
+    Header header;
+    memcpy(&header, map.Data(), sizeof(header));
+    if (memcmp(header.magic, "xLAC", 4) != 0 || header.version != AUDIO_ANALYSIS_CACHE_VERSION || !HeaderMatchesMedia(header)) return false;
+
+    uint64_t pos = sizeof(Header);
+    while (pos + sizeof(AudioAnalysisCacheSectionHeader) <= map.Size()) {
+        AudioAnalysisCacheSectionHeader sh;
+        memcpy(&sh, map.Data() + pos, sizeof(sh));
+        pos += sizeof(sh);
+        if (sh.size > map.Size() - pos) break; // incomplete write
+        if (sh.section == (uint32_t)section && sh.key1 == key1 && sh.key2 == key2) {
+            return reader(map.Data() + pos, sh.size);
+        }
+        pos += sh.size;
+    }
+    return false;
+}
+
+bool AudioAnalysisCache::Read(SECTION section, int32_t key1, int32_t key2, const SectionReader& reader) const
+{
+    std::unique_lock<std::recursive_mutex> lock(_lock);
+    if (!IsEnabled()) return false;
+    return DoRead(section, key1, key2, reader);
+}
+
+bool AudioAnalysisCache::Has(SECTION section, int32_t key1, int32_t key2) const
+{
+    return Read(section, key1, key2, [](const uint8_t*, uint64_t) { return true; });
+}
+
+bool AudioAnalysisCache::Write(SECTION section, int32_t key1, int32_t key2, const SectionParts& parts)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+    std::unique_lock<std::recursive_mutex> lock(_lock);
+
+    if (!IsValid()) return false;
+    if (Has(section, key1, key2)) return true;
+
+    AudioAnalysisCacheSectionHeader sh;
+    memset(&sh, 0x00, sizeof(sh));
+    sh.section = (uint32_t)section;
+    sh.key1 = key1;
+    sh.key2 = key2;
+    for (const auto& it : parts) {
+        sh.size += it.second;
+    }
+
+    wxFile f;
+    if (!f.Open(_cacheFile, wxFile::write_append)) {
+        logger_base.warn("AudioAnalysisCache: Unable to open %s to append.", (const char*)_cacheFile.c_str());
+        return false;
+    }
+    bool ok = f.Write(&sh, sizeof(sh)) == sizeof(sh);
+    for (const auto& it : parts) {
+        if (!ok) break;
+        ok = f.Write(it.first, it.second) == it.second;
+    }
+    f.Close();
+    if (!ok) {
+        logger_base.warn("AudioAnalysisCache: Failed writing section %d to %s.", (int)section, (const char*)_cacheFile.c_str());
+    }
+    return ok;
+}
+
+bool AudioAnalysisCache::Create(const std::string& hash)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+    std::unique_lock<std::recursive_mutex> lock(_lock);
+    if (!IsEnabled()) return false;
+
+    Header header;
+    if (ReadHeader(header) && std::string(header.hash, strnlen(header.hash, sizeof(header.hash))) == hash) {
+        if (!HeaderMatchesMedia(header)) {
+            // media was touched but the audio is the same so keep everything we have already worked out
+            logger_base.debug("AudioAnalysisCache: Media file changed but audio hash matches, keeping %s.", (const char*)_cacheFile.c_str());
+            header.mediaSize = _mediaSize;
+            header.mediaTime = _mediaTime;
+            wxFile f;
+            if (!f.Open(_cacheFile, wxFile::read_write)) return false;
+            return f.Write(&header, sizeof(header)) == sizeof(header);
+        }
+        return true;
+    }
+
+    wxFileName dir = wxFileName::DirName(__folder);
+    if (!dir.DirExists() && !dir.Mkdir(wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL)) {
+        logger_base.warn("AudioAnalysisCache: Unable to create folder %s.", (const char*)__folder.c_str());
+        return false;
+    }
+
+    memset(&header, 0x00, sizeof(header));
+    memcpy(header.magic, "xLAC", 4);
+    header.version = AUDIO_ANALYSIS_CACHE_VERSION;
+    header.mediaSize = _mediaSize;
+    header.mediaTime = _mediaTime;
+    memcpy(header.hash, hash.c_str(), std::min(hash.size(), sizeof(header.hash)));
+
+    wxFile f;
+    if (!f.Create(_cacheFile, true) || f.Write(&header, sizeof(header)) != sizeof(header)) {
+        logger_base.warn("AudioAnalysisCache: Unable to create %s.", (const char*)_cacheFile.c_str());
+        return false;
+    }
+    logger_base.debug("AudioAnalysisCache: Created %s.", (const char*)_cacheFile.c_str());
+    return true;
+}
+
+// Reload the decoded audio ... this replaces the ffmpeg decode in OpenMediaFile
+bool AudioManager::LoadFromAnalysisCache()
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+    if (_analysisCache == nullptr || !_analysisCache->IsValid()) return false;
+
+    wxStopWatch sw;
+    bool loaded = _analysisCache->Read(AudioAnalysisCache::SECTION::PCM, 0, 0, [this](const uint8_t* data, uint64_t size) {
+        CacheSectionReader reader(data, size);
+        int32_t rate = 0, channels = 0, bits = 0, extra = 0;
+        int64_t trackSize = 0, lengthMS = 0, pcmSize = 0, pcmBytes = 0;
+        std::string title, album, artist;
+        reader.Get(rate);
+        reader.Get(channels);
+        reader.Get(bits);
+        reader.Get(extra);
+        reader.Get(trackSize);
+        reader.Get(lengthMS);
+        reader.Get(pcmSize);
+        reader.Get(pcmBytes);
+        reader.GetString(title);
+        reader.GetString(album);
+        reader.GetString(artist);
+        const uint8_t* pcm = reader.GetBlock(pcmBytes);
+        if (!reader.IsOk() || rate <= 0 || channels <= 0 || trackSize <= 0 || pcmBytes != trackSize * 2 * (int64_t)sizeof(int16_t) || pcmBytes > pcmSize + PCMFUDGE) {
+            return false;
+        }
+
+        if (_data[1] != nullptr && _data[1] != _data[0]) {
+            free(_data[1]);
+        }
+        _data[1] = nullptr;
+        if (_data[0] != nullptr) {
+            free(_data[0]);
+            _data[0] = nullptr;
+        }
+
+        long datasize = sizeof(float) * (trackSize + extra);
+        _data[0] = (float*)calloc(datasize, 1);
+        _data[1] = channels == 2 ? (float*)calloc(datasize, 1) : _data[0];
+        _pcmdata = (Uint8*)calloc(pcmSize + PCMFUDGE, 1);
+        if (_data[0] == nullptr || _data[1] == nullptr || _pcmdata == nullptr) {
+            if (_data[1] != _data[0]) free(_data[1]);
+            free(_data[0]);
+            free(_pcmdata);
+            _data[0] = _data[1] = nullptr;
+            _pcmdata = nullptr;
+            return false;
+        }
+
+        _rate = rate;
+        _channels = channels;
+        _bits = bits;
+        _extra = extra;
+        _trackSize = trackSize;
+        _lengthMS = lengthMS;
+        _pcmdatasize = pcmSize;
+        _title = title;
+        _album = album;
+        _artist = artist;
+        memcpy(_pcmdata, pcm, pcmBytes);
+
+        // the playback PCM is always stereo 16 bit so rebuild the float data from it just like LoadResampledAudio does
+        const int16_t* samples = (const int16_t*)_pcmdata;
+        for (long i = 0; i < _trackSize; i++) {
+            _data[0][i] = ((float)samples[i * 2]) / (float)0x8000;
+            if (_channels > 1) {
+                _data[1][i] = ((float)samples[i * 2 + 1]) / (float)0x8000;
+            }
+        }
+        return true;
+    });
+
+    if (!loaded) {
+        logger_base.debug("AudioManager: Audio analysis cache did not contain usable audio for %s.", (const char*)_audio_file.c_str());
+        return false;
+    }
+
+    _hash = _analysisCache->GetHash();
+    SetLoadedData(_trackSize);
+    logger_base.debug("AudioManager: Audio loaded from analysis cache in %ldms.", sw.Time());
+    return true;
+}
+
+void AudioManager::SaveToAnalysisCache()
+{
+    if (_analysisCache == nullptr || !_analysisCache->IsEnabled() || !_ok || _pcmdata == nullptr) return;
+
+    // stop the audio being filtered in place while we hash and save it
+    std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+
+    // if anything beyond the raw copy has been filtered already then the live buffers may not be the raw audio
+    // so leave saving it until next time it is loaded
+    if (_filtered.size() > 1) return;
+
+    if (!_analysisCache->Create(Hash())) return;
+
+    if (!_analysisCache->Has(AudioAnalysisCache::SECTION::PCM, 0, 0)) {
+        CacheSectionWriter writer;
+        writer.Put((int32_t)_rate);
+        writer.Put((int32_t)_channels);
+        writer.Put((int32_t)_bits);
+        writer.Put((int32_t)_extra);
+        writer.Put((int64_t)_trackSize);
+        writer.Put((int64_t)_lengthMS);
+        writer.Put((int64_t)_pcmdatasize);
+        // decoding can overrun the estimated size into the fudge space so save what was actually decoded
+        int64_t pcmBytes = (int64_t)_trackSize * 2 * sizeof(int16_t);
+        if (pcmBytes > _pcmdatasize + PCMFUDGE) return;
+        writer.Put(pcmBytes);
+        writer.PutString(_title);
+        writer.PutString(_album);
+        writer.PutString(_artist);
+        _analysisCache->Write(AudioAnalysisCache::SECTION::PCM, 0, 0, { { writer.Data().data(), writer.Data().size() }, { _pcmdata, (uint64_t)pcmBytes } });
+    }
+
+    // frame data may have finished before the audio was saved
+    if (_frameDataPrepared) {
+        SaveFrameDataToAnalysisCache();
+    }
+    if (_polyphonicTranscriptionDone) {
+        SaveNotesToAnalysisCache();
+    }
+}
+
+bool AudioManager::LoadFrameDataFromAnalysisCache()
+{
+    if (_analysisCache == nullptr) return false;
+
+    return _analysisCache->Read(AudioAnalysisCache::SECTION::FRAMEDATA, _intervalMS, 0, [this](const uint8_t* data, uint64_t size) {
+        CacheSectionReader reader(data, size);
+        int32_t frames = 0;
+        reader.Get(frames);
+        reader.Get(_bigmax);
+        reader.Get(_bigmin);
+        reader.Get(_bigspread);
+        reader.Get(_bigspectogrammax);
+        if (!reader.IsOk() || frames < 0) return false;
+
+        std::vector<std::vector<std::list<float>>> frameData(frames);
+        for (auto& it : frameData) {
+            it.resize(5);
+            for (int i = 0; i < 4; i++) {
+                if (!reader.GetFloats(it[i])) return false;
+            }
+        }
+        _frameData.swap(frameData);
+        return true;
+    });
+}
+
+void AudioManager::SaveFrameDataToAnalysisCache()
+{
+    if (_analysisCache == nullptr || !_analysisCache->IsValid()) return;
+
+    CacheSectionWriter writer;
+    writer.Put((int32_t)_frameData.size());
+    writer.Put(_bigmax);
+    writer.Put(_bigmin);
+    writer.Put(_bigspread);
+    writer.Put(_bigspectogrammax);
+    for (const auto& it : _frameData) {
+        for (int i = 0; i < 4; i++) {
+            writer.PutFloats(it[i]);
+        }
+    }
+    _analysisCache->Write(AudioAnalysisCache::SECTION::FRAMEDATA, _intervalMS, 0, { { writer.Data().data(), writer.Data().size() } });
+}
+
+bool AudioManager::LoadNotesFromAnalysisCache()
+{
+    if (_analysisCache == nullptr) return false;
+
+    return _analysisCache->Read(AudioAnalysisCache::SECTION::NOTES, _intervalMS, 0, [this](const uint8_t* data, uint64_t size) {
+        CacheSectionReader reader(data, size);
+        int32_t frames = 0;
+        if (!reader.Get(frames) || frames != (int32_t)_frameData.size()) return false;
+
+        std::vector<std::list<float>> notes(frames);
+        for (auto& it : notes) {
+            if (!reader.GetFloats(it)) return false;
+        }
+        for (size_t i = 0; i < notes.size(); i++) {
+            _frameData[i][4].swap(notes[i]);
+        }
+        return true;
+    });
+}
+
+void AudioManager::SaveNotesToAnalysisCache()
+{
+    if (_analysisCache == nullptr || !_analysisCache->IsValid()) return;
+
+    CacheSectionWriter writer;
+    writer.Put((int32_t)_frameData.size());
+    for (const auto& it : _frameData) {
+        writer.PutFloats(it[4]);
+    }
+    _analysisCache->Write(AudioAnalysisCache::SECTION::NOTES, _intervalMS, 0, { { writer.Data().data(), writer.Data().size() } });
+}
+
+FilteredAudioData* AudioManager::LoadFilteredFromAnalysisCache(AUDIOSAMPLETYPE type, int lowNote, int highNote)
+{
+    if (_analysisCache == nullptr) return nullptr;
+
+    // bands are found by note range alone just like GetFilteredAudioData does
+    int32_t key = (int32_t)(type == AUDIOSAMPLETYPE::NONVOCALS ? type : AUDIOSAMPLETYPE::ANY);
+    FilteredAudioData* res = nullptr;
+    _analysisCache->Read(AudioAnalysisCache::SECTION::FILTERED, key, lowNote * 256 + highNote, [this, &res, type, lowNote, highNote](const uint8_t* data, uint64_t size) {
+        CacheSectionReader reader(data, size);
+        int64_t count = 0;
+        int32_t hasData1 = 0;
+        int64_t pcmSize = 0;
+        reader.Get(count);
+        reader.Get(hasData1);
+        reader.Get(pcmSize);
+        const uint8_t* data0 = reader.GetBlock(count * sizeof(float));
+        const uint8_t* data1 = hasData1 ? reader.GetBlock(count * sizeof(float)) : nullptr;
+        const uint8_t* pcm = reader.GetBlock(pcmSize);
+        if (!reader.IsOk() || count < _trackSize || (hasData1 != 0) != (_data[1] != nullptr)) return false;
+
+        long datasize = sizeof(float) * (_trackSize + _extra);
+        FilteredAudioData* fad = new FilteredAudioData();
+        fad->data0 = (float*)calloc(datasize, 1);
+        memcpy(fad->data0, data0, std::min((uint64_t)datasize, (uint64_t)count * sizeof(float)));
+        if (data1 != nullptr) {
+            fad->data1 = (float*)calloc(datasize, 1);
+            memcpy(fad->data1, data1, std::min((uint64_t)datasize, (uint64_t)count * sizeof(float)));
+        }
+        fad->pcmdata = (int16_t*)calloc(_pcmdatasize + PCMFUDGE, 1);
+        memcpy(fad->pcmdata, pcm, std::min((uint64_t)_pcmdatasize + PCMFUDGE, (uint64_t)pcmSize));
+        fad->lowNote = lowNote;
+        fad->highNote = highNote;
+        fad->type = type;
+        res = fad;
+        return true;
+    });
+    return res;
+}
+
+void AudioManager::SaveFilteredToAnalysisCache(const FilteredAudioData* fad)
+{
+    if (_analysisCache == nullptr || !_analysisCache->IsValid()) return;
+
+    int64_t count = _trackSize + _extra;
+    int32_t hasData1 = fad->data1 != nullptr ? 1 : 0;
+    int64_t pcmSize = std::min((int64_t)_trackSize * 2 * (int64_t)sizeof(int16_t), (int64_t)_pcmdatasize + PCMFUDGE);
+    AudioAnalysisCache::SectionParts parts = {
+        { &count, sizeof(count) },
+        { &hasData1, sizeof(hasData1) },
+        { &pcmSize, sizeof(pcmSize) },
+        { fad->data0, count * sizeof(float) }
+    };
+    if (fad->data1 != nullptr) {
+        parts.push_back({ fad->data1, count * sizeof(float) });
+    }
+    parts.push_back({ fad->pcmdata, (uint64_t)pcmSize });
+    int32_t key = (int32_t)(fad->type == AUDIOSAMPLETYPE::NONVOCALS ? fad->type : AUDIOSAMPLETYPE::ANY);
+    _analysisCache->Write(AudioAnalysisCache::SECTION::FILTERED, key, fad->lowNote * 256 + fad->highNote, parts);
+}
+
+#pragma endregion
+
 // extract the features data from a Vamp plugins output
 void xLightsVamp::ProcessFeatures(Vamp::Plugin::FeatureList &feature, std::vector<int> &starts, std::vector<int> &ends, std::vector<std::string> &labels)
 {
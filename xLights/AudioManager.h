@@ -10,7 +10,9 @@
  * License: https://github.com/smeighan/xLights/blob/master/License.txt
  **************************************************************/
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <list>
 #include <shared_mutex>
@@ -197,8 +199,58 @@ typedef struct FilteredAudioData
     float* data0 = nullptr;
     float* data1 = nullptr;
     int16_t* pcmdata = nullptr;
+    // min/max of data0 per bucket ... each level has buckets 4 times larger than the one before
+    std::vector<std::vector<float>> peakMin;
+    std::vector<std::vector<float>> peakMax;
 } FilteredAudioData;
 
+// On disk cache of the decoded audio and the analysis derived from it so reopening a song does not
+// have to decode it through ffmpeg or redo frame data, filtering or note transcription.
+// The file is found by media path and is only used while the media size and modification time match.
+// It records the AudioManager::Hash of the decoded audio so if the media is touched but decodes
+// to the same audio the analysis sections are kept.
+// Sections are appended and never rewritten so a partially written section is simply ignored.
+class AudioAnalysisCache
+{
+public:
+    enum class SECTION : uint32_t
+    {
+        PCM = 1,
+        FRAMEDATA = 2,
+        FILTERED = 3,
+        NOTES = 4
+    };
+    typedef std::function<bool(const uint8_t* data, uint64_t size)> SectionReader;
+    typedef std::vector<std::pair<const void*, uint64_t>> SectionParts;
+
+    AudioAnalysisCache(const std::string& mediaFile);
+
+    static void SetFolder(const std::string& folder);
+
+    bool IsEnabled() const { return _cacheFile != ""; }
+    // true if the cache file exists and matches the media file
+    bool IsValid() const;
+    std::string GetHash() const;
+    // maps the file and passes the section to reader ... returns false if not present or reader fails
+    bool Read(SECTION section, int32_t key1, int32_t key2, const SectionReader& reader) const;
+    bool Has(SECTION section, int32_t key1, int32_t key2) const;
+    bool Write(SECTION section, int32_t key1, int32_t key2, const SectionParts& parts);
+    // prepares the cache for decoded audio with this hash ... existing sections are kept if the hash matches
+    bool Create(const std::string& hash);
+
+private:
+    struct Header;
+    bool ReadHeader(Header& header) const;
+    bool HeaderMatchesMedia(const Header& header) const;
+    bool DoRead(SECTION section, int32_t key1, int32_t key2, const SectionReader& reader) const;
+
+    static std::string __folder;
+    std::string _cacheFile;
+    uint64_t _mediaSize = 0;
+    int64_t _mediaTime = 0;
+    mutable std::recursive_mutex _lock;
+};
+
 class AudioManager
 {
     std::shared_timed_mutex _mutex;
@@ -236,6 +288,7 @@ class AudioManager
     std::string _hash;
     std::future<void> _prepFrameData;
     std::future<void> _loadingAudio;
+    std::unique_ptr<AudioAnalysisCache> _analysisCache;
 
 	void GetTrackMetrics(AVFormatContext* formatContext, AVCodecContext* codecContext, AVStream* audioStream);
 	void LoadTrackData(AVFormatContext* formatContext, AVCodecContext* codecContext, AVStream* audioStream);
@@ -248,7 +301,7 @@ class AudioManager
     static int decodebitrateindex(int bitrateindex, int version, int layertype);
 	int decodesamplerateindex(int samplerateindex, int version) const;
     static int decodesideinfosize(int version, int mono);
-	std::list<float> CalculateSpectrumAnalysis(const float* in, int n, float& max, int id) const;
+	void CalculateSpectrumAnalysis(const float* in, int n, float& max, std::vector<float>& res) const;
 
     void LoadAudioFromFrame( AVFormatContext* formatContext, AVCodecContext* codecContext, AVPacket* decodingPacket, AVFrame* frame, SwrContext* au_convert_ctx,
                              bool receivedEOF, int out_channels, uint8_t* out_buffer, long& read, int& lastpct );
@@ -258,6 +311,16 @@ class AudioManager
     void SetLoadedData(long pos);
 
     void NormaliseFilteredAudioData(FilteredAudioData* fad);
+    void BuildPeaks(FilteredAudioData* fad) const;
+
+    bool LoadFromAnalysisCache();
+    void SaveToAnalysisCache();
+    bool LoadFrameDataFromAnalysisCache();
+    void SaveFrameDataToAnalysisCache();
+    bool LoadNotesFromAnalysisCache();
+    void SaveNotesToAnalysisCache();
+    FilteredAudioData* LoadFilteredFromAnalysisCache(AUDIOSAMPLETYPE type, int lowNote, int highNote);
+    void SaveFilteredToAnalysisCache(const FilteredAudioData* fad);
 
     static bool WriteAudioFrame( AVFormatContext *oc, AVCodecContext* codecContext, AVStream *st, float *sampleBuff, int sampleCount, bool clearQueue = false );
 
@@ -289,6 +352,7 @@ public:
     static std::list<std::string> GetAudioDevices();
     static void SetInputAudioDevice(const std::string& device);
     static std::list<std::string> GetInputAudioDevices();
+    static void SetAnalysisCacheFolder(const std::string& folder) { AudioAnalysisCache::SetFolder(folder); }
     long GetTrackSize() const { return _trackSize; };
 	long GetRate() const { return _rate; };
 	int GetChannels() const { return _channels; };
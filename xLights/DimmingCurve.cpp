@@ -111,6 +111,10 @@ public:
                 break;
         }
     }
+    virtual DimmingCurve *clone() const {
+        // the derived curves only differ in how they fill in the tables
+        return new BaseDimmingCurve(*this);
+    }
 
     int channel;
     unsigned char data[256];
@@ -238,6 +242,11 @@ public:
             blue->reverse(c);
         }
     }
+    virtual DimmingCurve *clone() const {
+        return new CompositeDimmingCurve(red == nullptr ? nullptr : red->clone(),
+                                         green == nullptr ? nullptr : green->clone(),
+                                         blue == nullptr ? nullptr : blue->clone());
+    }
     DimmingCurve *red;
     DimmingCurve *green;
     DimmingCurve *blue;
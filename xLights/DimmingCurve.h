@@ -23,6 +23,8 @@ class DimmingCurve
     
         virtual void apply(xlColor &c) = 0;
         virtual void reverse(xlColor &c) = 0;
+        // independent copy for code that cannot hold on to the model's curve
+        virtual DimmingCurve *clone() const = 0;
     
         static DimmingCurve *createFromXML(wxXmlNode *node);
         static DimmingCurve *createBrightnessGamma(int brightness, float gamma);
@@ -6,6 +6,7 @@
 #include <vector>
 #include <cstring>
 #include <memory>
+#include <algorithm>
 
 #include <stdio.h>
 #include <inttypes.h>
@@ -432,6 +433,23 @@ uint64_t FSEQFile::read(void *ptr, uint64_t size) {
     return fread(ptr, 1, size, m_seqFile);
 }
 
+bool FSEQFile::reopenForUpdate() {
+    if (m_seqFile == nullptr) {
+        return false;
+    }
+    // freopen closes the original stream even if it fails to reopen
+    m_seqFile = freopen((const char *)m_filename.c_str(), "r+b", m_seqFile);
+    if (m_seqFile == nullptr) {
+        LogErr(VB_SEQUENCE, "Error reopening FSEQ file (%s) for update\n", m_filename.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool FSEQFile::flush() {
+    return m_seqFile == nullptr || fflush(m_seqFile) == 0;
+}
+
 void FSEQFile::preload(uint64_t pos, uint64_t size) {
 #ifndef PLATFORM_UNKNOWN
     posix_fadvise(fileno(m_seqFile), pos, size, POSIX_FADV_WILLNEED);
@@ -761,6 +779,12 @@ public:
 
     virtual void prepareRead(uint32_t frame) {}
 
+    // compress frames [firstFrame, firstFrame + numFrames) as one standalone block
+    // into out, used to replace a single block when updating a file in place
+    virtual bool compressBlock(uint32_t firstFrame, uint32_t numFrames,
+                               const std::function<const uint8_t *(uint32_t)> &frameData,
+                               std::vector<uint8_t> &out) { return false; }
+
     V2FSEQFile *m_file = nullptr;
     uint64_t   m_seqChanDataOffset = 0;
 };
@@ -1051,6 +1075,63 @@ public:
         }
         return data;
     }
+    int blockCompressionLevel(uint32_t firstFrame) {
+        int clevel = m_file->m_compressionLevel == -99 ? 2 : m_file->m_compressionLevel;
+        if (clevel < -25 || clevel > 25) {
+            clevel = 2;
+        }
+        if (firstFrame == 0 && (ZSTD_versionNumber() > 10305)) {
+            // first frame needs to be grabbed as fast as possible
+            // or remotes may be off by a few frames at start.  Thus,
+            // if using recent zstd, we'll use the negative levels
+            // for the first block so the decompression can
+            // be as fast as possible
+            clevel = -10;
+        }
+        if (ZSTD_versionNumber() <= 10305 && clevel < 0) {
+            clevel = 0;
+        }
+        return clevel;
+    }
+    virtual bool compressBlock(uint32_t firstFrame, uint32_t numFrames,
+                               const std::function<const uint8_t *(uint32_t)> &frameData,
+                               std::vector<uint8_t> &out) override {
+        ZSTD_CStream *cctx = ZSTD_createCStream();
+        if (cctx == nullptr) {
+            return false;
+        }
+        ZSTD_initCStream(cctx, blockCompressionLevel(firstFrame));
+        std::vector<uint8_t> buf(ZSTD_CStreamOutSize());
+        ZSTD_outBuffer_s output = { &buf[0], buf.size(), 0 };
+        bool ok = true;
+        auto compressRange = [&](const uint8_t *src, size_t len) {
+            ZSTD_inBuffer_s input = { src, len, 0 };
+            while (ok && input.pos < input.size) {
+                ok = !ZSTD_isError(ZSTD_compressStream(cctx, &output, &input));
+                out.insert(out.end(), buf.begin(), buf.begin() + output.pos);
+                output.pos = 0;
+            }
+        };
+        for (uint32_t f = firstFrame; ok && f < firstFrame + numFrames; f++) {
+            const uint8_t *data = frameData(f);
+            if (m_file->m_sparseRanges.empty()) {
+                compressRange(data, m_file->getChannelCount());
+            } else {
+                for (auto &a : m_file->m_sparseRanges) {
+                    compressRange(&data[a.first], a.second);
+                }
+            }
+        }
+        size_t remaining = 1;
+        while (ok && remaining > 0) {
+            remaining = ZSTD_endStream(cctx, &output);
+            ok = !ZSTD_isError(remaining);
+            out.insert(out.end(), buf.begin(), buf.begin() + output.pos);
+            output.pos = 0;
+        }
+        ZSTD_freeCStream(cctx);
+        return ok;
+    }
     void compressData(ZSTD_CStream* m_cctx, ZSTD_inBuffer_s &input, ZSTD_outBuffer_s &output) {
         ZSTD_compressStream(m_cctx, &output, &input);
         int count = input.pos;
@@ -1079,22 +1160,7 @@ public:
             uint64_t offset = tell();
             //LogDebug(VB_SEQUENCE, "  Preparing to create a compressed block of data starting at frame %d, offset  %" PRIu64 ".\n", frame, offset);
             m_file->m_frameOffsets.push_back(std::pair<uint32_t, uint64_t>(frame, offset));
-            int clevel = m_file->m_compressionLevel == -99 ? 2 : m_file->m_compressionLevel;
-            if (clevel < -25 || clevel > 25) {
-                clevel = 2;
-            }
-            if (frame == 0 && (ZSTD_versionNumber() > 10305)) {
-                // first frame needs to be grabbed as fast as possible
-                // or remotes may be off by a few frames at start.  Thus,
-                // if using recent zstd, we'll use the negative levels
-                // for the first block so the decompression can
-                // be as fast as possible
-                clevel = -10;
-            }
-            if (ZSTD_versionNumber() <= 10305 && clevel < 0) {
-                clevel = 0;
-            }
-            ZSTD_initCStream(m_cctx, clevel);
+            ZSTD_initCStream(m_cctx, blockCompressionLevel(frame));
         }
 
         uint8_t *curData = (uint8_t *)data;
@@ -1242,6 +1308,55 @@ public:
         }
         return data;
     }
+    int blockCompressionLevel() {
+        int clevel = m_file->m_compressionLevel == -99 ? 3 : m_file->m_compressionLevel;
+        if (clevel < 0 || clevel > 9) {
+            clevel = 3;
+        }
+        return clevel;
+    }
+    virtual bool compressBlock(uint32_t firstFrame, uint32_t numFrames,
+                               const std::function<const uint8_t *(uint32_t)> &frameData,
+                               std::vector<uint8_t> &out) override {
+        z_stream stream;
+        memset(&stream, 0, sizeof(stream));
+        if (deflateInit(&stream, blockCompressionLevel()) != Z_OK) {
+            return false;
+        }
+        std::vector<uint8_t> buf(V2FSEQ_OUT_BUFFER_SIZE);
+        int ret = Z_OK;
+        auto deflateAll = [&](int flush) {
+            do {
+                stream.next_out = &buf[0];
+                stream.avail_out = buf.size();
+                ret = deflate(&stream, flush);
+                if (ret == Z_BUF_ERROR && flush == Z_NO_FLUSH) {
+                    // no progress possible until more input arrives, not an error
+                    ret = Z_OK;
+                }
+                out.insert(out.end(), buf.begin(), buf.end() - stream.avail_out);
+            } while (ret == Z_OK && (stream.avail_out == 0 || (flush == Z_FINISH)));
+        };
+        for (uint32_t f = firstFrame; ret == Z_OK && f < firstFrame + numFrames; f++) {
+            uint8_t *data = (uint8_t *)frameData(f);
+            if (m_file->m_sparseRanges.empty()) {
+                stream.next_in = data;
+                stream.avail_in = m_file->getChannelCount();
+                deflateAll(Z_NO_FLUSH);
+            } else {
+                for (auto &a : m_file->m_sparseRanges) {
+                    stream.next_in = &data[a.first];
+                    stream.avail_in = a.second;
+                    deflateAll(Z_NO_FLUSH);
+                }
+            }
+        }
+        if (ret == Z_OK) {
+            deflateAll(Z_FINISH);
+        }
+        deflateEnd(&stream);
+        return ret == Z_STREAM_END;
+    }
     virtual void addFrame(uint32_t frame, const uint8_t *data) override {
         if (m_outBuffer == nullptr) {
             m_outBuffer = (uint8_t*)malloc(V2FSEQ_OUT_BUFFER_SIZE);
@@ -1256,11 +1371,7 @@ public:
             memset(m_stream, 0, sizeof(z_stream));
         }
         if (m_curFrameInBlock == 0) {
-            int clevel = m_file->m_compressionLevel == -99 ? 3 : m_file->m_compressionLevel;
-            if (clevel < 0 || clevel > 9) {
-                clevel = 3;
-            }
-            deflateInit(m_stream, clevel);
+            deflateInit(m_stream, blockCompressionLevel());
             m_stream->next_out = m_outBuffer;
             m_stream->avail_out = V2FSEQ_OUT_BUFFER_SIZE;
         }
@@ -1712,6 +1823,209 @@ void V2FSEQFile::finalize() {
     FSEQFile::finalize();
 }
 
+bool V2FSEQFile::updateFSEQFile(const std::string &fn, V2FSEQFile &layout,
+                                uint32_t startFrame, uint32_t endFrame,
+                                const std::function<const uint8_t *(uint32_t)> &frameData) {
+    if (layout.getFilename() != "-memory-" || layout.tell() != 0) {
+        return false;
+    }
+    std::unique_ptr<FSEQFile> existing(FSEQFile::openFSEQFile(fn));
+    V2FSEQFile *file = dynamic_cast<V2FSEQFile*>(existing.get());
+    if (file == nullptr || file->m_compressionType != layout.m_compressionType) {
+        return false;
+    }
+
+    // Everything but the compression block index must be byte for byte what a
+    // full write would produce, including the unique id
+    layout.writeHeader();
+    const std::vector<uint8_t> &newHeader = layout.getMemoryBuffer();
+    if (newHeader.size() != file->m_seqChanDataOffset) {
+        return false;
+    }
+    std::vector<uint8_t> oldHeader(newHeader.size());
+    file->seek(0, SEEK_SET);
+    if (file->read(&oldHeader[0], oldHeader.size()) != oldHeader.size()) {
+        return false;
+    }
+    uint32_t maxBlocks = ((newHeader[20] & 0xF0) << 4) | newHeader[21];
+    uint32_t indexEnd = V2FSEQ_HEADER_SIZE + maxBlocks * V2FSEQ_COMPRESSION_BLOCK_SIZE;
+    if (memcmp(&oldHeader[0], &newHeader[0], V2FSEQ_HEADER_SIZE) != 0
+        || memcmp(&oldHeader[indexEnd], &newHeader[indexEnd], newHeader.size() - indexEnd) != 0) {
+        LogDebug(VB_SEQUENCE, "FSEQ file (%s) header has changed, cannot update in place.\n", fn.c_str());
+        return false;
+    }
+
+    uint32_t numFrames = layout.getNumFrames();
+    uint64_t frameSize = layout.getChannelCount();
+    uint64_t dataStart = file->m_seqChanDataOffset;
+    if (endFrame >= numFrames) {
+        endFrame = numFrames - 1;
+    }
+
+    if (layout.m_compressionType == CompressionType::none) {
+        if (file->m_seqFileSize != dataStart + frameSize * numFrames) {
+            return false;
+        }
+        if (startFrame > endFrame || numFrames == 0) {
+            return true;
+        }
+        if (!file->reopenForUpdate()) {
+            return false;
+        }
+        // once writing has started a failure leaves the file damaged, the caller then rewrites it
+        for (uint32_t f = startFrame; f <= endFrame; f++) {
+            const uint8_t *data = frameData(f);
+            bool ok = file->seek(dataStart + frameSize * f, SEEK_SET) == 0;
+            if (file->m_sparseRanges.empty()) {
+                ok = ok && file->write(data, frameSize) == frameSize;
+            } else {
+                for (auto &a : file->m_sparseRanges) {
+                    ok = ok && file->write(&data[a.first], a.second) == a.second;
+                }
+            }
+            if (!ok) {
+                LogErr(VB_SEQUENCE, "Failed to write frame %d of FSEQ file (%s).\n", f, fn.c_str());
+                return false;
+            }
+        }
+        if (!file->flush()) {
+            LogErr(VB_SEQUENCE, "Failed to write frames %d-%d of FSEQ file (%s).\n", startFrame, endFrame, fn.c_str());
+            return false;
+        }
+        LogDebug(VB_SEQUENCE, "Updated frames %d-%d of FSEQ file (%s) in place.\n", startFrame, endFrame, fn.c_str());
+        return true;
+    }
+
+    // first frame and compressed length of each block, in file order
+    std::vector<std::pair<uint32_t, uint64_t>> blocks;
+    uint64_t dataEnd = dataStart;
+    for (uint32_t i = 0; i < maxBlocks; i++) {
+        uint32_t firstFrame = read4ByteUInt(&oldHeader[V2FSEQ_HEADER_SIZE + i * V2FSEQ_COMPRESSION_BLOCK_SIZE]);
+        uint32_t length = read4ByteUInt(&oldHeader[V2FSEQ_HEADER_SIZE + i * V2FSEQ_COMPRESSION_BLOCK_SIZE + 4]);
+        if (length > 0) {
+            blocks.push_back(std::pair<uint32_t, uint64_t>(firstFrame, length));
+            dataEnd += length;
+        }
+    }
+    if (blocks.empty() || blocks[0].first != 0 || dataEnd != file->m_seqFileSize) {
+        // partially written or otherwise suspect file, let the caller rewrite it
+        return false;
+    }
+    if (startFrame > endFrame || numFrames == 0) {
+        return true;
+    }
+
+    // the dirty frames map to a contiguous run of blocks [firstDirty, lastDirty]
+    auto blockEndFrame = [&](size_t i) {
+        return i + 1 < blocks.size() ? std::min(blocks[i + 1].first, numFrames) : numFrames;
+    };
+    size_t firstDirty = 0;
+    while (firstDirty < blocks.size() && blockEndFrame(firstDirty) <= startFrame) {
+        firstDirty++;
+    }
+    size_t lastDirty = firstDirty;
+    while (lastDirty + 1 < blocks.size() && blocks[lastDirty + 1].first <= endFrame) {
+        lastDirty++;
+    }
+    if (firstDirty >= blocks.size()) {
+        return true;
+    }
+    uint64_t dirtyOffset = dataStart;
+    for (size_t i = 0; i < firstDirty; i++) {
+        dirtyOffset += blocks[i].second;
+    }
+    uint64_t oldDirtyLen = 0;
+    uint64_t newDirtyLen = 0;
+    std::vector<std::vector<uint8_t>> newBlocks(lastDirty - firstDirty + 1);
+    for (size_t i = firstDirty; i <= lastDirty; i++) {
+        uint32_t first = blocks[i].first;
+        if (!layout.m_handler->compressBlock(first, blockEndFrame(i) - first, frameData, newBlocks[i - firstDirty])) {
+            LogErr(VB_SEQUENCE, "Failed to compress block %d of FSEQ file (%s).\n", (int)i, fn.c_str());
+            return false;
+        }
+        oldDirtyLen += blocks[i].second;
+        newDirtyLen += newBlocks[i - firstDirty].size();
+    }
+
+    if (newDirtyLen != oldDirtyLen) {
+        // Readers derive block offsets from the lengths in the index so the blocks after the
+        // dirty run would have to slide. Rather than shuffle them around in the live file, and
+        // leave it damaged if that fails part way, write a new copy and swap it in.
+        std::vector<uint8_t> header(oldHeader);
+        for (size_t i = firstDirty; i <= lastDirty; i++) {
+            write4ByteUInt(&header[V2FSEQ_HEADER_SIZE + i * V2FSEQ_COMPRESSION_BLOCK_SIZE + 4], newBlocks[i - firstDirty].size());
+        }
+        std::string tmpFn = fn + ".tmp";
+        FILE *out = fopen(tmpFn.c_str(), "wb");
+        if (out == nullptr) {
+            LogErr(VB_SEQUENCE, "Error creating FSEQ file (%s).\n", tmpFn.c_str());
+            return false;
+        }
+        std::vector<uint8_t> buf(1024 * 1024);
+        auto copyRange = [&](uint64_t from, uint64_t to) {
+            if (from < to && file->seek(from, SEEK_SET) != 0) {
+                return false;
+            }
+            while (from < to) {
+                uint64_t len = std::min((uint64_t)buf.size(), to - from);
+                if (file->read(&buf[0], len) != len || fwrite(&buf[0], 1, len, out) != len) {
+                    return false;
+                }
+                from += len;
+            }
+            return true;
+        };
+        bool ok = fwrite(&header[0], 1, header.size(), out) == header.size();
+        ok = ok && copyRange(dataStart, dirtyOffset);
+        for (auto &b : newBlocks) {
+            ok = ok && fwrite(&b[0], 1, b.size(), out) == b.size();
+        }
+        ok = ok && copyRange(dirtyOffset + oldDirtyLen, dataEnd);
+        ok = (fclose(out) == 0) && ok;
+        // the original has to be closed before it can be replaced on Windows
+        existing.reset();
+        if (ok) {
+#ifdef _MSC_VER
+            ok = wxRenameFile(tmpFn, fn, true);
+#else
+            ok = rename(tmpFn.c_str(), fn.c_str()) == 0;
+#endif
+        }
+        if (!ok) {
+            remove(tmpFn.c_str());
+            LogErr(VB_SEQUENCE, "Failed to write blocks %d-%d of FSEQ file (%s).\n", (int)firstDirty, (int)lastDirty, fn.c_str());
+            return false;
+        }
+        LogDebug(VB_SEQUENCE, "Updated blocks %d-%d (frames %d-%d) of FSEQ file (%s) via a new copy.\n",
+                 (int)firstDirty, (int)lastDirty, startFrame, endFrame, fn.c_str());
+        return true;
+    }
+
+    // same size so the new blocks and their index entries can be written over the old ones
+    if (!file->reopenForUpdate()) {
+        return false;
+    }
+    // once writing has started a failure leaves the file damaged, the caller then rewrites it
+    bool ok = file->seek(dirtyOffset, SEEK_SET) == 0;
+    for (auto &b : newBlocks) {
+        ok = ok && file->write(&b[0], b.size()) == b.size();
+    }
+    ok = ok && file->seek(V2FSEQ_HEADER_SIZE + firstDirty * V2FSEQ_COMPRESSION_BLOCK_SIZE, SEEK_SET) == 0;
+    for (size_t i = firstDirty; ok && i <= lastDirty; i++) {
+        uint8_t buf[V2FSEQ_COMPRESSION_BLOCK_SIZE];
+        write4ByteUInt(buf, blocks[i].first);
+        write4ByteUInt(&buf[4], newBlocks[i - firstDirty].size());
+        ok = file->write(buf, sizeof(buf)) == sizeof(buf);
+    }
+    if (!ok || !file->flush()) {
+        LogErr(VB_SEQUENCE, "Failed to write blocks %d-%d of FSEQ file (%s).\n", (int)firstDirty, (int)lastDirty, fn.c_str());
+        return false;
+    }
+    LogDebug(VB_SEQUENCE, "Updated blocks %d-%d (frames %d-%d) of FSEQ file (%s) in place.\n",
+             (int)firstDirty, (int)lastDirty, startFrame, endFrame, fn.c_str());
+    return true;
+}
+
 uint32_t V2FSEQFile::getMaxChannel() const {
     uint32_t ret = m_seqChannelCount;
     for (auto &a : m_sparseRanges) {
@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <string>
 #include <vector>
+#include <functional>
 
 class FSEQFile {
 public:
@@ -87,6 +88,7 @@ public:
     int           getVersionMajor() const { return m_seqVersionMajor; }
     int           getVersionMinor() const { return m_seqVersionMinor; }
     uint64_t      getUniqueId() const { return m_uniqueId; }
+    void          setUniqueId(uint64_t id) { m_uniqueId = id; }
     const std::string& getFilename() const { return m_filename; }
 
 
@@ -121,6 +123,8 @@ protected:
     uint64_t write(const void * ptr, uint64_t size);
     uint64_t read(void *ptr, uint64_t size);
     void preload(uint64_t pos, uint64_t size);
+    bool reopenForUpdate();
+    bool flush();
 
 private:
     FILE* volatile  m_seqFile;
@@ -175,6 +179,18 @@ public:
 
     virtual uint32_t getMaxChannel() const override;
 
+    //Update an existing v2 fseq in place, re-encoding only the frames in
+    //[startFrame, endFrame] (for compressed files, the blocks containing them).
+    //layout must be a "-memory-" file set up exactly as it would be for a full
+    //write (channels, frames, step time, unique id, sparse ranges, variable headers).
+    //If a re-encoded compressed block changes size, the whole file is written to
+    //fn.tmp and renamed over the original rather than patched.
+    //Returns false without touching the file if the header on disk does not match,
+    //in which case the caller needs to do a full write.
+    static bool updateFSEQFile(const std::string &fn, V2FSEQFile &layout,
+                               uint32_t startFrame, uint32_t endFrame,
+                               const std::function<const uint8_t *(uint32_t)> &frameData);
+
     virtual void enableMinorVersionFeatures(uint8_t ver) override {
         if (ver == 0) {
             m_allowExtendedBlocks = false;
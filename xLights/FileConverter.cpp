@@ -67,7 +67,12 @@ void ConvertParameters::SetStatusText(wxString msg)
 
 void ConvertParameters::ConversionError(wxString msg)
 {
-    if (convertDialog != nullptr)
+    if (error_message != nullptr)
+    {
+        if (!error_message->empty()) *error_message += "\n";
+        *error_message += msg.ToStdString();
+    }
+    else if (convertDialog != nullptr)
     {
         convertDialog->ConversionError(msg);
     }
@@ -1618,39 +1623,10 @@ void FileConverter::ReadFalconFile(ConvertParameters& params)
     delete file;
 }
 
-void FileConverter::WriteFalconPiFile(ConvertParameters& params)
+static void SetupFalconPiFile(FSEQFile* file, ConvertParameters& params, int vMajor, bool allowSparse)
 {
     static log4cpp::Category &logger_conversion = log4cpp::Category::getInstance(std::string("log_conversion"));
-    logger_conversion.debug("Start fseq write");
-       
-    const wxUint8 fType = params.xLightsFrm->_fseqVersion;
-    int vMajor = 2;
-    int clevel = 2;
-    bool allowSparse = false;
-    FSEQFile::CompressionType ctype = FSEQFile::CompressionType::zstd;
-    switch (fType) {
-        case 1:
-            vMajor = 1;
-            break;
-        case 3:
-            ctype = FSEQFile::CompressionType::none;
-            break;
-        case 4:
-            ctype = FSEQFile::CompressionType::zlib;
-            clevel = 1;
-            break;
-        case 5:
-            allowSparse = true;
-            break;
-        default:
-            break;
-    }
-    
-    FSEQFile *file = FSEQFile::createFSEQFile(params.out_filename, vMajor, ctype, clevel);
-    if (!file) {
-        params.ConversionError(wxString("Unable to create file: ") + params.out_filename + ". Check directory and file permissions.");
-        return;
-    }
+
     size_t stepSize = roundTo4(params.seq_data.NumChannels());
     wxUint16 stepTime = params.seq_data.FrameTime();
 
@@ -1685,6 +1661,57 @@ void FileConverter::WriteFalconPiFile(ConvertParameters& params)
             logger_conversion.info("Sparse range - Start: %d  End: %d   Size: %d\n", r.first + 1, (r.first + r.second), r.second);
         }
     }
+}
+
+void FileConverter::WriteFalconPiFile(ConvertParameters& params)
+{
+    static log4cpp::Category &logger_conversion = log4cpp::Category::getInstance(std::string("log_conversion"));
+    logger_conversion.debug("Start fseq write");
+       
+    const wxUint8 fType = params.xLightsFrm->_fseqVersion;
+    int vMajor = 2;
+    int clevel = 2;
+    bool allowSparse = false;
+    FSEQFile::CompressionType ctype = FSEQFile::CompressionType::zstd;
+    switch (fType) {
+        case 1:
+            vMajor = 1;
+            break;
+        case 3:
+            ctype = FSEQFile::CompressionType::none;
+            break;
+        case 4:
+            ctype = FSEQFile::CompressionType::zlib;
+            clevel = 1;
+            break;
+        case 5:
+            allowSparse = true;
+            break;
+        default:
+            break;
+    }
+
+    if (vMajor >= 2 && params.fseq_unique_id != 0) {
+        // only the frames rendered since the last write changed, try to patch the existing file
+        V2FSEQFile layout("-memory-", ctype, clevel);
+        SetupFalconPiFile(&layout, params, vMajor, allowSparse);
+        layout.setUniqueId(params.fseq_unique_id);
+        if (V2FSEQFile::updateFSEQFile(params.out_filename.ToStdString(), layout,
+                                       params.fseq_dirty_start_frame, params.fseq_dirty_end_frame,
+                                       [&params](uint32_t frame) { return (const uint8_t*)&params.seq_data[frame][0]; })) {
+            logger_conversion.debug("End fseq write, updated frames %d-%d in place", params.fseq_dirty_start_frame, params.fseq_dirty_end_frame);
+            return;
+        }
+        logger_conversion.debug("fseq could not be updated in place, rewriting it");
+    }
+
+    FSEQFile *file = FSEQFile::createFSEQFile(params.out_filename, vMajor, ctype, clevel);
+    if (!file) {
+        params.fseq_unique_id = 0;
+        params.ConversionError(wxString("Unable to create file: ") + params.out_filename + ". Check directory and file permissions.");
+        return;
+    }
+    SetupFalconPiFile(file, params, vMajor, allowSparse);
 
     file->writeHeader();
     size_t size = params.seq_data.NumFrames();
@@ -1692,6 +1719,7 @@ void FileConverter::WriteFalconPiFile(ConvertParameters& params)
         file->addFrame(x, &params.seq_data[x][0]);
     }
     file->finalize();
+    params.fseq_unique_id = file->getUniqueId();
     delete file;
     logger_conversion.debug("End fseq write");
 }
@@ -53,6 +53,13 @@ public:
     ConvertDialog* convertDialog = nullptr;
     ConvertLogDialog* convertLogDialog = nullptr;
     std::vector<std::pair<uint32_t, uint32_t>> ranges;
+    // unique id of the fseq at out_filename when only frames [fseq_dirty_start_frame, fseq_dirty_end_frame]
+    // have changed since it was written, 0 to force a full write.  Set to the id of the file written.
+    uint64_t fseq_unique_id = 0;
+    int fseq_dirty_start_frame = 0;
+    int fseq_dirty_end_frame = -1;
+    // when set errors are recorded here rather than shown, for conversions run off the main thread
+    std::string* error_message = nullptr;
 
     void SetStatusText(wxString msg);
     void ConversionError(wxString msg);
@@ -0,0 +1,332 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <wx/filefn.h>
+#include <wx/log.h>
+#include <wx/stopwatch.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#include "ImageAssetCache.h"
+#include "JobPool.h"
+#include "ExternalHooks.h"
+
+#include <log4cpp/Category.hh>
+
+#define IMAGE_ASSET_CACHE_DEFAULT_BUDGET (512 * 1024 * 1024)
+#define IMAGE_ASSET_CACHE_DECODE_THREADS 4
+
+#pragma region DecodedImage
+
+wxImage DecodedImage::WrapImage() const
+{
+    if (!IsOk()) return wxImage();
+
+    // static data ... wxImage will not free or reallocate it
+    return wxImage(_width, _height,
+                   const_cast<unsigned char*>(_rgb.data()),
+                   HasAlpha() ? const_cast<unsigned char*>(_alpha.data()) : nullptr,
+                   true);
+}
+
+wxImage DecodedImage::CopyImage() const
+{
+    if (!IsOk()) return wxImage();
+
+    wxImage image(_width, _height, false);
+    memcpy(image.GetData(), _rgb.data(), _rgb.size());
+    if (HasAlpha()) {
+        image.InitAlpha();
+        memcpy(image.GetAlpha(), _alpha.data(), _alpha.size());
+    }
+    return image;
+}
+
+#pragma endregion
+
+#pragma region ImageAssetCache
+
+class ImageDecodeJob : public Job
+{
+    std::function<void()> _func;
+    std::string _name;
+
+public:
+    ImageDecodeJob(const std::string& name, std::function<void()>&& func) : _func(std::move(func)), _name(name) {}
+    virtual void Process() override { _func(); }
+    virtual bool DeleteWhenComplete() override { return true; }
+    virtual const std::string GetName() const override { return _name; }
+};
+
+ImageAssetCache& ImageAssetCache::Instance()
+{
+    static ImageAssetCache cache;
+    return cache;
+}
+
+ImageAssetCache::ImageAssetCache() :
+    _memoryBudget(IMAGE_ASSET_CACHE_DEFAULT_BUDGET),
+    _decodePool(std::make_unique<JobPool>("image_decode"))
+{
+    _decodePool->Start(IMAGE_ASSET_CACHE_DECODE_THREADS);
+}
+
+ImageAssetCache::~ImageAssetCache()
+{
+    _decodePool->Stop();
+}
+
+ImageAssetCache::SCALE_MODE ImageAssetCache::ScaleModeFromString(const std::string& scaleToFit)
+{
+    if (scaleToFit == "Scale To Fit") return SCALE_MODE::EXACT;
+    if (scaleToFit == "Scale Keep Aspect Ratio") return SCALE_MODE::KEEP_ASPECT;
+    if (scaleToFit == "Scale Keep Aspect Ratio Crop") return SCALE_MODE::KEEP_ASPECT_CROP;
+    return SCALE_MODE::NONE;
+}
+
+static std::string MakeKey(const std::string& filename, time_t modified, int frame, int width, int height, ImageAssetCache::SCALE_MODE mode)
+{
+    if (mode == ImageAssetCache::SCALE_MODE::NONE) {
+        width = 0;
+        height = 0;
+    }
+    return filename + "|" + std::to_string((long long)modified) + "|" + std::to_string(frame) + "|" +
+           std::to_string(width) + "x" + std::to_string(height) + "|" + std::to_string((int)mode);
+}
+
+static time_t GetModifiedTime(const std::string& filename)
+{
+    if (!FileExists(filename)) return -1;
+    return wxFileModificationTime(filename);
+}
+
+ImageAssetCache::ImagePtr ImageAssetCache::GetImage(const std::string& filename, int frame, int width, int height, SCALE_MODE mode)
+{
+    return Request(filename, frame, width, height, mode).get();
+}
+
+void ImageAssetCache::Prefetch(const std::string& filename, int frame, int width, int height, SCALE_MODE mode)
+{
+    if (mode != SCALE_MODE::NONE && (width <= 0 || height <= 0)) return;
+
+    time_t modified = GetModifiedTime(filename);
+    if (modified == -1) return;
+    std::string key = MakeKey(filename, modified, frame, width, height, mode);
+
+    std::shared_ptr<std::promise<ImagePtr>> promise;
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        if (_cache.find(key) != _cache.end()) return;
+        promise = std::make_shared<std::promise<ImagePtr>>();
+        auto& entry = _cache[key];
+        entry.image = promise->get_future().share();
+        _lru.push_front(key);
+        entry.lru = _lru.begin();
+    }
+
+    _decodePool->PushJob(new ImageDecodeJob("Decode " + filename, [this, promise, key, filename, frame, width, height, mode]() {
+        ImagePtr image = Decode(filename, frame, width, height, mode);
+        Loaded(key, image);
+        promise->set_value(image);
+    }));
+}
+
+std::shared_future<ImageAssetCache::ImagePtr> ImageAssetCache::Request(const std::string& filename, int frame, int width, int height, SCALE_MODE mode)
+{
+    if (mode != SCALE_MODE::NONE && (width <= 0 || height <= 0)) {
+        mode = SCALE_MODE::NONE;
+    }
+
+    time_t modified = GetModifiedTime(filename);
+    if (modified == -1) {
+        std::promise<ImagePtr> missing;
+        missing.set_value(nullptr);
+        return missing.get_future().share();
+    }
+    std::string key = MakeKey(filename, modified, frame, width, height, mode);
+
+    std::promise<ImagePtr> promise;
+    std::shared_future<ImagePtr> result;
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        auto it = _cache.find(key);
+        if (it != _cache.end()) {
+            // most recently used moves to the front
+            _lru.splice(_lru.begin(), _lru, it->second.lru);
+            return it->second.image;
+        }
+        result = promise.get_future().share();
+        auto& entry = _cache[key];
+        entry.image = result;
+        _lru.push_front(key);
+        entry.lru = _lru.begin();
+    }
+
+    // we own this one so decode it on the calling thread rather than queuing behind
+    // prefetches, anyone else asking for it will wait on the future
+    ImagePtr image = Decode(filename, frame, width, height, mode);
+    Loaded(key, image);
+    promise.set_value(image);
+    return result;
+}
+
+ImageAssetCache::ImagePtr ImageAssetCache::Decode(const std::string& filename, int frame, int width, int height, SCALE_MODE mode)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (mode == SCALE_MODE::NONE) {
+        wxStopWatch sw;
+        wxLogNull logNo; // suppress popups from png images. See http://trac.wxwidgets.org/ticket/15331
+        wxImage image;
+        if (!image.LoadFile(filename, wxBITMAP_TYPE_ANY, frame) || !image.IsOk()) {
+            logger_base.error("ImageAssetCache: Error loading image file: %s.", (const char*)filename.c_str());
+            return nullptr;
+        }
+        if (sw.Time() > 100) {
+            logger_base.debug("ImageAssetCache: Decoding %s (%dx%d) took %ldms.", (const char*)filename.c_str(), image.GetWidth(), image.GetHeight(), sw.Time());
+        }
+        return ToDecodedImage(image);
+    }
+
+    // scale from the unscaled image which is likely already cached for another buffer size
+    ImagePtr raw;
+    std::string rawKey = MakeKey(filename, GetModifiedTime(filename), frame, 0, 0, SCALE_MODE::NONE);
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        auto it = _cache.find(rawKey);
+        if (it != _cache.end() && it->second.loaded) {
+            raw = it->second.image.get();
+        }
+    }
+    if (raw == nullptr) {
+        // never wait on a decode that may still be queued on the pool ... just do it here
+        raw = Decode(filename, frame, 0, 0, SCALE_MODE::NONE);
+        if (raw == nullptr) return nullptr;
+
+        std::promise<ImagePtr> promise;
+        promise.set_value(raw);
+        std::unique_lock<std::mutex> lock(_lock);
+        if (_cache.find(rawKey) == _cache.end()) {
+            auto& entry = _cache[rawKey];
+            entry.image = promise.get_future().share();
+            entry.loaded = true;
+            entry.size = raw->GetMemorySize();
+            _lru.push_front(rawKey);
+            entry.lru = _lru.begin();
+            _memoryUsed += entry.size;
+        }
+    }
+
+    wxImage image = raw->WrapImage();
+    int w = width;
+    int h = height;
+    if (mode == SCALE_MODE::KEEP_ASPECT || mode == SCALE_MODE::KEEP_ASPECT_CROP) {
+        float xr = (float)width / (float)image.GetWidth();
+        float yr = (float)height / (float)image.GetHeight();
+        float sc = (mode == SCALE_MODE::KEEP_ASPECT) ? std::min(xr, yr) : std::max(xr, yr);
+        w = image.GetWidth() * sc;
+        h = image.GetHeight() * sc;
+    }
+    w = std::max(w, 1);
+    h = std::max(h, 1);
+    if (w == image.GetWidth() && h == image.GetHeight()) {
+        return raw;
+    }
+    image.Rescale(w, h);
+    return ToDecodedImage(image);
+}
+
+ImageAssetCache::ImagePtr ImageAssetCache::ToDecodedImage(wxImage& image)
+{
+    // masked images become alpha images so the cached data is just the two planes
+    if (image.HasMask() && !image.HasAlpha()) {
+        image.InitAlpha();
+    }
+
+    auto decoded = std::make_shared<DecodedImage>();
+    decoded->_width = image.GetWidth();
+    decoded->_height = image.GetHeight();
+    size_t pixels = (size_t)decoded->_width * (size_t)decoded->_height;
+    decoded->_rgb.assign(image.GetData(), image.GetData() + pixels * 3);
+    if (image.HasAlpha()) {
+        decoded->_alpha.assign(image.GetAlpha(), image.GetAlpha() + pixels);
+    }
+    return decoded;
+}
+
+void ImageAssetCache::Loaded(const std::string& key, const ImagePtr& image)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    auto it = _cache.find(key);
+    if (it == _cache.end()) return; // cleared while we were loading
+
+    it->second.loaded = true;
+    it->second.size = image == nullptr ? 0 : image->GetMemorySize();
+    _memoryUsed += it->second.size;
+    Evict();
+}
+
+// must be called with the lock held
+void ImageAssetCache::Evict()
+{
+    auto it = _lru.end();
+    while (_memoryUsed > _memoryBudget && it != _lru.begin()) {
+        --it;
+        auto ce = _cache.find(*it);
+        if (ce != _cache.end() && ce->second.loaded) {
+            // anyone still using the image holds their own reference to it
+            _memoryUsed -= ce->second.size;
+            _cache.erase(ce);
+            it = _lru.erase(it);
+        }
+    }
+}
+
+int ImageAssetCache::GetImageCount(const std::string& filename)
+{
+    time_t modified = GetModifiedTime(filename);
+    if (modified == -1) return 0;
+
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        auto it = _imageCounts.find(filename);
+        if (it != _imageCounts.end() && it->second.first == modified) {
+            return it->second.second;
+        }
+    }
+
+    wxLogNull logNo;
+    int count = wxImage::GetImageCount(filename);
+
+    std::unique_lock<std::mutex> lock(_lock);
+    _imageCounts[filename] = { modified, count };
+    return count;
+}
+
+void ImageAssetCache::SetMemoryBudget(size_t bytes)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _memoryBudget = bytes;
+    Evict();
+}
+
+void ImageAssetCache::Clear()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    // in progress decodes will find their entry gone and just hand the image to whoever is waiting
+    _cache.clear();
+    _lru.clear();
+    _imageCounts.clear();
+    _memoryUsed = 0;
+}
+
+#pragma endregion
@@ -0,0 +1,112 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <string>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <vector>
+
+#include <wx/image.h>
+
+class JobPool;
+
+// A decoded image held by the ImageAssetCache. The pixel data is laid out the way
+// wxImage stores it (RGB plane + optional alpha plane) so it can be wrapped without
+// copying. It is never modified once it is in the cache.
+class DecodedImage
+{
+    friend class ImageAssetCache;
+
+    int _width = 0;
+    int _height = 0;
+    std::vector<unsigned char> _rgb;
+    std::vector<unsigned char> _alpha;
+
+public:
+    int GetWidth() const { return _width; }
+    int GetHeight() const { return _height; }
+    bool HasAlpha() const { return !_alpha.empty(); }
+    bool IsOk() const { return _width > 0 && _height > 0; }
+    size_t GetMemorySize() const { return _rgb.size() + _alpha.size(); }
+
+    // The returned image references the cached pixel data so the DecodedImage must
+    // outlive it. Operations that replace the image data (Rescale, Rotate etc) are
+    // fine, operations that write pixels in place (SetRGB, SetAlpha) are not.
+    wxImage WrapImage() const;
+    // A fully independent copy
+    wxImage CopyImage() const;
+};
+
+// Process wide cache of decoded still images keyed by path, modification time,
+// target size, scaling mode and frame index. The same file placed on many models
+// is only decoded and scaled once. Decodes run on a dedicated job pool so
+// callers that ask for the same image at the same time wait for a single decode.
+class ImageAssetCache
+{
+public:
+    enum class SCALE_MODE
+    {
+        NONE,              // as loaded, width/height ignored
+        EXACT,             // stretched to width x height
+        KEEP_ASPECT,       // largest size that fits within width x height
+        KEEP_ASPECT_CROP   // smallest size that covers width x height
+    };
+
+    typedef std::shared_ptr<const DecodedImage> ImagePtr;
+
+    static ImageAssetCache& Instance();
+
+    // Blocks until the image is available. Returns nullptr if the file can't be read.
+    ImagePtr GetImage(const std::string& filename, int frame = 0, int width = 0, int height = 0, SCALE_MODE mode = SCALE_MODE::NONE);
+
+    // Queues a decode on the decode pool if the image isn't already cached or loading
+    void Prefetch(const std::string& filename, int frame = 0, int width = 0, int height = 0, SCALE_MODE mode = SCALE_MODE::NONE);
+
+    // Number of images in the file, cached so the file isn't re-parsed for every buffer
+    int GetImageCount(const std::string& filename);
+
+    void SetMemoryBudget(size_t bytes);
+    size_t GetMemoryBudget() const { return _memoryBudget; }
+    size_t GetMemoryUsed() const { return _memoryUsed; }
+    void Clear();
+
+    static SCALE_MODE ScaleModeFromString(const std::string& scaleToFit);
+
+private:
+    ImageAssetCache();
+    ~ImageAssetCache();
+
+    struct CacheEntry
+    {
+        std::shared_future<ImagePtr> image;
+        size_t size = 0;
+        bool loaded = false;
+        std::list<std::string>::iterator lru;
+    };
+
+    std::shared_future<ImagePtr> Request(const std::string& filename, int frame, int width, int height, SCALE_MODE mode);
+    ImagePtr Decode(const std::string& filename, int frame, int width, int height, SCALE_MODE mode);
+    static ImagePtr ToDecodedImage(wxImage& image);
+    void Loaded(const std::string& key, const ImagePtr& image);
+    void Evict();
+
+    std::mutex _lock;
+    std::map<std::string, CacheEntry> _cache;
+    std::map<std::string, std::pair<time_t, int>> _imageCounts;
+    std::list<std::string> _lru;
+    size_t _memoryBudget;
+    size_t _memoryUsed = 0;
+    std::unique_ptr<JobPool> _decodePool;
+};
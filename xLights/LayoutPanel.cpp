@@ -5277,8 +5277,9 @@ void LayoutPanel::PreviewModelResize(bool sameWidth, bool sameHeight)
 
     // check if custom 3d and set model fingerprint
     if (selectedType == "Custom") {
-        customFingerprint = selectedModel->GetModelXml()->GetAttribute("CustomModel", "");
-        if (wxSplit(customFingerprint, '|').size() > 1) {
+        CustomModel* cm = dynamic_cast<CustomModel*>(selectedModel);
+        if (cm != nullptr && cm->GetCustomDepth() > 1) {
+            customFingerprint = cm->GetCustomData();
             isCustom3d = true;
         }
     }
@@ -5293,9 +5294,9 @@ void LayoutPanel::PreviewModelResize(bool sameWidth, bool sameHeight)
 
             // if selected is Custom3d check if model fingerprints match
             if (isCustom3d && customFingerprint != "") {
-                wxString mToResizeFingerprint = modelToResize->GetModelXml()->GetAttribute("CustomModel", "");
+                CustomModel* cmToResize = dynamic_cast<CustomModel*>(modelToResize);
 
-                if (customFingerprint == mToResizeFingerprint) {
+                if (cmToResize != nullptr && customFingerprint == cmToResize->GetCustomData()) {
                     custom3dPrintsMatch = true;
                 }
             }
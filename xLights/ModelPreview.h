@@ -75,9 +75,8 @@ public:
 	void SetbackgroundImage(wxString image);
     const wxString &GetBackgroundImage() const { return mBackgroundImage;}
 	void SetBackgroundBrightness(int brightness, int alpha);
-/*
     int GetBackgroundBrightness() const { return mBackgroundBrightness;}
-     */
+    int GetBackgroundAlpha() const { return mBackgroundAlpha;}
     void SetScaleBackgroundImage(bool b);
     bool GetScaleBackgroundImage() const { return scaleImage; }
 
@@ -120,6 +119,7 @@ public:
     void SetPan(float deltax, float deltay, float deltaz);
     void Set3D(bool value) { is3d = value; }
     bool Is3D() const { return is3d; }
+    const PreviewCamera* GetCamera(bool is_3d) const { return is_3d ? camera3d : camera2d; }
     glm::mat4& GetProjViewMatrix() { return ProjViewMatrix; }
     glm::mat4& GetProjMatrix() { return ProjMatrix; }
 
@@ -134,6 +134,7 @@ public:
     }
     void SetDisplay2DGrid(bool grid, long gridSpacing) { _displayGrid = grid; _displayGridSpacing = gridSpacing; grid2dValid=false; }
     void SetDisplay2DCenter0(bool bb) { _center2D0 = bb; grid2dValid=false; }
+    bool GetDisplay2DCenter0() const { return _center2D0; }
 
     bool IsNoCurrentModel() { return currentModel == "&---none---&"; }
     void SetRenderOrder(int i) { renderOrder = i; Refresh(); }
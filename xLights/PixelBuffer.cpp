@@ -21,6 +21,7 @@
 
 #include <cmath>
 #include <random>
+#include <typeinfo>
 #include "Parallel.h"
 #include "UtilFunctions.h"
 #include "DissolveTransitionPattern.h"
@@ -915,6 +916,7 @@ void PixelBufferClass::reset(int nlayers, int timing, bool isNode)
 
     numLayers = nlayers;
     layers.resize(nlayers);
+    _encodeProgramValid = false;
 
     for (int x = 0; x < numLayers; x++)
     {
@@ -2370,6 +2372,9 @@ void PixelBufferClass::SetLayerSettings(int layer, const SettingsMap &settingsMa
 
         int origNodeCount = inf->buffer.Nodes.size();
         inf->buffer.Nodes.clear();
+        if (layer == 0) {
+            _encodeProgramValid = false;
+        }
 
         // If we are a 'Per Model Default' render buffer then we need to ensure we create a full set of pixels
         // so we change the type of the render buffer but just for model initialisation
@@ -2488,6 +2493,49 @@ void PixelBufferClass::SetLayerSettings(int layer, const SettingsMap &settingsMa
             inf->modelBuffers = nullptr;
         }
     }
+    UpdateSparseRendering();
+}
+
+bool PixelBufferClass::LayerInfo::ReadsUnmappedCells() const
+{
+    if (blur > 1 || BlurValueCurve.IsActive()) return true;
+    if (zoom != 1.0f || ZoomValueCurve.IsActive()) return true;
+    if (rotation != 0 || RotationValueCurve.IsActive() || RotationsValueCurve.IsActive()) return true;
+    if ((xrotation != 0 && xrotation != 360) || XRotationValueCurve.IsActive()) return true;
+    if ((yrotation != 0 && yrotation != 360) || YRotationValueCurve.IsActive()) return true;
+    // fades just scale the output, the other transitions move pixels around
+    if (fadeInSteps > 0 && inTransitionType != STR_FADE) return true;
+    if (fadeOutSteps > 0 && outTransitionType != STR_FADE) return true;
+    return false;
+}
+
+void PixelBufferClass::UpdateSparseRendering()
+{
+    // the last layer is the blend layer which is never rendered into
+    std::vector<bool> allowed(numLayers, true);
+    for (int i = 0; i < numLayers; i++) {
+        LayerInfo* inf = layers[i];
+        if (inf->ReadsUnmappedCells()) {
+            allowed[i] = false;
+            // transitions also read the layer below
+            if (i + 1 < numLayers) allowed[i + 1] = false;
+        }
+        if (inf->canvas) {
+            // canvas layers are preloaded from every cell of the layers below
+            for (int j = i + 1; j < numLayers; j++) {
+                allowed[j] = false;
+            }
+        }
+    }
+    for (int i = 0; i < numLayers; i++) {
+        layers[i]->buffer.SetSparseRenderAllowed(allowed[i]);
+        for (auto& it : layers[i]->shallowModelBuffers) {
+            it->SetSparseRenderAllowed(allowed[i]);
+        }
+        for (auto& it : layers[i]->deepModelBuffers) {
+            it->SetSparseRenderAllowed(allowed[i]);
+        }
+    }
 }
 
 bool PixelBufferClass::IsPersistent(int layer) {
@@ -2605,64 +2653,183 @@ static inline bool IsInRange(const std::vector<bool> &restrictRange, size_t star
     return restrictRange[start];
 }
 
-void PixelBufferClass::GetColors(unsigned char *fdata, const std::vector<bool> &restrictRange) {
+void PixelBufferClass::EncodeNode(NodeBaseClass* n, unsigned char* fdata) const
+{
+    size_t start = n->ActChan;
+    if (n->model != nullptr) { // should never be null
+        DimmingCurve *curve = n->model->modelDimmingCurve;
+        if (curve != nullptr) {
+            if (n->GetChanCount() == 1) {
+                uint8_t buf[3] = {0, 0, 0};
+                n->GetForChannels(buf);
+                xlColor color(buf[0], buf[0], buf[0]);
+                curve->apply(color);
+
+                n->SetColor(color);
+            } else {
+                xlColor color;
+                n->GetColor(color);
+                curve->apply(color);
+                n->SetColor(color);
+            }
+        }
+    }
+    n->GetForChannels(&fdata[start]);
+}
 
-    // KW ... I think this needs to be optimised
-
-    if (layers[0] != nullptr) { // I dont like this ... it should never be null
-        if (layers[0]->buffer.Nodes.size() < 1000) {
-            //smaller model, no sense in setting up the parallel_for
-            for (auto &n : layers[0]->buffer.Nodes) {
-                size_t start = n->ActChan;
-                if (IsInRange(restrictRange, start)) {
-                    if (n->model != nullptr) { // nor this
-                        DimmingCurve *curve = n->model->modelDimmingCurve;
-                        if (curve != nullptr) {
-                            if (n->GetChanCount() == 1) {
-                                uint8_t buf[3] = {0, 0, 0};
-                                n->GetForChannels(buf);
-                                xlColor color(buf[0], buf[0], buf[0]);
-                                curve->apply(color);
-
-                                n->SetColor(color);
-                            } else {
-                                xlColor color;
-                                n->GetColor(color);
-                                curve->apply(color);
-                                n->SetColor(color);
-                            }
-                        }
-                    }
-                    n->GetForChannels(&fdata[start]);
+void PixelBufferClass::CompileEncodeProgram()
+{
+    _encodeRuns.clear();
+    _encodeOtherNodes.clear();
+    _encodeLuts.clear();
+    _encodeCurves.clear();
+
+    const auto& nodes = layers[0]->buffer.Nodes;
+    _encodeNodeCount = nodes.size();
+    for (uint32_t i = 0; i < nodes.size(); i++) {
+        NodeBaseClass* n = nodes[i].get();
+        if (typeid(*n) != typeid(NodeBaseClass) || n->GetChanCount() != 3) {
+            _encodeOtherNodes.push_back(i);
+            continue;
+        }
+
+        DimmingCurve* curve = n->model == nullptr ? nullptr : n->model->modelDimmingCurve;
+        int lut = -1;
+        if (curve != nullptr) {
+            for (size_t c = 0; c < _encodeCurves.size(); c++) {
+                if (_encodeCurves[c].second == curve) {
+                    lut = c;
+                    break;
                 }
             }
+            if (lut == -1) {
+                // every curve type maps each channel independently so three tables capture it
+                std::array<uint8_t, 768> table;
+                for (int v = 0; v < 256; v++) {
+                    xlColor color(v, v, v);
+                    curve->apply(color);
+                    table[v] = color.red;
+                    table[256 + v] = color.green;
+                    table[512 + v] = color.blue;
+                }
+                lut = _encodeLuts.size();
+                _encodeLuts.push_back(table);
+                _encodeCurves.push_back({ n->model, curve });
+            }
+        }
+
+        const uint8_t* offsets = n->GetChannelOffsets();
+        if (!_encodeRuns.empty()) {
+            EncodeRun& r = _encodeRuns.back();
+            if (r.firstNode + r.count == i && r.startChannel + r.count * 3 == n->ActChan && r.lut == lut &&
+                r.offsets[0] == offsets[0] && r.offsets[1] == offsets[1] && r.offsets[2] == offsets[2]) {
+                r.count++;
+                continue;
+            }
+        }
+        _encodeRuns.push_back({ i, 1, n->ActChan, { offsets[0], offsets[1], offsets[2] }, lut });
+    }
+
+    // keep the runs small enough to spread over the render threads
+    static const uint32_t MAX_RUN_LENGTH = 4096;
+    std::vector<EncodeRun> split;
+    split.reserve(_encodeRuns.size());
+    for (const auto& r : _encodeRuns) {
+        for (uint32_t x = 0; x < r.count; x += MAX_RUN_LENGTH) {
+            split.push_back({ r.firstNode + x, std::min(MAX_RUN_LENGTH, r.count - x), r.startChannel + x * 3, { r.offsets[0], r.offsets[1], r.offsets[2] }, r.lut });
+        }
+    }
+    _encodeRuns.swap(split);
+    _encodeProgramValid = true;
+}
+
+bool PixelBufferClass::IsEncodeProgramValid() const
+{
+    if (!_encodeProgramValid || _encodeNodeCount != layers[0]->buffer.Nodes.size()) {
+        return false;
+    }
+    // dimming curves are replaced when the model properties change
+    for (const auto& it : _encodeCurves) {
+        if (it.first->modelDimmingCurve != it.second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void PixelBufferClass::GetColors(unsigned char *fdata, const std::vector<bool> &restrictRange) {
+
+    if (layers[0] == nullptr) { // I dont like this ... it should never be null
+        return;
+    }
+    if (!IsEncodeProgramValid()) {
+        CompileEncodeProgram();
+    }
+
+    const auto& nodes = layers[0]->buffer.Nodes;
+    // the node colours are left undimmed, nothing reads them again before CalcOutput replaces them
+    auto runEncode = [this, &nodes, fdata, &restrictRange](const EncodeRun& r) {
+        static const std::array<uint8_t, 768> IDENTITY = [] {
+            std::array<uint8_t, 768> t;
+            for (int i = 0; i < 768; i++) {
+                t[i] = i & 0xFF;
+            }
+            return t;
+        }();
+        const uint8_t* lut = r.lut == -1 ? IDENTITY.data() : _encodeLuts[r.lut].data();
+        const uint8_t* lutR = lut;
+        const uint8_t* lutG = lut + 256;
+        const uint8_t* lutB = lut + 512;
+        const uint8_t o0 = r.offsets[0];
+        const uint8_t o1 = r.offsets[1];
+        const uint8_t o2 = r.offsets[2];
+        unsigned char* dest = &fdata[r.startChannel];
+        const NodeBaseClassPtr* src = &nodes[r.firstNode];
+        if (restrictRange.empty()) {
+            for (uint32_t x = 0; x < r.count; x++, dest += 3) {
+                const uint8_t* c = src[x]->GetRawColor();
+                dest[o0] = lutR[c[0]];
+                dest[o1] = lutG[c[1]];
+                dest[o2] = lutB[c[2]];
+            }
         } else {
-            parallel_for(0,  layers[0]->buffer.Nodes.size(), [&](int i) {
-                auto &n = layers[0]->buffer.Nodes[i];
-                size_t start = n->ActChan;
-                if (IsInRange(restrictRange, start)) {
-                    if (n->model != nullptr) { // nor this
-                        DimmingCurve *curve = n->model->modelDimmingCurve;
-                        if (curve != nullptr) {
-                            if (n->GetChanCount() == 1) {
-                                uint8_t buf[3] = {0, 0, 0};
-                                n->GetForChannels(buf);
-                                xlColor color(buf[0], buf[0], buf[0]);
-                                curve->apply(color);
-
-                                n->SetColor(color);
-                            } else {
-                                xlColor color;
-                                n->GetColor(color);
-                                curve->apply(color);
-                                n->SetColor(color);
-                            }
-                        }
-                    }
-                    n->GetForChannels(&fdata[start]);
+            size_t chan = r.startChannel;
+            for (uint32_t x = 0; x < r.count; x++, dest += 3, chan += 3) {
+                if (IsInRange(restrictRange, chan)) {
+                    const uint8_t* c = src[x]->GetRawColor();
+                    dest[o0] = lutR[c[0]];
+                    dest[o1] = lutG[c[1]];
+                    dest[o2] = lutB[c[2]];
                 }
-            }, 500);
+            }
+        }
+    };
+
+    if (_encodeRuns.size() > 1 && nodes.size() >= 10000) {
+        parallel_for(0, _encodeRuns.size(), [&](int i) {
+            runEncode(_encodeRuns[i]);
+        });
+    } else {
+        for (const auto& r : _encodeRuns) {
+            runEncode(r);
+        }
+    }
+
+    if (_encodeOtherNodes.size() < 1000) {
+        //smaller model, no sense in setting up the parallel_for
+        for (auto i : _encodeOtherNodes) {
+            auto& n = nodes[i];
+            if (IsInRange(restrictRange, n->ActChan)) {
+                EncodeNode(n.get(), fdata);
+            }
         }
+    } else {
+        parallel_for(0, _encodeOtherNodes.size(), [&](int i) {
+            auto& n = nodes[_encodeOtherNodes[i]];
+            if (IsInRange(restrictRange, n->ActChan)) {
+                EncodeNode(n.get(), fdata);
+            }
+        }, 500);
     }
 }
 
@@ -2722,25 +2889,34 @@ void PixelBufferClass::RotateX(LayerInfo* layer, float offset)
             xpivot = layer->XPivotValueCurve.GetOutputValueAt(offset, layer->buffer.GetStartTimeMS(), layer->buffer.GetEndTimeMS());
         }
 
-        RenderBuffer orig(layer->buffer);
-        layer->buffer.Clear();
-
         float sine = sin((xrotation + 90) * M_PI / 180);
         float pivot = xpivot * layer->buffer.BufferWi / 100;
 
-        for (int x = pivot; x < layer->buffer.BufferWi; ++x) {
-            float tox = sine * (x - pivot) + pivot;
-            for (int y = 0; y < layer->buffer.BufferHt; ++y) {
-                layer->buffer.SetPixel(tox, y, orig.GetPixel(x, y));
+        int w = layer->buffer.BufferWi;
+        int h = layer->buffer.BufferHt;
+        RemapTable& remap = layer->xRotateRemap;
+        if (!remap.IsValid(w, h, { sine, pivot })) {
+            // columns are written outwards from the pivot, the last one written to a column wins
+            remap.Reset(w, h, { sine, pivot });
+            for (int x = pivot; x < w; ++x) {
+                int tox = sine * (x - pivot) + pivot;
+                if (tox >= 0 && tox < w) {
+                    for (int y = 0; y < h; ++y) {
+                        remap.Set(tox, y, y * w + x);
+                    }
+                }
             }
-        }
 
-        for (int x = pivot - 1; x >= 0; --x) {
-            float tox = -1 * sine * (pivot - x) + pivot;
-            for (int y = 0; y < layer->buffer.BufferHt; ++y) {
-                layer->buffer.SetPixel(tox, y, orig.GetPixel(x, y));
+            for (int x = pivot - 1; x >= 0; --x) {
+                int tox = -1 * sine * (pivot - x) + pivot;
+                if (tox >= 0 && tox < w) {
+                    for (int y = 0; y < h; ++y) {
+                        remap.Set(tox, y, y * w + x);
+                    }
+                }
             }
         }
+        remap.Apply(layer->buffer, xlCLEAR);
     }
 }
 
@@ -2760,25 +2936,34 @@ void PixelBufferClass::RotateY(LayerInfo* layer, float offset)
             ypivot = layer->YPivotValueCurve.GetOutputValueAt(offset, layer->buffer.GetStartTimeMS(), layer->buffer.GetEndTimeMS());
         }
 
-        RenderBuffer orig(layer->buffer);
-        layer->buffer.Clear();
-
         float sine = sin((yrotation + 90) * M_PI / 180);
         float pivot = ypivot * layer->buffer.BufferHt / 100;
 
-        for (int y = pivot; y < layer->buffer.BufferHt; ++y) {
-            float toy = sine * (y - pivot) + pivot;
-            for (int x = 0; x < layer->buffer.BufferWi; ++x) {
-                layer->buffer.SetPixel(x, toy, orig.GetPixel(x, y));
+        int w = layer->buffer.BufferWi;
+        int h = layer->buffer.BufferHt;
+        RemapTable& remap = layer->yRotateRemap;
+        if (!remap.IsValid(w, h, { sine, pivot })) {
+            // rows are written outwards from the pivot, the last one written to a row wins
+            remap.Reset(w, h, { sine, pivot });
+            for (int y = pivot; y < h; ++y) {
+                int toy = sine * (y - pivot) + pivot;
+                if (toy >= 0 && toy < h) {
+                    for (int x = 0; x < w; ++x) {
+                        remap.Set(x, toy, y * w + x);
+                    }
+                }
             }
-        }
 
-        for (int y = pivot - 1; y >= 0; --y) {
-            float toy = -1 * sine * (pivot - y) + pivot;
-            for (int x = 0; x < layer->buffer.BufferWi; ++x) {
-                layer->buffer.SetPixel(x, toy, orig.GetPixel(x, y));
+            for (int y = pivot - 1; y >= 0; --y) {
+                int toy = -1 * sine * (pivot - y) + pivot;
+                if (toy >= 0 && toy < h) {
+                    for (int x = 0; x < w; ++x) {
+                        remap.Set(x, toy, y * w + x);
+                    }
+                }
             }
         }
+        remap.Apply(layer->buffer, xlCLEAR);
     }
 }
 
@@ -2813,8 +2998,6 @@ void PixelBufferClass::RotateZAndZoom(LayerInfo* layer, float offset)
         GPURenderUtils::waitForRenderCompletion(&layer->buffer);
 
         static const float PI_2 = 6.283185307f;
-        xlColor c;
-        RenderBuffer orig(layer->buffer);
         int q = layer->zoomquality;
         int cx = layer->pivotpointx;
         if (layer->PivotPointXValueCurve.IsActive()) {
@@ -2829,29 +3012,36 @@ void PixelBufferClass::RotateZAndZoom(LayerInfo* layer, float offset)
         float angle = PI_2 * -rotation;
         float xoff = (cx * layer->buffer.BufferWi) / 100.0;
         float yoff = (cy * layer->BufferHt) / 100.0;
-        float anglecos = cos(-angle);
-        float anglesin = sin(-angle);
 
-        layer->buffer.Clear();
-        for (int x = 0; x < layer->BufferWi; x++) {
-            for (int i = 0; i < q; i++) {
-                for (int y = 0; y < layer->BufferHt; y++) {
-                    orig.GetPixel(x, y, c);
-                    for (int j = 0; j < q; j++) {
-                        float xx = (float)x + ((float)i * inc) - xoff;
-                        float yy = (float)y + ((float)j * inc) - yoff;
-                        float u = xoff + anglecos * xx * zoom + anglesin * yy * zoom;
-                        if (u >= 0 && u < layer->BufferWi) {
-                            float v = yoff + -anglesin * xx * zoom + anglecos * yy * zoom;
-
-                            if (v >= 0 && v < layer->BufferHt) {
-                                layer->buffer.SetPixel(u, v, c);
+        RemapTable& remap = layer->zRotateRemap;
+        std::vector<double> key = { angle, zoom, xoff, yoff, (double)q };
+        if (!remap.IsValid(layer->buffer.BufferWi, layer->buffer.BufferHt, key)) {
+            float anglecos = cos(-angle);
+            float anglesin = sin(-angle);
+
+            // each source pixel is scattered q x q times ... record the last source to land on each destination
+            remap.Reset(layer->buffer.BufferWi, layer->buffer.BufferHt, key);
+            for (int x = 0; x < layer->BufferWi; x++) {
+                for (int i = 0; i < q; i++) {
+                    for (int y = 0; y < layer->BufferHt; y++) {
+                        int32_t source = y * layer->buffer.BufferWi + x;
+                        for (int j = 0; j < q; j++) {
+                            float xx = (float)x + ((float)i * inc) - xoff;
+                            float yy = (float)y + ((float)j * inc) - yoff;
+                            float u = xoff + anglecos * xx * zoom + anglesin * yy * zoom;
+                            if (u >= 0 && u < layer->BufferWi) {
+                                float v = yoff + -anglesin * xx * zoom + anglecos * yy * zoom;
+
+                                if (v >= 0 && v < layer->BufferHt) {
+                                    remap.Set((int)u, (int)v, source);
+                                }
                             }
                         }
                     }
                 }
             }
         }
+        remap.Apply(layer->buffer, xlCLEAR);
     }
 }
 
@@ -2907,6 +3097,9 @@ void PixelBufferClass::PrepareVariableSubBuffer(int EffectPeriod, int layer)
     const std::string &camera = layers[layer]->camera;
     const std::string &transform = layers[layer]->transform;
     layers[layer]->buffer.Nodes.clear();
+    if (layer == 0) {
+        _encodeProgramValid = false;
+    }
     model->InitRenderBufferNodes(type, camera, transform, layers[layer]->buffer.Nodes, layers[layer]->BufferWi, layers[layer]->BufferHt);
     ComputeSubBuffer(subBuffer, layers[layer]->buffer.Nodes, layers[layer]->BufferWi, layers[layer]->BufferHt, offset, layers[layer]->buffer.GetStartTimeMS(), layers[layer]->buffer.GetEndTimeMS());
     layers[layer]->buffer.BufferWi = layers[layer]->BufferWi;
@@ -2914,6 +3107,7 @@ void PixelBufferClass::PrepareVariableSubBuffer(int EffectPeriod, int layer)
 
     if (layers[layer]->buffer.BufferWi == 0) layers[layer]->buffer.BufferWi = 1;
     if (layers[layer]->buffer.BufferHt == 0) layers[layer]->buffer.BufferHt = 1;
+    layers[layer]->buffer.InvalidateOccupiedCells();
 }
 
 void PixelBufferClass::HandleLayerBlurZoom(int EffectPeriod, int layer) {
@@ -12,9 +12,12 @@
 
 #include <wx/xml/xml.h>
 
+#include <array>
+
 #include "models/Model.h"
 #include "models/SingleLineModel.h"
 #include "RenderBuffer.h"
+#include "RemapTable.h"
 #include "ValueCurve.h"
 #include "RenderUtils.h"
 #include "Color.h"
@@ -182,6 +185,10 @@ private:
         int pivotpointy;
         int xpivot;
         int ypivot;
+        // rotations/zoom as gathers ... rebuilt only when the buffer size or settings change
+        RemapTable xRotateRemap;
+        RemapTable yRotateRemap;
+        RemapTable zRotateRemap;
         int brightness;
         int hueadjust;
         int saturationadjust;
@@ -220,6 +227,8 @@ private:
         void renderTransitions(bool isFirstFrame, const RenderBuffer* prevRB);
         void calculateMask(const std::string &type, bool mode, bool isFirstFrame);
         bool isMasked(int x, int y);
+        // true if blur, rotozoom or transitions read cells other than the ones nodes are mapped to
+        bool ReadsUnmappedCells() const;
 
         void clear();
         
@@ -260,6 +269,29 @@ private:
     void RotateX(LayerInfo* layer, float offset);
     void RotateY(LayerInfo* layer, float offset);
     void RotateZAndZoom(LayerInfo* layer, float offset);
+    void UpdateSparseRendering();
+
+    // GetColors encode program. Runs of plain RGB nodes on consecutive channels with the same
+    // channel order and dimming curve are written straight from the node colours through a
+    // lookup table. Anything else (RGBW, single colour, superstring etc) goes through the
+    // virtual node calls as before. Compiled on first use after the nodes change.
+    struct EncodeRun
+    {
+        uint32_t firstNode;
+        uint32_t count;
+        uint32_t startChannel;
+        uint8_t offsets[3];
+        int lut; // index into _encodeLuts, -1 for no dimming curve
+    };
+    std::vector<EncodeRun> _encodeRuns;
+    std::vector<uint32_t> _encodeOtherNodes;
+    std::vector<std::array<uint8_t, 768>> _encodeLuts;
+    std::vector<std::pair<const Model*, DimmingCurve*>> _encodeCurves;
+    uint32_t _encodeNodeCount = 0;
+    bool _encodeProgramValid = false;
+    void CompileEncodeProgram();
+    bool IsEncodeProgramValid() const;
+    void EncodeNode(NodeBaseClass* n, unsigned char* fdata) const;
     void GetMixedColor(int node, const std::vector<bool> & validLayers, int EffectPeriod, int saveLayer);
 
     std::string modelName;
@@ -0,0 +1,770 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "PreviewRasterizer.h"
+
+extern "C"
+{
+#include <libavutil/pixfmt.h>
+}
+
+#include <wx/image.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <log4cpp/Category.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <stdexcept>
+#include <typeinfo>
+
+#include "AudioManager.h"
+#include "DimmingCurve.h"
+#include "ExternalHooks.h"
+#include "Parallel.h"
+#include "SequenceData.h"
+#include "VideoExporter.h"
+#include "ViewpointMgr.h"
+#include "graphics/xlMeshCache.h"
+#include "models/MeshObject.h"
+#include "models/Model.h"
+#include "models/ModelScreenLocation.h"
+#include "models/Node.h"
+
+// keep the frames rendered ahead of the encoder to roughly this much memory
+#define PREVIEW_EXPORT_BATCH_BYTES (256 * 1024 * 1024)
+
+// mesh faces with no material
+static const xlColor MESH_DEFAULT_COLOR(200, 200, 200);
+
+PreviewRasterizer::Workspace::~Workspace()
+{
+}
+
+PreviewRasterizer::PreviewRasterizer(const Settings& settings, const std::vector<Model*>& models, const std::vector<MeshObject*>& meshes) :
+    _width(std::max(settings.width, 1)), _height(std::max(settings.height, 1)), _is3d(settings.is3d)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    _backdrop.resize((size_t)_width * _height * 3);
+    if (_is3d) {
+        _depth.resize((size_t)_width * _height, 1.0f);
+    }
+
+    SetupView(settings);
+
+    if (_is3d) {
+        for (auto m : meshes) {
+            DrawMesh(m);
+        }
+    } else {
+        DrawBackground(settings);
+    }
+
+    float pointScale = 1.0f;
+    if (!_is3d && settings.virtualWidth > 0 && settings.virtualHeight > 0 &&
+        (settings.virtualWidth != _width || settings.virtualHeight != _height)) {
+        // the house preview scales pixel sizes with the canvas
+        pointScale = std::min((float)_height / (float)settings.virtualHeight, (float)_width / (float)settings.virtualWidth);
+    }
+    for (auto m : models) {
+        AddModel(m, pointScale);
+    }
+
+    if (_is3d) {
+        // nearest drawn last so it covers what is behind it as the depth test would
+        std::stable_sort(_sprites.begin(), _sprites.end(), [](const Sprite& a, const Sprite& b) {
+            return a.depth > b.depth;
+        });
+    }
+
+    logger_base.debug("PreviewRasterizer: %d x %d %s, %d nodes, %d sprites.", _width, _height, _is3d ? "3D" : "2D",
+                      (int)_nodes.size(), (int)_sprites.size());
+}
+
+PreviewRasterizer::~PreviewRasterizer()
+{
+}
+
+void PreviewRasterizer::SetupView(const Settings& settings)
+{
+    // this must match ModelPreview::StartDrawing
+    PreviewCamera defaultCamera(_is3d);
+    const PreviewCamera* camera = settings.camera != nullptr ? settings.camera : &defaultCamera;
+
+    if (!_is3d) {
+        float scale2d = 1.0f;
+        float scale_corrx = 0.0f;
+        float scale_corry = 0.0f;
+        float zoom = camera->GetZoom();
+        if (settings.virtualWidth != 0 && settings.virtualHeight != 0) {
+            float scale2dh = (float)_height / (float)settings.virtualHeight;
+            float scale2dw = (float)_width / (float)settings.virtualWidth;
+            if (scale2dh < scale2dw) {
+                scale2d = scale2dh;
+                scale_corrx = ((scale2dw * (float)settings.virtualWidth - (scale2d * (float)settings.virtualWidth)) * zoom) / 2.0f;
+            } else {
+                scale2d = scale2dw;
+                scale_corry = ((scale2dh * (float)settings.virtualHeight - (scale2d * (float)settings.virtualHeight)) * zoom) / 2.0f;
+            }
+        }
+        // the zoom correction keeps the zoom centred on the window it was set in so work it out for our size
+        float zoomCorrX = ((_width * zoom) - _width) / 2.0f;
+        float zoomCorrY = ((_height * zoom) - _height) / 2.0f;
+
+        glm::mat4 ViewScale = glm::scale(glm::mat4(1.0f), glm::vec3(zoom * scale2d, zoom * scale2d, 1.0f));
+        glm::mat4 ViewTranslate = glm::translate(glm::mat4(1.0f), glm::vec3(camera->GetPanX() * zoom - zoomCorrX + scale_corrx, camera->GetPanY() * zoom - zoomCorrY + scale_corry, 0.0f));
+        _view = ViewTranslate * ViewScale;
+        if (settings.center2D0) {
+            glm::mat4 cTranslate = glm::translate(glm::mat4(1.0f), glm::vec3(((float)settings.virtualWidth) / 2.0f, 0.0f, 0.0f));
+            _view = ViewTranslate * ViewScale * cTranslate;
+        }
+        _proj = glm::mat4(1.0f);
+        _pixelsPerUnit2D = zoom * scale2d;
+    } else {
+        glm::mat4 ViewTranslatePan = glm::translate(glm::mat4(1.0f), glm::vec3(camera->GetPosX() + camera->GetPanX(), camera->GetPosY() + camera->GetPanY(), camera->GetPosZ() + camera->GetPanZ()));
+        glm::mat4 ViewTranslateDistance = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 1.0f, camera->GetDistance() * camera->GetZoom()));
+        glm::mat4 ViewRotateX = glm::rotate(glm::mat4(1.0f), glm::radians(camera->GetAngleX()), glm::vec3(1.0f, 0.0f, 0.0f));
+        glm::mat4 ViewRotateY = glm::rotate(glm::mat4(1.0f), glm::radians(camera->GetAngleY()), glm::vec3(0.0f, 1.0f, 0.0f));
+        glm::mat4 ViewRotateZ = glm::rotate(glm::mat4(1.0f), glm::radians(camera->GetAngleZ()), glm::vec3(0.0f, 0.0f, 1.0f));
+        _view = ViewTranslateDistance * ViewRotateX * ViewRotateY * ViewRotateZ * ViewTranslatePan;
+        _proj = glm::perspective(glm::radians(45.0f), (float)_width / (float)_height, 1.0f, 200000.0f);
+        // pixels per world unit at a view distance of 1
+        _focal = ((float)_height / 2.0f) / std::tan(glm::radians(45.0f) / 2.0f);
+    }
+}
+
+bool PreviewRasterizer::Project(float wx, float wy, float wz, float& sx, float& sy, float& depth, float& pixelsPerUnit) const
+{
+    if (!_is3d) {
+        // flattened onto the 0 plane, y is up
+        glm::vec4 v = _view * glm::vec4(wx, wy, 0.0f, 1.0f);
+        sx = v.x;
+        sy = (float)_height - v.y;
+        depth = 0.0f;
+        pixelsPerUnit = _pixelsPerUnit2D;
+        return true;
+    }
+
+    glm::vec4 clip = _proj * (_view * glm::vec4(wx, wy, wz, 1.0f));
+    if (clip.w <= 0.0f) {
+        return false;
+    }
+    float ndcz = clip.z / clip.w;
+    if (ndcz < -1.0f || ndcz > 1.0f) {
+        return false;
+    }
+    sx = (clip.x / clip.w + 1.0f) * 0.5f * (float)_width;
+    sy = (1.0f - clip.y / clip.w) * 0.5f * (float)_height;
+    depth = ndcz;
+    pixelsPerUnit = _focal / clip.w;
+    return true;
+}
+
+void PreviewRasterizer::AddModel(Model* m, float pointScale)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (!m->IsActive()) return;
+    if (m->IsDMXModel() || m->GetDisplayAs() == "Image") {
+        // these draw fixtures/images with their own preview code rather than as nodes
+        logger_base.debug("PreviewRasterizer: Model '%s' is drawn by its own preview code so is not included.", (const char*)m->GetName().c_str());
+        return;
+    }
+
+    ModelScreenLocation& location = m->GetModelScreenLocation();
+    location.PrepareToDraw(_is3d, false);
+
+    ModelInfo info;
+    if (m->modelDimmingCurve != nullptr) {
+        info.dimmingCurve.reset(m->modelDimmingCurve->clone());
+    }
+    info.transparency = m->GetTransparency();
+    info.blackTransparency = m->GetBlackTransparency();
+    info.strobe = m->GetStrobeRate() != 0;
+    uint32_t modelIndex = _models.size();
+    _models.push_back(std::move(info));
+
+    SpriteShape shape = SpriteShape::SMOOTH;
+    switch (m->GetPixelStyle()) {
+    case Model::PIXEL_STYLE::PIXEL_STYLE_SQUARE:
+        shape = SpriteShape::SQUARE;
+        break;
+    case Model::PIXEL_STYLE::PIXEL_STYLE_SOLID_CIRCLE:
+        shape = SpriteShape::SOLID_CIRCLE;
+        break;
+    case Model::PIXEL_STYLE::PIXEL_STYLE_BLENDED_CIRCLE:
+        shape = SpriteShape::BLENDED_CIRCLE;
+        break;
+    default:
+        break;
+    }
+    bool circle = shape == SpriteShape::SOLID_CIRCLE || shape == SpriteShape::BLENDED_CIRCLE;
+
+    // points are sized in screen pixels, circles are built in model space (see Model::DisplayModelOnWindow)
+    float pointSize = std::max(1.0f, (float)m->GetPixelSize() * pointScale);
+    float circleRadius = 0.0f;
+    if (circle) {
+        float x1 = -1, y1 = -1, z1 = -1;
+        float x2 = 1, y2 = 1, z2 = 1;
+        location.TranslatePoint(x1, y1, z1);
+        location.TranslatePoint(x2, y2, z2);
+        float length = std::max(std::max(x2 - x1, y2 - y1), z2 - z1);
+        circleRadius = length == 0.0f ? 0.0f : pointSize / std::abs(length) / 2.0f;
+    }
+
+    std::vector<std::tuple<float, float, float>> coords;
+    uint32_t nodeCount = m->GetNodeCount();
+    for (uint32_t n = 0; n < nodeCount; ++n) {
+        const NodeBaseClass* node = m->GetNode(n);
+        if (node == nullptr || !node->IsVisible()) continue;
+
+        NodeSource source;
+        source.startChannel = m->NodeStartChannel(n);
+        source.model = modelIndex;
+        source.other = -1;
+        source.offsets[0] = source.offsets[1] = source.offsets[2] = 0;
+        if (typeid(*node) == typeid(NodeBaseClass) && node->GetChanCount() == 3) {
+            const uint8_t* offsets = node->GetChannelOffsets();
+            source.offsets[0] = offsets[0];
+            source.offsets[1] = offsets[1];
+            source.offsets[2] = offsets[2];
+        } else {
+            source.other = _otherNodes.size();
+            _otherNodes.emplace_back(node->clone());
+        }
+        uint32_t nodeIndex = _nodes.size();
+        _nodes.push_back(source);
+
+        coords.clear();
+        m->GetNode3DScreenCoords(n, coords);
+        for (const auto& c : coords) {
+            float x = std::get<0>(c);
+            float y = std::get<1>(c);
+            float z = std::get<2>(c);
+            float wx = x, wy = y, wz = z;
+            location.TranslatePoint(wx, wy, wz);
+
+            float sx, sy, depth, pixelsPerUnit;
+            if (!Project(wx, wy, wz, sx, sy, depth, pixelsPerUnit)) continue;
+
+            float size = pointSize;
+            if (circle) {
+                float ex = x + circleRadius, ey = y, ez = z;
+                location.TranslatePoint(ex, ey, ez);
+                float dz = _is3d ? ez - wz : 0.0f;
+                float worldRadius = std::sqrt((ex - wx) * (ex - wx) + (ey - wy) * (ey - wy) + dz * dz);
+                size = std::max(1.0f, 2.0f * worldRadius * pixelsPerUnit);
+            }
+
+            float r = size / 2.0f + 1.0f;
+            if (sx + r < 0 || sy + r < 0 || sx - r > _width || sy - r > _height) continue;
+
+            _sprites.push_back({ sx, sy, depth, size, nodeIndex, shape });
+        }
+    }
+}
+
+void PreviewRasterizer::DrawBackground(const Settings& settings)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (settings.backgroundImage.empty() || !FileExists(settings.backgroundImage)) return;
+
+    logger_base.debug("PreviewRasterizer: Loading background image file %s.", (const char*)settings.backgroundImage.c_str());
+    wxImage image(settings.backgroundImage);
+    if (!image.IsOk() || image.GetWidth() == 0 || image.GetHeight() == 0) {
+        logger_base.debug("    Failed.");
+        return;
+    }
+
+    // placement and aspect handling as ModelPreview::StartDrawing
+    int virtualWidth = settings.virtualWidth;
+    int virtualHeight = settings.virtualHeight;
+    float scaleh = 1.0;
+    float scalew = 1.0;
+    if (!settings.scaleBackgroundImage) {
+        float nscaleh = 1.0;
+        if (virtualHeight != 0) nscaleh = float(image.GetHeight()) / float(virtualHeight);
+        if (nscaleh == 0) nscaleh = 1.0;
+        float nscalew = 1.0;
+        if (virtualWidth != 0) nscalew = float(image.GetWidth()) / float(virtualWidth);
+        if (nscalew == 0) nscalew = 1.0;
+        if (nscalew < nscaleh) {
+            scaleh = 1.0;
+            scalew = nscalew / nscaleh;
+        } else {
+            scaleh = nscaleh / nscalew;
+            scalew = 1.0;
+        }
+    }
+    float x = 0;
+    if (settings.center2D0) {
+        x = -virtualWidth;
+        x /= 2.0f;
+    }
+
+    float left, top, right, bottom, depth, ppu;
+    Project(x, virtualHeight * scaleh, 0, left, top, depth, ppu);
+    Project(x + virtualWidth * scalew, 0, 0, right, bottom, depth, ppu);
+    if (right <= left || bottom <= top) return;
+
+    int x0 = std::max(0, (int)std::floor(left));
+    int x1 = std::min(_width, (int)std::ceil(right));
+    int y0 = std::max(0, (int)std::floor(top));
+    int y1 = std::min(_height, (int)std::ceil(bottom));
+
+    const int iw = image.GetWidth();
+    const int ih = image.GetHeight();
+    const unsigned char* pixels = image.GetData();
+    const unsigned char* alpha = image.HasAlpha() ? image.GetAlpha() : nullptr;
+    const float brightness = settings.backgroundBrightness / 100.0f;
+    const float opacity = settings.backgroundAlpha / 100.0f;
+    const float du = (float)iw / (right - left);
+    const float dv = (float)ih / (bottom - top);
+
+    // bilinear filtered to match the smoothed texture, composited over the black clear colour
+    parallel_for(y0, y1, [&](int y) {
+        float v = ((float)y + 0.5f - top) * dv - 0.5f;
+        int v0 = std::clamp((int)std::floor(v), 0, ih - 1);
+        int v1 = std::min(v0 + 1, ih - 1);
+        float fv = std::clamp(v - (float)v0, 0.0f, 1.0f);
+        uint8_t* out = &_backdrop[((size_t)y * _width + x0) * 3];
+        for (int px = x0; px < x1; ++px, out += 3) {
+            float u = ((float)px + 0.5f - left) * du - 0.5f;
+            int u0 = std::clamp((int)std::floor(u), 0, iw - 1);
+            int u1 = std::min(u0 + 1, iw - 1);
+            float fu = std::clamp(u - (float)u0, 0.0f, 1.0f);
+            float w00 = (1.0f - fu) * (1.0f - fv);
+            float w10 = fu * (1.0f - fv);
+            float w01 = (1.0f - fu) * fv;
+            float w11 = fu * fv;
+            size_t i00 = (size_t)v0 * iw + u0;
+            size_t i10 = (size_t)v0 * iw + u1;
+            size_t i01 = (size_t)v1 * iw + u0;
+            size_t i11 = (size_t)v1 * iw + u1;
+            float a = opacity;
+            if (alpha != nullptr) {
+                a *= (alpha[i00] * w00 + alpha[i10] * w10 + alpha[i01] * w01 + alpha[i11] * w11) / 255.0f;
+            }
+            for (int c = 0; c < 3; ++c) {
+                float s = pixels[i00 * 3 + c] * w00 + pixels[i10 * 3 + c] * w10 + pixels[i01 * 3 + c] * w01 + pixels[i11 * 3 + c] * w11;
+                out[c] = (uint8_t)std::min(255.0f, s * brightness * a + 0.5f);
+            }
+        }
+    }, 16);
+    logger_base.debug("    Loaded.");
+}
+
+void PreviewRasterizer::DrawMesh(MeshObject* mesh)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (!mesh->IsActive() || !FileExists(mesh->GetObjFile())) return;
+
+    logger_base.debug("PreviewRasterizer: Loading mesh object '%s' file '%s'.",
+                      (const char*)mesh->GetName().c_str(), (const char*)mesh->GetObjFile().c_str());
+
+    // shared with the layout's own meshes so each file is parsed once per process
+    auto meshData = xlMeshCache::Instance().GetMesh(mesh->GetObjFile());
+    if (meshData == nullptr) {
+        return;
+    }
+
+    auto& location = mesh->GetObjectScreenLocation();
+    location.PrepareToDraw(true, false);
+    glm::vec3 scale = location.GetScaleMatrix();
+    glm::vec3 rotations = location.GetRotation();
+    glm::mat4 modelMatrix = glm::translate(glm::mat4(1.0f), glm::vec3(location.GetHcenterPos(), location.GetVcenterPos(), location.GetDcenterPos()));
+    modelMatrix = glm::rotate(modelMatrix, glm::radians(rotations.z), glm::vec3(0.0f, 0.0f, 1.0f));
+    modelMatrix = glm::rotate(modelMatrix, glm::radians(rotations.y), glm::vec3(0.0f, 1.0f, 0.0f));
+    modelMatrix = glm::rotate(modelMatrix, glm::radians(rotations.x), glm::vec3(1.0f, 0.0f, 0.0f));
+    modelMatrix = glm::scale(modelMatrix, scale);
+    glm::mat4 mvp = _proj * _view * modelMatrix;
+
+    // flat material colours, textures aren't sampled
+    float brightness = mesh->GetBrightness() / 100.0f;
+    std::vector<xlColor> colors;
+    for (const auto& m : meshData->GetMaterials()) {
+        colors.push_back(xlColor((uint8_t)std::min(255.0f, m.diffuse[0] * 255.0f * brightness),
+                                 (uint8_t)std::min(255.0f, m.diffuse[1] * 255.0f * brightness),
+                                 (uint8_t)std::min(255.0f, m.diffuse[2] * 255.0f * brightness),
+                                 (uint8_t)std::clamp(m.dissolve * 255.0f, 0.0f, 255.0f)));
+    }
+    xlColor defaultColor = MESH_DEFAULT_COLOR;
+    defaultColor.red *= brightness;
+    defaultColor.green *= brightness;
+    defaultColor.blue *= brightness;
+
+    // screen x, y, ndc z of every vertex ... w <= near plane flags it as unusable
+    const auto& vertices = meshData->GetAttrib().vertices;
+    size_t vertexCount = vertices.size() / 3;
+    std::vector<glm::vec4> screen(vertexCount);
+    for (size_t i = 0; i < vertexCount; ++i) {
+        glm::vec4 clip = mvp * glm::vec4(vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2], 1.0f);
+        if (clip.w < 1.0f) {
+            screen[i] = glm::vec4(0.0f, 0.0f, 0.0f, -1.0f);
+        } else {
+            screen[i] = glm::vec4((clip.x / clip.w + 1.0f) * 0.5f * (float)_width,
+                                  (1.0f - clip.y / clip.w) * 0.5f * (float)_height,
+                                  clip.z / clip.w, 1.0f);
+        }
+    }
+
+    auto fillTriangle = [this](const glm::vec4& a, const glm::vec4& b, const glm::vec4& c, const xlColor& color, bool opaque) {
+        float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+        if (area == 0.0f) return;
+        int x0 = std::max(0, (int)std::floor(std::min({ a.x, b.x, c.x })));
+        int x1 = std::min(_width - 1, (int)std::ceil(std::max({ a.x, b.x, c.x })));
+        int y0 = std::max(0, (int)std::floor(std::min({ a.y, b.y, c.y })));
+        int y1 = std::min(_height - 1, (int)std::ceil(std::max({ a.y, b.y, c.y })));
+        for (int y = y0; y <= y1; ++y) {
+            float py = (float)y + 0.5f;
+            for (int x = x0; x <= x1; ++x) {
+                float px = (float)x + 0.5f;
+                float w0 = ((b.x - px) * (c.y - py) - (b.y - py) * (c.x - px)) / area;
+                float w1 = ((c.x - px) * (a.y - py) - (c.y - py) * (a.x - px)) / area;
+                float w2 = 1.0f - w0 - w1;
+                if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f) continue;
+                float z = w0 * a.z + w1 * b.z + w2 * c.z;
+                size_t idx = (size_t)y * _width + x;
+                if (z < -1.0f || z >= _depth[idx]) continue;
+                if (opaque) {
+                    _depth[idx] = z;
+                    BlendPixel(&_backdrop[idx * 3], color, 255);
+                } else {
+                    BlendPixel(&_backdrop[idx * 3], color, color.alpha);
+                }
+            }
+        }
+    };
+    auto drawLine = [this](const glm::vec4& a, const glm::vec4& b, const xlColor& color) {
+        int steps = (int)std::ceil(std::max(std::abs(b.x - a.x), std::abs(b.y - a.y)));
+        steps = std::max(steps, 1);
+        for (int i = 0; i <= steps; ++i) {
+            float t = (float)i / (float)steps;
+            int x = (int)(a.x + (b.x - a.x) * t);
+            int y = (int)(a.y + (b.y - a.y) * t);
+            if (x < 0 || y < 0 || x >= _width || y >= _height) continue;
+            float z = a.z + (b.z - a.z) * t;
+            size_t idx = (size_t)y * _width + x;
+            if (z < -1.0f || z > _depth[idx]) continue;
+            _depth[idx] = z;
+            BlendPixel(&_backdrop[idx * 3], color, 255);
+        }
+    };
+
+    // opaque faces first so translucent ones blend over whatever they are in front of
+    for (int pass = 0; pass < 2; ++pass) {
+        for (const auto& shape : meshData->GetShapes()) {
+            const auto& indices = shape.mesh.indices;
+            for (size_t f = 0; f + 2 < indices.size(); f += 3) {
+                int mat = f / 3 < shape.mesh.material_ids.size() ? shape.mesh.material_ids[f / 3] : -1;
+                const xlColor& color = (mat >= 0 && mat < (int)colors.size()) ? colors[mat] : defaultColor;
+                bool opaque = mesh->IsMeshOnly() || color.alpha == 255;
+                if (opaque != (pass == 0)) continue;
+
+                const glm::vec4& a = screen[indices[f].vertex_index];
+                const glm::vec4& b = screen[indices[f + 1].vertex_index];
+                const glm::vec4& c = screen[indices[f + 2].vertex_index];
+                // faces crossing the near plane are dropped rather than clipped
+                if (a.w < 0.0f || b.w < 0.0f || c.w < 0.0f) continue;
+
+                if (mesh->IsMeshOnly()) {
+                    drawLine(a, b, color);
+                    drawLine(b, c, color);
+                    drawLine(c, a, color);
+                } else {
+                    fillTriangle(a, b, c, color, opaque);
+                }
+            }
+        }
+    }
+}
+
+inline void PreviewRasterizer::BlendPixel(uint8_t* p, const xlColor& c, int alpha) const
+{
+    if (alpha >= 255) {
+        p[0] = c.red;
+        p[1] = c.green;
+        p[2] = c.blue;
+    } else if (alpha > 0) {
+        int ia = 255 - alpha;
+        p[0] = (c.red * alpha + p[0] * ia + 127) / 255;
+        p[1] = (c.green * alpha + p[1] * ia + 127) / 255;
+        p[2] = (c.blue * alpha + p[2] * ia + 127) / 255;
+    }
+}
+
+void PreviewRasterizer::DrawSprite(const Sprite& s, const xlColor& c, uint8_t* rgb, int stride) const
+{
+    if (c.alpha == 0) return;
+
+    const bool depthTest = !_depth.empty();
+    if (s.size <= 1.0f || s.shape == SpriteShape::SQUARE) {
+        // as GL points, the pixels whose centres fall in the square
+        int size = std::max(1, (int)(s.size + 0.5f));
+        int x0 = (int)std::floor(s.x - size * 0.5f + 0.5f);
+        int y0 = (int)std::floor(s.y - size * 0.5f + 0.5f);
+        int x1 = std::min(x0 + size, _width);
+        int y1 = std::min(y0 + size, _height);
+        x0 = std::max(x0, 0);
+        y0 = std::max(y0, 0);
+        for (int y = y0; y < y1; ++y) {
+            uint8_t* p = rgb + (size_t)y * stride + x0 * 3;
+            for (int x = x0; x < x1; ++x, p += 3) {
+                if (depthTest && s.depth >= _depth[(size_t)y * _width + x]) continue;
+                BlendPixel(p, c, c.alpha);
+            }
+        }
+        return;
+    }
+
+    float r = s.size / 2.0f;
+    int x0 = std::max(0, (int)std::floor(s.x - r - 0.5f));
+    int y0 = std::max(0, (int)std::floor(s.y - r - 0.5f));
+    int x1 = std::min(_width - 1, (int)std::ceil(s.x + r + 0.5f));
+    int y1 = std::min(_height - 1, (int)std::ceil(s.y + r + 0.5f));
+    for (int y = y0; y <= y1; ++y) {
+        float dy = (float)y + 0.5f - s.y;
+        uint8_t* p = rgb + (size_t)y * stride + x0 * 3;
+        for (int x = x0; x <= x1; ++x, p += 3) {
+            float dx = (float)x + 0.5f - s.x;
+            float d = std::sqrt(dx * dx + dy * dy);
+            float coverage;
+            switch (s.shape) {
+            case SpriteShape::SOLID_CIRCLE:
+                coverage = d <= r ? 1.0f : 0.0f;
+                break;
+            case SpriteShape::BLENDED_CIRCLE:
+                // centre colour fading to fully transparent at the edge
+                coverage = std::max(0.0f, 1.0f - d / r);
+                break;
+            default:
+                // smooth points, antialiased edge
+                coverage = std::clamp(r + 0.5f - d, 0.0f, 1.0f);
+                break;
+            }
+            if (coverage <= 0.0f) continue;
+            if (depthTest && s.depth >= _depth[(size_t)y * _width + x]) continue;
+            BlendPixel(p, c, (int)(c.alpha * coverage + 0.5f));
+        }
+    }
+}
+
+std::unique_ptr<PreviewRasterizer::Workspace> PreviewRasterizer::CreateWorkspace() const
+{
+    std::unique_ptr<Workspace> ws = std::make_unique<Workspace>();
+    for (const auto& n : _otherNodes) {
+        ws->otherNodes.emplace_back(n->clone());
+    }
+    ws->colors.resize(_nodes.size());
+    return ws;
+}
+
+void PreviewRasterizer::RenderFrame(const uint8_t* data, size_t channels, uint32_t frameIndex, Workspace& workspace, uint8_t* rgb, int stride) const
+{
+    // node colours as ModelPreview::Render + Model::DisplayModelOnWindow
+    size_t nodeCount = _nodes.size();
+    for (size_t i = 0; i < nodeCount; ++i) {
+        const NodeSource& source = _nodes[i];
+        xlColor color = xlBLACK;
+        if (source.other < 0) {
+            if (source.startChannel + 3 <= channels) {
+                const uint8_t* d = data + source.startChannel;
+                color.Set(d[source.offsets[0]], d[source.offsets[1]], d[source.offsets[2]]);
+            }
+        } else {
+            NodeBaseClass* node = workspace.otherNodes[source.other].get();
+            if (source.startChannel + node->GetChanCount() <= channels) {
+                node->SetFromChannels(data + source.startChannel);
+                node->GetColor(color);
+            }
+        }
+        const ModelInfo& info = _models[source.model];
+        if (info.dimmingCurve != nullptr) {
+            info.dimmingCurve->reverse(color);
+        }
+        if (info.strobe) {
+            // the preview uses rand() ... hash instead so frames rendered on any thread agree
+            uint32_t h = (uint32_t)i * 2654435761u ^ (frameIndex + 1) * 2246822519u;
+            h ^= h >> 15;
+            h *= 2246822519u;
+            h ^= h >> 13;
+            if (h % 5 != 0) {
+                color = xlBLACK;
+            }
+        }
+        Model::ApplyTransparency(color, info.transparency, info.blackTransparency);
+        workspace.colors[i] = color;
+    }
+
+    const size_t rowBytes = (size_t)_width * 3;
+    for (int y = 0; y < _height; ++y) {
+        memcpy(rgb + (size_t)y * stride, &_backdrop[y * rowBytes], rowBytes);
+    }
+    for (const auto& s : _sprites) {
+        DrawSprite(s, workspace.colors[s.node], rgb, stride);
+    }
+}
+
+bool PreviewRasterizer::ExportVideo(const SequenceData& seqData, AudioManager* audio, const std::string& path,
+                                    const std::string& codec, int bitrate, std::string& error) const
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    const int frameCount = seqData.NumFrames();
+    if (frameCount == 0 || seqData.FrameTime() == 0) {
+        error = "No frames to export.";
+        return false;
+    }
+
+    int audioSampleRate = 0;
+    if (audio != nullptr) {
+        if (audio->GetChannels() != 2 && audio->GetChannels() != 1) {
+            error = "Audio must be mono or stereo.";
+            return false;
+        }
+        audioSampleRate = audio->GetRate();
+    }
+
+    // frames are rendered a batch at a time across the render threads, the next batch
+    // rendering while the encoder works through the previous one
+    const size_t frameBytes = (size_t)_width * 3 * _height;
+    int batchSize = std::max(2, ParallelJobPool::POOL.maxSize() * 2);
+    batchSize = std::max(1, std::min(batchSize, (int)(PREVIEW_EXPORT_BATCH_BYTES / 2 / std::max(frameBytes, (size_t)1))));
+    batchSize = std::min(batchSize, frameCount);
+
+    struct Batch
+    {
+        int start = 0;
+        int count = 0;
+        std::vector<uint8_t> pixels;
+        std::vector<std::unique_ptr<Workspace>> workspaces;
+        std::future<void> done;
+
+        void Wait()
+        {
+            if (done.valid()) {
+                done.wait();
+            }
+        }
+        bool Contains(int frame) const
+        {
+            return frame >= start && frame < start + count;
+        }
+    };
+    Batch batches[2];
+    for (auto& b : batches) {
+        b.pixels.resize(frameBytes * batchSize);
+        for (int i = 0; i < batchSize; ++i) {
+            b.workspaces.push_back(CreateWorkspace());
+        }
+    }
+
+    auto startBatch = [&](Batch& b, int start) {
+        b.Wait();
+        if (b.count > 0) {
+            seqData.ReleaseFrames(b.start, b.start + b.count);
+        }
+        b.start = start;
+        b.count = std::max(0, std::min(batchSize, frameCount - start));
+        if (b.count == 0) return;
+        seqData.PrefetchFrames(start, start + b.count);
+        b.done = std::async(std::launch::async, [this, &seqData, &b, frameBytes]() {
+            parallel_for(0, b.count, [&](int i) {
+                uint32_t frame = b.start + i;
+                RenderFrame(seqData[frame][0], seqData.NumChannels(), frame, *b.workspaces[i], &b.pixels[frameBytes * i], _width * 3);
+            });
+        });
+    };
+    int current = 0;
+    startBatch(batches[0], 0);
+    startBatch(batches[1], batchSize);
+
+    bool status = true;
+    try {
+        GenericVideoExporter::Params params = { AV_PIX_FMT_RGB24, _width, _height, (int)(1000u / seqData.FrameTime()), audioSampleRate, codec, bitrate };
+        GenericVideoExporter exporter(path, params, audio == nullptr);
+
+        int audioFrameIndex = 0;
+        if (audio != nullptr) {
+            exporter.setGetAudioCallback([audio, &audioFrameIndex](float* leftCh, float* rightCh, int frameSize) {
+                int trackSize = audio->GetTrackSize();
+                int clampedSize = std::min(frameSize, trackSize - audioFrameIndex);
+                if (clampedSize > 0) {
+                    const float* leftptr = audio->GetRawLeftDataPtr(audioFrameIndex);
+                    const float* rightptr = audio->GetRawRightDataPtr(audioFrameIndex);
+                    if (leftptr != nullptr) {
+                        std::memcpy(leftCh, leftptr, clampedSize * sizeof(float));
+                        std::memcpy(rightCh, rightptr, clampedSize * sizeof(float));
+                        audioFrameIndex += frameSize;
+                    }
+                }
+                return true;
+            });
+        }
+
+        exporter.setGetVideoCallback([&](AVFrame* f, uint8_t* buf, int bufSize, unsigned frameIndex) {
+            if ((int)frameIndex >= frameCount) {
+                return false;
+            }
+            if (!batches[current].Contains(frameIndex)) {
+                // done with this batch, move on to the one rendering behind it and reuse this one for the next
+                current = 1 - current;
+                if (!batches[current].Contains(frameIndex)) {
+                    // not asked for in order, render from here
+                    startBatch(batches[current], frameIndex);
+                }
+                startBatch(batches[1 - current], batches[current].start + batches[current].count);
+            }
+            Batch& b = batches[current];
+            b.Wait();
+
+            int outHeight = exporter.outputParams().height;
+            int stride = outHeight == 0 ? 0 : bufSize / outHeight;
+            const uint8_t* src = &b.pixels[frameBytes * (frameIndex - b.start)];
+            for (int y = 0; y < _height && y < outHeight; ++y) {
+                memcpy(buf + (size_t)y * stride, src + (size_t)y * _width * 3, std::min(stride, _width * 3));
+            }
+            return true;
+        });
+
+        int lastReported = -1;
+        exporter.setProgressReportCallback([&lastReported](int value) {
+            if (value / 10 != lastReported / 10) {
+                logger_base.info("PreviewRasterizer: Exporting video %d%%.", value);
+                lastReported = value;
+            }
+        });
+
+        exporter.initialize();
+        logger_base.info("PreviewRasterizer: Exporting %d frames at %d x %d to %s.", frameCount, _width, _height, (const char*)path.c_str());
+        exporter.exportFrames(frameCount);
+        exporter.completeExport();
+    } catch (const std::runtime_error& re) {
+        error = re.what();
+        logger_base.error("PreviewRasterizer: Error exporting video : %s", (const char*)re.what());
+        status = false;
+    }
+
+    // don't leave a render running against buffers about to go away
+    for (auto& b : batches) {
+        b.Wait();
+        if (b.count > 0) {
+            seqData.ReleaseFrames(b.start, b.start + b.count);
+        }
+    }
+    return status;
+}
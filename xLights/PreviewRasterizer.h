@@ -0,0 +1,146 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+
+#include "Color.h"
+
+class AudioManager;
+class DimmingCurve;
+class MeshObject;
+class Model;
+class NodeBaseClass;
+class PreviewCamera;
+class SequenceData;
+
+// CPU only rasteriser for the house preview.
+// Everything that doesn't change from frame to frame ... node positions and sizes projected
+// through the preview camera, the background image and any 3D mesh objects ... is worked out
+// once when it is constructed. Rendering a frame is then decoding the node colours from the
+// sequence data and splatting each node into a copy of that static backdrop, which needs no
+// graphics context and can be done for many frames at once on different threads.
+class PreviewRasterizer
+{
+public:
+    struct Settings
+    {
+        int width = 0;                  // output size in pixels
+        int height = 0;
+        bool is3d = false;
+        int virtualWidth = 0;           // 2D preview canvas size
+        int virtualHeight = 0;
+        bool center2D0 = false;
+        std::string backgroundImage;    // 2D only
+        bool scaleBackgroundImage = false;
+        int backgroundBrightness = 100;
+        int backgroundAlpha = 100;
+        const PreviewCamera* camera = nullptr; // nullptr for the default view
+    };
+
+    // Per thread scratch state. Each thread rendering frames at the same time needs its own.
+    class Workspace
+    {
+    public:
+        ~Workspace();
+
+    private:
+        friend class PreviewRasterizer;
+        std::vector<std::unique_ptr<NodeBaseClass>> otherNodes;
+        std::vector<xlColor> colors;
+    };
+
+    // Reads model and object state so must be called on the main thread. The models and
+    // objects are not referenced once this returns.
+    PreviewRasterizer(const Settings& settings, const std::vector<Model*>& models, const std::vector<MeshObject*>& meshes);
+    virtual ~PreviewRasterizer();
+
+    int GetWidth() const { return _width; }
+    int GetHeight() const { return _height; }
+    size_t GetSpriteCount() const { return _sprites.size(); }
+
+    std::unique_ptr<Workspace> CreateWorkspace() const;
+
+    // Renders one frame of channel data as packed RGB24 rows stride bytes apart.
+    // Safe to call from multiple threads as long as each uses its own workspace.
+    void RenderFrame(const uint8_t* data, size_t channels, uint32_t frameIndex, Workspace& workspace, uint8_t* rgb, int stride) const;
+
+    // Renders every frame of the sequence data and encodes them with the audio (if any) to a
+    // video file. Frames are rendered in parallel batches while the previous batch encodes.
+    // Returns false and sets error if the export fails.
+    bool ExportVideo(const SequenceData& seqData, AudioManager* audio, const std::string& path,
+                     const std::string& codec, int bitrate, std::string& error) const;
+
+private:
+    enum class SpriteShape : uint8_t
+    {
+        SQUARE,
+        SMOOTH,
+        SOLID_CIRCLE,
+        BLENDED_CIRCLE
+    };
+
+    struct ModelInfo
+    {
+        std::unique_ptr<DimmingCurve> dimmingCurve;     // a copy as the model may be reloaded while exporting
+        int transparency = 0;
+        int blackTransparency = 0;
+        bool strobe = false;
+    };
+
+    // where a node's colour comes from in the frame data
+    struct NodeSource
+    {
+        uint32_t startChannel;
+        uint8_t offsets[3];     // plain RGB nodes, the frame offset of red/green/blue
+        int32_t other;          // index of the node prototype for other node types, -1 for plain RGB
+        uint32_t model;
+    };
+
+    struct Sprite
+    {
+        float x;
+        float y;
+        float depth;            // NDC depth in 3D, 0 in 2D
+        float size;             // diameter in output pixels
+        uint32_t node;
+        SpriteShape shape;
+    };
+
+    void SetupView(const Settings& settings);
+    bool Project(float wx, float wy, float wz, float& sx, float& sy, float& depth, float& pixelsPerUnit) const;
+    void AddModel(Model* m, float pointScale);
+    void DrawBackground(const Settings& settings);
+    void DrawMesh(MeshObject* mesh);
+    void DrawSprite(const Sprite& s, const xlColor& c, uint8_t* rgb, int stride) const;
+    void BlendPixel(uint8_t* p, const xlColor& c, int alpha) const;
+
+    int _width = 0;
+    int _height = 0;
+    bool _is3d = false;
+    glm::mat4 _view;
+    glm::mat4 _proj;
+    float _pixelsPerUnit2D = 1.0f;
+    float _focal = 1.0f;
+
+    std::vector<ModelInfo> _models;
+    std::vector<NodeSource> _nodes;
+    std::vector<std::unique_ptr<NodeBaseClass>> _otherNodes;
+    std::vector<Sprite> _sprites;
+
+    std::vector<uint8_t> _backdrop;     // RGB24, width * 3 per row
+    std::vector<float> _depth;          // 3D only, depth of opaque meshes per pixel
+};
@@ -0,0 +1,64 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <algorithm>
+
+#include "RemapTable.h"
+#include "RenderBuffer.h"
+#include "Parallel.h"
+
+// below this many pixels a single thread beats the cost of handing rows to the pool
+#define REMAP_PARALLEL_PIXELS 4096
+
+void RemapTable::Reset(int width, int height, const std::vector<double>& key, bool identity)
+{
+    _width = width;
+    _height = height;
+    _key = key;
+    size_t count = (size_t)std::max(width, 0) * (size_t)std::max(height, 0);
+    _sources.resize(count);
+    if (identity) {
+        for (size_t i = 0; i < count; ++i) {
+            _sources[i] = (int32_t)i;
+        }
+    } else {
+        std::fill(_sources.begin(), _sources.end(), FILL);
+    }
+}
+
+void RemapTable::Apply(xlColor* pixels, size_t count, const xlColor& fill) const
+{
+    count = std::min(count, _sources.size());
+    if (count == 0 || _width <= 0) return;
+
+    // gather from a copy as destinations overwrite pixels other destinations still need
+    std::vector<xlColor> orig(pixels, pixels + count);
+    int rows = (int)((count + _width - 1) / _width);
+    auto remapRow = [this, pixels, count, &orig, &fill](int y) {
+        size_t start = (size_t)y * _width;
+        size_t end = std::min(start + _width, count);
+        for (size_t i = start; i < end; ++i) {
+            int32_t s = _sources[i];
+            pixels[i] = (s >= 0 && (size_t)s < count) ? orig[s] : fill;
+        }
+    };
+    if (count < REMAP_PARALLEL_PIXELS) {
+        for (int y = 0; y < rows; ++y) {
+            remapRow(y);
+        }
+    } else {
+        parallel_for(0, rows, remapRow, std::max(1, REMAP_PARALLEL_PIXELS / _width));
+    }
+}
+
+void RemapTable::Apply(RenderBuffer& buffer, const xlColor& fill) const
+{
+    Apply(buffer.GetPixels(), buffer.GetPixelCount(), fill);
+}
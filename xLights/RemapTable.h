@@ -0,0 +1,56 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Color.h"
+
+class RenderBuffer;
+
+// Precomputed coordinate remap for transforms that only move pixels around the buffer.
+// Each destination pixel holds the index of the source pixel it takes its colour from
+// (or FILL) so once built the transform is a single gather pass with no per pixel trig.
+// Tables remember the buffer size and the parameters that produced them so static or
+// slowly varying settings only pay for the geometry when something actually changes.
+class RemapTable
+{
+public:
+    static constexpr int32_t FILL = -1;
+
+    bool IsValid(int width, int height, const std::vector<double>& key) const
+    {
+        return _width == width && _height == height && _key == key;
+    }
+    void Invalidate() { _width = -1; _height = -1; _key.clear(); }
+
+    // Start a new table. Every destination maps to FILL or, if identity, to itself.
+    void Reset(int width, int height, const std::vector<double>& key, bool identity = false);
+
+    int GetWidth() const { return _width; }
+    int GetHeight() const { return _height; }
+    int32_t Get(size_t dest) const { return _sources[dest]; }
+    void Set(size_t dest, int32_t source) { _sources[dest] = source; }
+    void Set(int x, int y, int32_t source) { _sources[y * _width + x] = source; }
+
+    // Remaps the pixels in place. FILL destinations and sources outside the pixel
+    // array get the fill colour.
+    void Apply(xlColor* pixels, size_t count, const xlColor& fill) const;
+    void Apply(RenderBuffer& buffer, const xlColor& fill) const;
+
+private:
+    int _width = -1;
+    int _height = -1;
+    std::vector<double> _key;
+    std::vector<int32_t> _sources;
+};
@@ -34,6 +34,22 @@
 //other common strings
 static const std::string STR_EMPTY("");
 
+// Stateful effects save their simulation state this often so a render can resume part way through them
+#define CHECKPOINT_INTERVAL_MS 5000
+
+static int GetCheckpointInterval(int frameTimeMS) {
+    return std::max(1, CHECKPOINT_INTERVAL_MS / std::max(1, frameTimeMS));
+}
+
+// checkpoints are taken after rendering the last frame of each interval so all effects on a model share resume points
+static bool IsCheckpointFrame(int period, int frameTimeMS) {
+    return (period + 1) % GetCheckpointInterval(frameTimeMS) == 0;
+}
+
+static std::string GetCheckpointKey(const std::string& modelName, int bufn) {
+    return modelName + "|" + std::to_string(bufn);
+}
+
 class EffectLayerInfo {
 public:
     EffectLayerInfo(): element(nullptr)
@@ -247,7 +263,8 @@ public:
                             static const std::string DEFAULT("Default");
                             static const std::string PER_MODEL("Per Model");
                             static const std::string DEEP("Deep");
-                            const std::string& bt = layer->GetEffect(e)->GetSettings().Get(CHOICE_BufferStyle, DEFAULT);
+                            const Effect* eff = layer->GetEffect(e);
+                            const std::string& bt = eff->GetSettings().Get(CHOICE_BufferStyle, DEFAULT);
                             if (bt.compare(0, 9, PER_MODEL) == 0) {
                                 if (bt.compare(bt.length() - 4, 4, DEEP) == 0) {
                                     perModelEffectsDeep = true;
@@ -434,7 +451,7 @@ public:
 
     wxString GetStatusForUser()
     {
-        int lastIdx = 0;
+        int lastIdx = -1;
         Effect* effect = findEffectForFrame(this->statusLayer, GetCurrentFrame(), lastIdx);
 
         if (effect != nullptr)
@@ -543,11 +560,12 @@ public:
             info.validLayers[x] = false;
         }
 
-        // To support canvas mix type we must render them bottom to top
+        // Set up every layer before rendering any of them so the buffer knows how all the layers
+        // are configured (canvas, transitions etc) when deciding whether effects can render sparsely
         for (int layer = numLayers - 1; layer >= 0; --layer) {
             EffectLayer* elayer = el->GetEffectLayer(layer);
-            //must lock the layer so the Effect* stays valid
-            std::unique_lock<std::recursive_mutex> elayerLock(elayer->GetLock());
+            // the layer snapshot keeps the Effect* valid without holding the layer lock ... edits mark the
+            // range dirty and that gets re-rendered against the next snapshot
             Effect* ef = findEffectForFrame(elayer, frame, info.currentEffectIdxs[layer]);
             if (ef != info.currentEffects[layer]) {
                 info.currentEffects[layer] = ef;
@@ -555,6 +573,11 @@ public:
                 initialize(layer, frame, ef, info.settingsMaps[layer], buffer);
                 info.effectStates[layer] = true;
             }
+        }
+
+        // To support canvas mix type we must render them bottom to top
+        for (int layer = numLayers - 1; layer >= 0; --layer) {
+            Effect* ef = info.currentEffects[layer];
 
             if (buffer->IsVariableSubBuffer(layer)) {
                 buffer->PrepareVariableSubBuffer(frame, layer);
@@ -702,15 +725,24 @@ public:
         std::map<SNPair, int> nodeEffectIdxs;
 
         try {
-            //for (int layer = 0; layer < numLayers; ++layer) {
-            for (int layer = numLayers - 1; layer >= 0; --layer) {
-                SetGenericStatus("Finding starting effect for %s, startFrame %d, and layer %d ", (int)startFrame, layer, false, true);
-                EffectLayer *elayer = rowToRender->GetEffectLayer(layer);
-                std::unique_lock<std::recursive_mutex> elock(elayer->GetLock());
-                mainModelInfo.currentEffects[layer] = findEffectForFrame(elayer, startFrame, mainModelInfo.currentEffectIdxs[layer]);
-                SetGenericStatus("Initializing starting effect for %s, startFrame %d, and layer %d ", (int)startFrame, layer, false, true);
-                initialize(layer, startFrame, mainModelInfo.currentEffects[layer], mainModelInfo.settingsMaps[layer], mainBuffer);
-                mainModelInfo.effectStates[layer] = true;
+            if (startFrame > 0) {
+                int resumeFrame = findCheckpointResumeFrame(startFrame, true);
+                if (resumeFrame != startFrame) {
+                    renderLog.debug("Model %s resuming render from checkpoint at frame %d rather than %d.", (const char*)name.c_str(), resumeFrame, (int)startFrame);
+                    startFrame = resumeFrame;
+                }
+            }
+            if (!startBuffers(startFrame, mainModelInfo, nodeEffects, nodeSettingsMaps, nodeEffectStates, nodeEffectIdxs)) {
+                // nothing is in progress where the stateful effects start so nothing needs restoring there
+                int resumeFrame = findCheckpointResumeFrame(startFrame, false);
+                renderLog.debug("Model %s could not restore checkpoints at frame %d, rendering from frame %d.", (const char*)name.c_str(), (int)startFrame, resumeFrame);
+                startFrame = resumeFrame;
+                startBuffers(startFrame, mainModelInfo, nodeEffects, nodeSettingsMaps, nodeEffectStates, nodeEffectIdxs);
+            }
+            // the range can have grown past what Render was asked for, from the row's own dirty range or
+            // to resume stateful effects, and re-rendered frames can differ from what was written
+            if (seqData == &xLights->_seqData) {
+                xLights->MarkFseqFramesDirty(startFrame, endFrame);
             }
 
             for (int frame = startFrame; frame <= endFrame; ++frame) {
@@ -767,9 +799,8 @@ public:
                             //deleted node
                             continue;
                         }
-                        std::unique_lock<std::recursive_mutex> nlayerLock(nlayer->GetLock());
                         Effect *el = findEffectForFrame(nlayer, frame, nodeEffectIdxs[node]);
-                        if (el != nodeEffects[node] || frame == startFrame) {
+                        if (el != nodeEffects[node]) {
                             nodeEffects[node] = el;
                             SetInializingStatus(frame, -1, strand, inode);
                             initialize(0, frame, el, nodeSettingsMaps[node], buffer);
@@ -858,22 +889,156 @@ private:
         if (layer == nullptr) {
             return nullptr;
         }
-        int time = frame * seqData->FrameTime();
-        for (int e = lastIdx; e < layer->GetEffectCount(); ++e) {
-            Effect *effect = layer->GetEffect(e);
-            int st = effect->GetStartTimeMS();
-            int et = effect->GetEndTimeMS();
-            if (et > time && st <= time) {
-                return effect;
-            }
-        }
-        return nullptr;
+        return layer->GetSnapshot()->GetEffectForTime(frame * seqData->FrameTime(), lastIdx);
     }
 
     Effect *findEffectForFrame(int layer, int frame, int &lastIdx) {
         return findEffectForFrame(rowToRender->GetEffectLayer(layer), frame, lastIdx);
     }
 
+    // returns the effect if it is a checkpointing effect which started before the frame
+    Effect* inProgressStatefulEffect(Effect* ef, int frame) {
+        if (ef == nullptr || ef->GetEffectIndex() < 0 || ef->IsRenderDisabled()) {
+            return nullptr;
+        }
+        if (ef->GetStartTimeMS() / (int)seqData->FrameTime() >= frame) {
+            return nullptr;
+        }
+        RenderableEffect* reff = xLights->GetEffectManager().GetEffect(ef->GetEffectIndex());
+        if (reff == nullptr || !reff->SupportsStateCheckpoints()) {
+            return nullptr;
+        }
+        return ef;
+    }
+
+    // true if the effect's state at the end of period was captured for every buffer the layer was split into
+    bool hasCompleteCheckpoint(Effect* ef, const std::string& modelName, int period) {
+        int count = ef->GetCheckpointBufferCount(GetCheckpointKey(modelName, 0), period);
+        if (count <= 0) {
+            return false;
+        }
+        for (int bufn = 1; bufn < count; ++bufn) {
+            if (!ef->HasCheckpoint(GetCheckpointKey(modelName, bufn), period)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Stateful effects must be simulated from their start so rendering cannot simply begin part way through them.
+    // Find the latest frame at or before the requested one from which every such effect on this model, its
+    // submodels, strands and nodes can be resumed, either from a saved checkpoint or because it has not started yet.
+    int findCheckpointResumeFrame(int frame, bool useCheckpoints) {
+        std::vector<std::pair<EffectLayer*, std::string>> layers;
+        auto addElement = [&layers](Element* el, PixelBufferClass* buffer) {
+            for (int layer = 0; layer < el->GetEffectLayerCount(); ++layer) {
+                layers.push_back({ el->GetEffectLayer(layer), buffer->GetModelName() });
+            }
+        };
+        addElement(rowToRender, mainBuffer);
+        for (const auto& a : subModelInfos) {
+            addElement(a->element, a->buffer.get());
+        }
+        for (const auto& it : nodeBuffers) {
+            StrandElement* slayer = rowToRender->GetStrand(it.first.strand);
+            EffectLayer* nlayer = slayer == nullptr ? nullptr : slayer->GetNodeLayer(it.first.node, false);
+            if (nlayer != nullptr) {
+                layers.push_back({ nlayer, it.second->GetModelName() });
+            }
+        }
+
+        // returns the start frame of an effect which prevents resuming at frame f, or -1 if there is none
+        auto blockingEffectStart = [this, &layers, useCheckpoints](int f) {
+            for (const auto& it : layers) {
+                int idx = -1;
+                Effect* ef = inProgressStatefulEffect(findEffectForFrame(it.first, f, idx), f);
+                if (ef != nullptr && (!useCheckpoints || !hasCompleteCheckpoint(ef, it.second, f - 1))) {
+                    return ef->GetStartTimeMS() / (int)seqData->FrameTime();
+                }
+            }
+            return -1;
+        };
+
+        // checkpoints are only taken on interval boundaries so step back to the previous boundary
+        // or to the start of the blocking effect, whichever is later
+        int interval = GetCheckpointInterval(seqData->FrameTime());
+        int resume = frame;
+        int start = blockingEffectStart(resume);
+        while (start >= 0) {
+            resume = useCheckpoints ? std::max(start, ((resume - 1) / interval) * interval) : start;
+            start = blockingEffectStart(resume);
+        }
+        return resume;
+    }
+
+    // restore the saved state of a stateful effect into every buffer of the layer so it continues rather than restarts
+    bool restoreCheckpoint(int layer, int frame, Effect* ef, PixelBufferClass* buffer) {
+        int bufCnt = buffer->BufferCountForLayer(layer);
+        if (ef->GetCheckpointBufferCount(GetCheckpointKey(buffer->GetModelName(), 0), frame - 1) != bufCnt) {
+            return false;
+        }
+        for (int bufn = 0; bufn < bufCnt; ++bufn) {
+            RenderBuffer& rb = buffer->BufferForLayer(layer, bufn);
+            if (!ef->RestoreCheckpoint(GetCheckpointKey(buffer->GetModelName(), bufn), frame - 1, rb)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Sets up the effect every layer of every buffer starts on. Stateful effects already in progress at the frame
+    // continue from their checkpoints. If any of them can't, every layer is left to reset its state on its first
+    // render, including those already restored, so there is never a mix of resumed and restarted effects.
+    bool startBuffers(int frame, EffectLayerInfo& mainInfo, std::map<SNPair, Effect*>& nodeEffects, std::map<SNPair, SettingsMap>& nodeSettingsMaps,
+                      std::map<SNPair, bool>& nodeEffectStates, std::map<SNPair, int>& nodeEffectIdxs) {
+        bool restored = true;
+        auto startLayer = [this, frame, &restored](int layer, Effect* ef, SettingsMap& settingsMap, PixelBufferClass* buffer) {
+            initialize(layer, frame, ef, settingsMap, buffer);
+            if (inProgressStatefulEffect(ef, frame) == nullptr) {
+                return true;
+            }
+            restored = restored && restoreCheckpoint(layer, frame, ef, buffer);
+            return !restored;
+        };
+        auto startElement = [this, frame, &startLayer](Element* el, EffectLayerInfo& info, PixelBufferClass* buffer) {
+            for (int layer = el->GetEffectLayerCount() - 1; layer >= 0; --layer) {
+                SetGenericStatus("Initializing starting effect for %s, startFrame %d, and layer %d ", frame, layer, false, true);
+                info.currentEffects[layer] = findEffectForFrame(el->GetEffectLayer(layer), frame, info.currentEffectIdxs[layer]);
+                info.effectStates[layer] = startLayer(layer, info.currentEffects[layer], info.settingsMaps[layer], buffer);
+            }
+        };
+
+        startElement(rowToRender, mainInfo, mainBuffer);
+        for (const auto& a : subModelInfos) {
+            startElement(a->element, *a, a->buffer.get());
+        }
+        for (const auto& it : nodeBuffers) {
+            SNPair node = it.first;
+            StrandElement* slayer = rowToRender->GetStrand(node.strand);
+            EffectLayer* nlayer = slayer == nullptr ? nullptr : slayer->GetNodeLayer(node.node, false);
+            if (nlayer == nullptr) {
+                continue;
+            }
+            nodeEffects[node] = findEffectForFrame(nlayer, frame, nodeEffectIdxs[node]);
+            nodeEffectStates[node] = startLayer(0, nodeEffects[node], nodeSettingsMaps[node], it.second.get());
+        }
+
+        if (!restored) {
+            for (int layer = 0; layer < rowToRender->GetEffectLayerCount(); ++layer) {
+                mainInfo.effectStates[layer] = true;
+            }
+            for (const auto& a : subModelInfos) {
+                for (int layer = 0; layer < a->element->GetEffectLayerCount(); ++layer) {
+                    a->effectStates[layer] = true;
+                }
+            }
+            for (auto& it : nodeEffectStates) {
+                it.second = true;
+            }
+        }
+        return restored;
+    }
+
     void loadSettingsMap(const std::string &effectName,
                          Effect *effect,
                          SettingsMap& settingsMap) {
@@ -1309,6 +1474,9 @@ void xLightsFrame::Render(SequenceElements& seqElements,
     if (endFrame >= (int)seqData.NumFrames()) {
         endFrame = seqData.NumFrames() - 1;
     }
+    if (&seqData == &_seqData) {
+        MarkFseqFramesDirty(startFrame, endFrame);
+    }
     std::list<NodeRange> ranges;
     if (restrictToModels.empty()) {
         ranges.push_back(NodeRange(0, seqData.NumChannels()));
@@ -2062,7 +2230,7 @@ bool xLightsFrame::RenderEffectFromMap(bool suppress, Effect* effectObj, int lay
                 }
                 else {
                     int bufCnt = buffer.BufferCountForLayer(layer);
-                    std::function<void(int)> f([this, &buffer, layer, suppress, effectObj, reff, &SettingsMap](int bufn) {
+                    std::function<void(int)> f([this, &buffer, layer, bufCnt, suppress, effectObj, reff, &SettingsMap](int bufn) {
                         RenderBuffer* rb = &buffer.BufferForLayer(layer, bufn);
 
                         if (rb != nullptr) {
@@ -2077,16 +2245,29 @@ bool xLightsFrame::RenderEffectFromMap(bool suppress, Effect* effectObj, int lay
                             }
 
                             wxStopWatch sw;
+                            bool rendered = true;
                             if (effectObj != nullptr && reff->SupportsRenderCache(SettingsMap)) {
                                 if (!effectObj->GetFrame(*rb, _renderCache)) {
                                     reff->Render(effectObj, SettingsMap, *rb);
                                     effectObj->AddFrame(*rb, _renderCache);
+                                } else {
+                                    rendered = false;
                                 }
                             }
                             else {
                                 reff->Render(effectObj, SettingsMap, *rb);
                             }
 
+                            // save the simulation state periodically so later renders can resume from here
+                            if (rendered && !suppress && reff->SupportsStateCheckpoints() &&
+                                rb->curPeriod < rb->curEffEndPer && IsCheckpointFrame(rb->curPeriod, rb->frameTimeInMs)) {
+                                EffectStateCheckpoint* checkpoint = rb->CreateCheckpoint(reff->GetId());
+                                if (checkpoint != nullptr) {
+                                    checkpoint->bufferCount = bufCnt;
+                                    effectObj->AddCheckpoint(GetCheckpointKey(buffer.GetModelName(), bufn), checkpoint);
+                                }
+                            }
+
                             // Log slow render frames ... this takes time but at this point it is already slow
                             if (sw.Time() > 150) {
                                 logger_render.info("Frame #%d render on model %s (%dx%d) layer %d effect %s from %dms (#%d) to %dms (#%d) took more than 150 ms => %dms.", rb->curPeriod, (const char*)buffer.GetModelName().c_str(), rb->BufferWi, rb->BufferHt, layer, (const char*)reff->Name().c_str(), effectObj->GetStartTimeMS(), rb->curEffStartPer, effectObj->GetEndTimeMS(), rb->curEffEndPer, sw.Time());
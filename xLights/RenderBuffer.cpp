@@ -681,6 +681,43 @@ void RenderBuffer::InitBuffer(int newBufferHt, int newBufferWi, const std::strin
     tempbufVector.resize(NumPixels);
     tempbuf = &tempbufVector[0];
     isTransformed = (bufferTransform != "None");
+    _occupiedCellsValid = false;
+}
+
+void RenderBuffer::CalcOccupiedCells()
+{
+    _occupiedCells.assign((size_t)BufferWi * (size_t)BufferHt, 0);
+    _occupiedCellCount = 0;
+    for (const auto& n : Nodes) {
+        for (const auto& c : n->Coords) {
+            if (c.bufX >= 0 && c.bufX < BufferWi && c.bufY >= 0 && c.bufY < BufferHt) {
+                uint8_t& cell = _occupiedCells[c.bufY * BufferWi + c.bufX];
+                if (cell == 0) {
+                    cell = 1;
+                    ++_occupiedCellCount;
+                }
+            }
+        }
+    }
+    _occupiedCellsValid = true;
+}
+
+float RenderBuffer::GetFillRatio()
+{
+    if (!_occupiedCellsValid || _occupiedCells.size() != (size_t)BufferWi * (size_t)BufferHt) {
+        CalcOccupiedCells();
+    }
+    if (_occupiedCells.empty()) return 1.0f;
+    return (float)_occupiedCellCount / (float)_occupiedCells.size();
+}
+
+bool RenderBuffer::CanRenderSparse()
+{
+    // copies (suppressed effects, rotozoom) don't carry the nodes
+    if (!_sparseRenderAllowed || dmx_buffer || Nodes.empty()) return false;
+
+    // not worth the extra test per cell unless a decent part of the buffer can be skipped
+    return GetFillRatio() < 0.75f;
 }
 
 void RenderBuffer::Clear()
@@ -1262,6 +1299,53 @@ void RenderBuffer::SetState(int period, bool ResetState, const std::string& mode
     }
 }
 
+EffectStateCheckpoint* RenderBuffer::CreateCheckpoint(int effectId) const
+{
+    auto it = infoCache.find(effectId);
+    if (it == infoCache.end() || it->second == nullptr || needToInit) {
+        return nullptr;
+    }
+    EffectRenderCache* state = it->second->Checkpoint();
+    if (state == nullptr) {
+        return nullptr;
+    }
+    EffectStateCheckpoint* checkpoint = new EffectStateCheckpoint(curPeriod, effectId, state);
+    checkpoint->pixels.assign(pixels, pixels + pixelVector.size());
+    checkpoint->tempbuf.assign(tempbuf, tempbuf + tempbufVector.size());
+    checkpoint->tempInt = tempInt;
+    checkpoint->tempInt2 = tempInt2;
+    return checkpoint;
+}
+
+bool RenderBuffer::RestoreCheckpoint(const EffectStateCheckpoint& checkpoint)
+{
+    // buffer has been resized since the checkpoint was taken
+    if (checkpoint.pixels.size() != pixelVector.size() || checkpoint.tempbuf.size() != tempbufVector.size()) {
+        return false;
+    }
+    EffectRenderCache* state = checkpoint.state->Checkpoint();
+    if (state == nullptr) {
+        return false;
+    }
+    EffectRenderCache*& cache = infoCache[checkpoint.id];
+    if (cache != nullptr) {
+        delete cache;
+    }
+    cache = state;
+
+    if (!checkpoint.pixels.empty()) {
+        memcpy(pixels, &checkpoint.pixels[0], checkpoint.pixels.size() * sizeof(xlColor));
+    }
+    if (!checkpoint.tempbuf.empty()) {
+        memcpy(tempbuf, &checkpoint.tempbuf[0], checkpoint.tempbuf.size() * sizeof(xlColor));
+    }
+    tempInt = checkpoint.tempInt;
+    tempInt2 = checkpoint.tempInt2;
+    curPeriod = checkpoint.period;
+    needToInit = false;
+    return true;
+}
+
 void RenderBuffer::ClearTempBuf()
 {
     for (size_t i = 0; i < tempbufVector.size(); i++) {
@@ -398,6 +398,27 @@ class /*NCCDLLEXPORT*/ EffectRenderCache {
 public:
 	EffectRenderCache();
 	virtual ~EffectRenderCache();
+
+    // Effects which carry a simulation from frame to frame override this to return a deep
+    // copy of their state so rendering can later resume from this point.
+    // Returns nullptr if the state cannot be captured.
+    virtual EffectRenderCache* Checkpoint() const { return nullptr; }
+};
+
+// Snapshot of everything a render buffer carries from one frame to the next for one effect
+class /*NCCDLLEXPORT*/ EffectStateCheckpoint {
+public:
+    EffectStateCheckpoint(int p, int effectId, EffectRenderCache* s) : period(p), id(effectId), state(s) {}
+    virtual ~EffectStateCheckpoint() { delete state; }
+
+    int period = 0;      // the last frame rendered before the state was captured
+    int id = -1;         // the effect id the state is stored under in the infoCache
+    int bufferCount = 1; // buffers the layer was split into, only resumable if all of them were captured
+    EffectRenderCache* state = nullptr;
+    xlColorVector pixels;
+    xlColorVector tempbuf;
+    int tempInt = 0;
+    int tempInt2 = 0;
 };
 
 class /*NCCDLLEXPORT*/ RenderBuffer {
@@ -421,6 +442,8 @@ public:
     bool IsDmxBuffer() const { return dmx_buffer; }
 
     void SetState(int period, bool reset, const std::string& model_name);
+    EffectStateCheckpoint* CreateCheckpoint(int effectId) const;
+    bool RestoreCheckpoint(const EffectStateCheckpoint& checkpoint);
 
     void SetEffectDuration(int startMsec, int endMsec);
     void GetEffectPeriods(int& curEffStartPer, int& curEffEndPer) const;  // nobody wants endPer?
@@ -434,6 +457,17 @@ public:
     void SetPixel(int x, int y, const HSVValue& hsv, bool wrap = false);
 
     int GetNodeCount() const { return Nodes.size();}
+
+    // Sparse models and groups often map nodes to only a small part of their buffer and only
+    // the cells with nodes are ever read back. Effects that compute each cell independently can
+    // call CanRenderSparse() and, if it returns true, skip cells where IsCellOccupied() is false.
+    // The owning PixelBufferClass only allows this when nothing else (blur, rotozoom, transitions,
+    // canvas layers) will read the other cells so the output is identical.
+    bool CanRenderSparse();
+    bool IsCellOccupied(int x, int y) const { return _occupiedCells[y * BufferWi + x] != 0; }
+    float GetFillRatio();
+    void SetSparseRenderAllowed(bool allowed) { _sparseRenderAllowed = allowed; }
+    void InvalidateOccupiedCells() { _occupiedCellsValid = false; }
     void SetNodePixel(int nodeNum, const xlColor &color, bool dmx_ignore = false);
     void CopyNodeColorsToPixels(std::vector<bool> &done);
 
@@ -540,9 +574,14 @@ public:
 private:
     friend class PixelBufferClass;
     std::vector<NodeBaseClassPtr> Nodes;
+    std::vector<uint8_t> _occupiedCells;
+    size_t _occupiedCellCount = 0;
+    bool _occupiedCellsValid = false;
+    bool _sparseRenderAllowed = false;
     PathDrawingContext *_pathDrawingContext = nullptr;
     TextDrawingContext *_textDrawingContext = nullptr;
 
     void SetPixelDMXModel(int x, int y, const xlColor& color);
+    void CalcOccupiedCells();
     void Forget();
 };
@@ -171,7 +171,7 @@ void RenderCache::RemoveItem(RenderCacheItem *item) {
     delete item;
 }
 
-bool RenderCache::IsEffectOkForCaching(Effect* effect) const
+bool RenderCache::IsEffectOkForCaching(const Effect* effect) const
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     if (!IsEnabled()) return false;
@@ -435,7 +435,7 @@ std::string RenderCacheItem::GetModelName(RenderBuffer* buffer)
     }
 }
 
-RenderCacheItem::RenderCacheItem(RenderCache* renderCache, Effect* effect, RenderBuffer* buffer) : _renderCache(renderCache)
+RenderCacheItem::RenderCacheItem(RenderCache* renderCache, const Effect* effect, RenderBuffer* buffer) : _renderCache(renderCache)
 {
     _purged = false;
     _dirty = true;
@@ -472,7 +472,7 @@ RenderCacheItem::RenderCacheItem(RenderCache* renderCache, Effect* effect, Rende
     }
 }
 
-bool RenderCacheItem::IsMatch(Effect* effect, RenderBuffer* buffer)
+bool RenderCacheItem::IsMatch(const Effect* effect, RenderBuffer* buffer)
 {
     static log4cpp::Category& logger_rcache = log4cpp::Category::getInstance(std::string("log_rendercache"));
     if (_purged) return false;
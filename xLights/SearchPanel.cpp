@@ -239,7 +239,7 @@ void SearchPanel::FindSettings()
     }
 }
 
-bool SearchPanel::ContainsSetting(Effect* eff, std::string const& search, bool regex, std::string &value) const
+bool SearchPanel::ContainsSetting(const Effect* eff, std::string const& search, bool regex, std::string &value) const
 {
     value.clear();
 
@@ -72,7 +72,7 @@ class SearchPanel: public wxPanel
         void FindSettings();
         void SelectEffects();
 
-		bool ContainsSetting(Effect* eff, std::string const& search, bool regex, std::string& value) const;
+		bool ContainsSetting(const Effect* eff, std::string const& search, bool regex, std::string& value) const;
 
 		//(*Handlers(SearchPanel)
 		void OnButton_Search_FindClick(wxCommandEvent& event);
@@ -215,6 +215,7 @@ void xLightsFrame::OpenSequence(const wxString passed_filename, ConvertLogDialog
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
     ClearNonExistentFiles();
+    InvalidateWrittenFseq();
 
     bool loaded_fseq = false;
     wxString filename;
@@ -563,6 +564,7 @@ bool xLightsFrame::CloseSequence()
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     logger_base.debug("Closing sequence.");
+    InvalidateWrittenFseq();
 
     if (_autoSavePerspecive && CurrentSeqXmlFile != nullptr)
     {
@@ -685,6 +687,7 @@ bool xLightsFrame::SeqLoadXlightsFile(xLightsXmlFile& xml_file, bool ChooseModel
 void xLightsFrame::ClearSequenceData()
 {
     wxASSERT(_seqData.IsValidData());
+    InvalidateWrittenFseq();
     for (size_t i = 0; i < _seqData.NumFrames(); ++i)
         _seqData[i].Zero();
 }
@@ -736,6 +739,7 @@ void xLightsFrame::RenderIseqData(bool bottom_layers, ConvertLogDialog* plog)
                     data_layer);                               // provide data layer for channel offsets
 
                 FileConverter::ReadFalconFile(read_params);
+                InvalidateWrittenFseq();
                 read_mode = ConvertParameters::READ_MODE_IGNORE_BLACK;
                 layers_rendered++;
             }
@@ -9,7 +9,18 @@
  **************************************************************/
 
 #include <wx/wx.h>
+#include <wx/filename.h>
 
+#ifdef __WXMSW__
+#include <wx/msw/wrapwin.h>
+#include <winioctl.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
 
 #include <log4cpp/Category.hh>
 
@@ -26,6 +37,12 @@ const unsigned char SequenceData::FrameData::_constzero = 0;
 // memory.  Most users sequences will likely fit in this anyway
 static const size_t MAX_BLOCK_SIZE = 1024 * 1024 * 1024;
 
+// file backed blocks only cost address space until they are touched so they can be much bigger
+static const uint64_t MAX_FILE_BACKED_BLOCK_SIZE = (uint64_t)16 * 1024 * 1024 * 1024;
+
+std::string SequenceData::_fileBackedFolder;
+size_t SequenceData::_fileBackedThresholdMB = 0;
+
 #ifdef USE_MMAP_BLOCKS
 std::list<std::unique_ptr<SequenceData::DataBlock>> SequenceData::HUGE_BLOCK_CACHE;
 #include <thread>
@@ -106,7 +123,16 @@ SequenceData::~SequenceData()
 
 SequenceData::DataBlock::~DataBlock()
 {
-    if (data) {
+    if (data && type == BlockType::FILE_BACKED) {
+        // the file was deleted when it was created (or is delete on close) so unmapping is all the cleanup needed
+#ifdef __WXMSW__
+        ::UnmapViewOfFile(data);
+        if (mappingHandle != nullptr) ::CloseHandle((HANDLE)mappingHandle);
+        if (fileHandle != nullptr) ::CloseHandle((HANDLE)fileHandle);
+#else
+        munmap(data, size);
+#endif
+    } else if (data) {
 #ifdef USE_MMAP_BLOCKS
         munmap(data, size);
 #else
@@ -135,6 +161,18 @@ void SequenceData::Cleanup()
     _invalidFrame._data = nullptr;
 }
 
+void SequenceData::Swap(SequenceData& other)
+{
+    std::swap(_invalidFrame._numChannels, other._invalidFrame._numChannels);
+    std::swap(_invalidFrame._data, other._invalidFrame._data);
+    _frames.swap(other._frames);
+    _dataBlocks.swap(other._dataBlocks);
+    std::swap(_bytesPerFrame, other._bytesPerFrame);
+    std::swap(_numChannels, other._numChannels);
+    std::swap(_numFrames, other._numFrames);
+    std::swap(_frameTime, other._frameTime);
+}
+
 unsigned char* SequenceData::AllocBlock(size_t requested, size_t& szAllocated, BlockType &blockType)
 {
     unsigned char* data = nullptr;
@@ -259,6 +297,128 @@ unsigned char* SequenceData::AllocBlock(size_t requested, size_t& szAllocated, B
     return data;
 }
 
+bool SequenceData::UseFileBacking(size_t totalSize)
+{
+    if (sizeof(void*) < 8) return false; // not enough address space to map it
+
+    size_t thresholdMB = _fileBackedThresholdMB;
+    if (thresholdMB == 0) {
+        uint64_t physicalMB = GetPhysicalMemorySizeMB();
+        if (physicalMB == 0) return false;
+        thresholdMB = physicalMB > 4096 ? physicalMB - 2048 : physicalMB / 2;
+    }
+    return totalSize / (1024 * 1024) > thresholdMB;
+}
+
+std::unique_ptr<SequenceData::DataBlock> SequenceData::AllocFileBackedBlock(size_t requested)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    size_t sz = (size_t)std::min((uint64_t)requested, MAX_FILE_BACKED_BLOCK_SIZE);
+    wxString folder = _fileBackedFolder;
+    if (!folder.IsEmpty() && !wxDirExists(folder) && !wxFileName::Mkdir(folder, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL)) {
+        logger_base.warn("Unable to create sequence data folder %s, using the temp folder.", (const char*)folder.c_str());
+        folder = "";
+    }
+    if (folder.IsEmpty()) {
+        folder = wxFileName::GetTempDir();
+    }
+    wxString filename = wxFileName::CreateTempFileName(folder + wxFileName::GetPathSeparator() + "xLightsSeqData");
+    if (filename.IsEmpty()) {
+        logger_base.warn("Unable to create sequence data backing file in %s.", (const char*)folder.c_str());
+        return nullptr;
+    }
+
+#ifdef __WXMSW__
+    HANDLE file = ::CreateFileW(filename.wc_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                                FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        wxRemoveFile(filename);
+        logger_base.warn("Unable to open sequence data backing file %s.", (const char*)filename.c_str());
+        return nullptr;
+    }
+    // sparse so the untouched (blank) parts of the sequence never hit the disk
+    DWORD bytesReturned = 0;
+    ::DeviceIoControl(file, FSCTL_SET_SPARSE, nullptr, 0, nullptr, 0, &bytesReturned, nullptr);
+    HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READWRITE, (DWORD)((uint64_t)sz >> 32), (DWORD)(sz & 0xFFFFFFFF), nullptr);
+    unsigned char* data = nullptr;
+    if (mapping != nullptr) {
+        data = (unsigned char*)::MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sz);
+    }
+    if (data == nullptr) {
+        if (mapping != nullptr) ::CloseHandle(mapping);
+        ::CloseHandle(file);
+        logger_base.warn("Unable to map %lluMB of sequence data backing file %s.", (unsigned long long)(sz / (1024 * 1024)), (const char*)filename.c_str());
+        return nullptr;
+    }
+    auto block = std::make_unique<DataBlock>(sz, data, BlockType::FILE_BACKED);
+    block->fileHandle = file;
+    block->mappingHandle = mapping;
+#else
+    int fd = open(filename.c_str(), O_RDWR);
+    // unlink straight away, the mapping keeps the data alive and nothing is left behind if we crash
+    unlink(filename.c_str());
+    if (fd == -1) {
+        logger_base.warn("Unable to open sequence data backing file %s.", (const char*)filename.c_str());
+        return nullptr;
+    }
+    // extending with ftruncate leaves a sparse file, blocks are only allocated when frames are written
+    unsigned char* data = nullptr;
+    if (ftruncate(fd, sz) == 0) {
+        data = (unsigned char*)mmap(nullptr, sz, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED) data = nullptr;
+    }
+    close(fd);
+    if (data == nullptr) {
+        logger_base.warn("Unable to map %lluMB of sequence data backing file %s.", (unsigned long long)(sz / (1024 * 1024)), (const char*)filename.c_str());
+        return nullptr;
+    }
+    auto block = std::make_unique<DataBlock>(sz, data, BlockType::FILE_BACKED);
+#endif
+    logger_base.debug("Sequence data backed by %lluMB file mapping in %s.", (unsigned long long)(sz / (1024 * 1024)), (const char*)folder.c_str());
+    return block;
+}
+
+void SequenceData::AdviseFrames(unsigned int startFrame, unsigned int endFrame, bool willNeed) const
+{
+    if (!IsFileBacked() || startFrame >= _numFrames) return;
+    endFrame = std::min(endFrame, _numFrames - 1);
+    if (endFrame < startFrame) return;
+
+#ifndef __WXMSW__
+    static const size_t pageSize = sysconf(_SC_PAGESIZE);
+#endif
+    const unsigned char* start = _frames[startFrame]._data;
+    const unsigned char* end = _frames[endFrame]._data + _bytesPerFrame;
+    for (const auto& b : _dataBlocks) {
+        if (b->type != BlockType::FILE_BACKED) continue;
+        const unsigned char* s = std::max(start, (const unsigned char*)b->data);
+        const unsigned char* e = std::min(end, (const unsigned char*)b->data + b->size);
+        if (s >= e) continue;
+#ifdef __WXMSW__
+        if (!willNeed) {
+            // unlocking pages that aren't locked just drops them from the working set, they stay in the file
+            ::VirtualUnlock((LPVOID)s, e - s);
+        }
+#else
+        // madvise needs a page aligned start, blocks are page aligned
+        size_t offset = (s - b->data) % pageSize;
+        s -= offset;
+        madvise((void*)s, e - s, willNeed ? MADV_WILLNEED : MADV_DONTNEED);
+#endif
+    }
+}
+
+void SequenceData::PrefetchFrames(unsigned int startFrame, unsigned int endFrame) const
+{
+    AdviseFrames(startFrame, endFrame, true);
+}
+
+void SequenceData::ReleaseFrames(unsigned int startFrame, unsigned int endFrame) const
+{
+    AdviseFrames(startFrame, endFrame, false);
+}
+
 unsigned char *SequenceData::checkBlockPtr(unsigned char *block, size_t sizeRemaining) {
     static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     wxASSERT(block != nullptr); // if this fails then we have a memory allocation error
@@ -292,14 +452,33 @@ void SequenceData::init(unsigned int numChannels, unsigned int numFrames, unsign
         size_t sizeRemaining = (size_t)_bytesPerFrame * (size_t)_numFrames;
         size_t blockSize = 0;
         
-        BlockType type = BlockType::NORMAL;
-        unsigned char* block = checkBlockPtr(AllocBlock(sizeRemaining, blockSize, type), sizeRemaining);
-        _dataBlocks.push_back(std::make_unique<DataBlock>(blockSize, block, type));
+        bool fileBacked = UseFileBacking(sizeRemaining);
+        if (fileBacked) {
+            logger_base.info("Sequence data needs %lluMB which is more than we want to hold in memory, it will be backed by a temporary file.",
+                             (unsigned long long)(sizeRemaining / (1024 * 1024)));
+        }
+        auto allocBlock = [this, &fileBacked](size_t sizeRemaining, size_t& blockSize) {
+            if (fileBacked) {
+                auto fb = AllocFileBackedBlock(sizeRemaining);
+                if (fb != nullptr) {
+                    blockSize = fb->size;
+                    unsigned char* block = fb->data;
+                    _dataBlocks.push_back(std::move(fb));
+                    return block;
+                }
+                // couldn't get a backing file, the rest comes from memory
+                fileBacked = false;
+            }
+            BlockType type = BlockType::NORMAL;
+            unsigned char* block = checkBlockPtr(AllocBlock(sizeRemaining, blockSize, type), sizeRemaining);
+            _dataBlocks.push_back(std::make_unique<DataBlock>(blockSize, block, type));
+            return block;
+        };
+        unsigned char* block = allocBlock(sizeRemaining, blockSize);
         
         for (unsigned int frame = 0; frame < numFrames; ++frame) {
             if (blockSize < _bytesPerFrame) {
-                block = checkBlockPtr(AllocBlock(sizeRemaining, blockSize, type), sizeRemaining);
-                _dataBlocks.push_back(std::make_unique<DataBlock>(blockSize, block, type));
+                block = allocBlock(sizeRemaining, blockSize);
             }
             _frames.push_back(FrameData(_numChannels, block));
             block += _bytesPerFrame;
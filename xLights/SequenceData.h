@@ -66,19 +66,25 @@ public:
 
     enum class BlockType {
         NORMAL,
-        HUGE_PAGE
+        HUGE_PAGE,
+        FILE_BACKED
     };
     class DataBlock {
         DataBlock(const DataBlock&d) = delete;
         DataBlock &operator=(const DataBlock& d) = delete;
     public:
         DataBlock(size_t s, unsigned char *d, BlockType bt) : size(s), data(d), type(bt) {}
-        DataBlock(DataBlock&&d) noexcept : size(d.size), data(d.data), type(d.type) {d.data = nullptr; d.size = 0; d.type = BlockType::NORMAL;};
+        DataBlock(DataBlock&&d) noexcept : size(d.size), data(d.data), type(d.type), fileHandle(d.fileHandle), mappingHandle(d.mappingHandle) {
+            d.data = nullptr; d.size = 0; d.type = BlockType::NORMAL; d.fileHandle = nullptr; d.mappingHandle = nullptr;
+        };
         ~DataBlock();
         
         unsigned char * data;
         size_t size;
         BlockType type;
+        // only used by FILE_BACKED blocks on windows
+        void* fileHandle = nullptr;
+        void* mappingHandle = nullptr;
     };
 #ifdef USE_MMAP_BLOCKS
     static std::list<std::unique_ptr<DataBlock>> HUGE_BLOCK_CACHE;
@@ -98,11 +104,19 @@ public:
     void Cleanup();
     unsigned char *checkBlockPtr(unsigned char *block, size_t sizeRemaining);
     static unsigned char *AllocBlock(size_t requested, size_t &szAllocated, BlockType &bt);
+    std::unique_ptr<DataBlock> AllocFileBackedBlock(size_t requested);
+    static bool UseFileBacking(size_t totalSize);
+    void AdviseFrames(unsigned int startFrame, unsigned int endFrame, bool willNeed) const;
+
+    static std::string _fileBackedFolder;
+    static size_t _fileBackedThresholdMB;
 public:
     SequenceData();
     virtual ~SequenceData();
     
     void init(unsigned int numChannels, unsigned int numFrames, unsigned int frameTime, bool roundto4 = true);
+    // exchange all frame data with another object without copying it
+    void Swap(SequenceData& other);
     unsigned int TotalTime() const { return _numFrames * _frameTime; }
     bool OK(unsigned int frame, unsigned int channel) const { return frame < _numFrames && channel < _numChannels; }
     
@@ -123,6 +137,20 @@ public:
     unsigned int NumFrames() const { return _numFrames;}
     unsigned int FrameTime() const { return _frameTime;}
     bool IsValidData() const { return !_dataBlocks.empty(); }
+    bool IsFileBacked() const { return !_dataBlocks.empty() && _dataBlocks.front()->type == BlockType::FILE_BACKED; }
+
+    // Sequences whose frame data would not fit comfortably in RAM are backed by a sparse
+    // temporary file that is memory mapped. The frames are still plain pointers so nothing
+    // else changes, the OS just pages the parts being rendered/played in and out on demand.
+    // Threshold of 0 (the default) uses physical memory less 2GB. The folder is the render cache
+    // folder once a show is loaded, the temp dir (which may itself be in RAM) before that.
+    static void SetFileBackedFolder(const std::string& folder) { _fileBackedFolder = folder; }
+    static void SetFileBackedThresholdMB(size_t mb) { _fileBackedThresholdMB = mb; }
+
+    // Hints for file backed data that a range of frames is about to be used or is done with.
+    // These are no-ops for in memory data.
+    void PrefetchFrames(unsigned int startFrame, unsigned int endFrame) const;
+    void ReleaseFrames(unsigned int startFrame, unsigned int endFrame) const;
 
     // encodes contents of SeqData in channel order
     wxString base64_encode();
@@ -118,6 +118,7 @@ void xLightsFrame::SetMediaFilename(const wxString& filename)
 void xLightsFrame::ClearLastPeriod()
 {
     int LastPer = _seqData.NumFrames() - 1;
+    MarkFseqFramesDirty(LastPer, LastPer);
     for (size_t ch = 0; ch < _seqData.NumChannels(); ch++) {
         _seqData[LastPer][ch] = 0;
     }
@@ -1430,43 +1431,74 @@ void xLightsFrame::WriteFalconPiFile(const wxString& filename, bool allowSparse)
                                    filename);
 
     if (allowSparse) {
-        std::map<uint32_t, uint32_t> ranges;
-        int numElements = _sequenceElements.GetElementCount();
-        for (int i = 0; i < numElements; ++i) {
-            Element* element = _sequenceElements.GetElement(i);
-            if (element->GetType() == ElementType::ELEMENT_TYPE_MODEL) {
-                std::string modelName = element->GetModelName();
-                Model* m = this->GetModel(modelName);
-                addRanges(m, ranges);
-            }
+        AddFalconPiSparseRanges(write_params);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(_fseqDirtyLock);
+        if (_fseqWrittenId != 0 && _fseqWrittenFilename == filename) {
+            write_params.fseq_unique_id = _fseqWrittenId;
+            write_params.fseq_dirty_start_frame = _fseqDirtyStartFrame;
+            write_params.fseq_dirty_end_frame = _fseqDirtyEndFrame;
         }
+        _fseqDirtyStartFrame = -1;
+        _fseqDirtyEndFrame = -1;
+    }
+
+    FileConverter::WriteFalconPiFile(write_params);
+
+    _fseqWrittenFilename = filename;
+    _fseqWrittenId = write_params.fseq_unique_id;
+}
+
+void xLightsFrame::AddFalconPiSparseRanges(ConvertParameters& write_params)
+{
+    std::map<uint32_t, uint32_t> ranges;
+    int numElements = _sequenceElements.GetElementCount();
+    for (int i = 0; i < numElements; ++i) {
+        Element* element = _sequenceElements.GetElement(i);
+        if (element->GetType() == ElementType::ELEMENT_TYPE_MODEL) {
+            std::string modelName = element->GetModelName();
+            Model* m = this->GetModel(modelName);
+            addRanges(m, ranges);
+        }
+    }
 
-        uint32_t gapEliminate = 0; // set if we want to eliminate gaps
-        std::pair<uint32_t, uint32_t> cur(INT_MAX, INT_MAX);
-        for (auto& a : ranges) {
-            if (cur.first == INT_MAX) {
+    uint32_t gapEliminate = 0; // set if we want to eliminate gaps
+    std::pair<uint32_t, uint32_t> cur(INT_MAX, INT_MAX);
+    for (auto& a : ranges) {
+        if (cur.first == INT_MAX) {
+            cur.first = a.first;
+            cur.second = a.second;
+        } else {
+            if (a.first <= (cur.first + cur.second + gapEliminate)) {
+                // overlap or within 1025 channels of an overlap, need to combine
+                // if the two ranges are "close" (wthin 1025 channels) we'll combine
+                // as the overhead of doing ranges wouldn't benefit with a small gap
+                uint32_t max = cur.first + cur.second - 1;
+                uint32_t amax = a.first + a.second - 1;
+                max = std::max(max, amax);
+                cur.second = max - cur.first + 1;
+            } else {
+                write_params.ranges.push_back(cur);
                 cur.first = a.first;
                 cur.second = a.second;
-            } else {
-                if (a.first <= (cur.first + cur.second + gapEliminate)) {
-                    // overlap or within 1025 channels of an overlap, need to combine
-                    // if the two ranges are "close" (wthin 1025 channels) we'll combine
-                    // as the overhead of doing ranges wouldn't benefit with a small gap
-                    uint32_t max = cur.first + cur.second - 1;
-                    uint32_t amax = a.first + a.second - 1;
-                    max = std::max(max, amax);
-                    cur.second = max - cur.first + 1;
-                } else {
-                    write_params.ranges.push_back(cur);
-                    cur.first = a.first;
-                    cur.second = a.second;
-                }
             }
         }
-        if (cur.first != INT_MAX) {
-            write_params.ranges.push_back(cur);
-        }
     }
+    if (cur.first != INT_MAX) {
+        write_params.ranges.push_back(cur);
+    }
+}
 
-    FileConverter::WriteFalconPiFile(write_params);
+void xLightsFrame::MarkFseqFramesDirty(int startFrame, int endFrame)
+{
+    // render jobs mark the frames they actually render from their own threads
+    std::unique_lock<std::mutex> lock(_fseqDirtyLock);
+    if (_fseqDirtyStartFrame == -1 || startFrame < _fseqDirtyStartFrame) {
+        _fseqDirtyStartFrame = startFrame;
+    }
+    if (endFrame > _fseqDirtyEndFrame) {
+        _fseqDirtyEndFrame = endFrame;
+    }
 }
@@ -13,10 +13,12 @@
 #include <wx/clipbrd.h>
 #include <wx/xml/xml.h>
 #include <wx/config.h>
+#include <wx/file.h>
 
 #include "xLightsMain.h"
 #include "SeqSettingsDialog.h"
 #include "xLightsXmlFile.h"
+#include "FileConverter.h"
 #include "effects/RenderableEffect.h"
 #include "models/ModelGroup.h"
 #include "models/SubModel.h"
@@ -39,6 +41,7 @@
 #include "ColoursPanel.h"
 #include "sequencer/MainSequencer.h"
 #include "HousePreviewPanel.h"
+#include "graphics/xlMeshCache.h"
 #include "ExternalHooks.h"
 
 #include "xLightsVersion.h"
@@ -320,6 +323,9 @@ wxString xLightsFrame::LoadEffectsFileNoCheck()
         SetXmlSetting("renderCacheDir", showDirectory);
         UnsavedRgbEffectsChanges = true;
     }
+    AudioManager::SetAnalysisCacheFolder(renderCacheDirectory + wxFileName::GetPathSeparator() + "RenderCache" + wxFileName::GetPathSeparator() + "AudioCache");
+    xlMeshCache::Instance().SetSidecarFolder(renderCacheDirectory + wxFileName::GetPathSeparator() + "RenderCache" + wxFileName::GetPathSeparator() + "MeshCache");
+    SequenceData::SetFileBackedFolder(renderCacheDirectory + wxFileName::GetPathSeparator() + "RenderCache" + wxFileName::GetPathSeparator() + "SequenceData");
 
     mStoredLayoutGroup = GetXmlSetting("storedLayoutGroup", "Default");
 
@@ -1180,6 +1186,8 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
 
     if (origFilenames.IsEmpty()) {
+        WaitForBatchRenderWork();
+        LogBatchRenderReport();
         _lowDefinitionRender = _saveLowDefinitionRender;
         _renderMode = false;
         EnableSequenceControls(true);
@@ -1195,6 +1203,8 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
 
     if (wxGetKeyState(WXK_ESCAPE))
     {
+        WaitForBatchRenderWork();
+        LogBatchRenderReport();
         logger_base.debug("Batch render cancelled.");
         EnableSequenceControls(true);
         printf("Batch render cancelled.\n");
@@ -1216,8 +1226,24 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
 
     printf("Processing file %s\n", (const char *)seq.c_str());
     logger_base.debug("Batch Render Processing file %s\n", (const char *)seq.c_str());
+    size_t reportIndex;
+    {
+        std::unique_lock<std::mutex> lock(_batchRenderLock);
+        reportIndex = _batchRenderTimes.size();
+        _batchRenderTimes.push_back(BatchRenderTimes());
+        _batchRenderTimes.back().sequence = seq.ToStdString();
+    }
     OpenSequence(seq, nullptr);
     EnableSequenceControls(false);
+    {
+        std::unique_lock<std::mutex> lock(_batchRenderLock);
+        _batchRenderTimes[reportIndex].openMS = sw.Time();
+    }
+
+    // get the next sequence off the disk while this one renders
+    if (!fileNames.IsEmpty()) {
+        PrefetchBatchRenderSequence(fileNames[0]);
+    }
 
     // if the fseq directory is not the show directory then ensure the fseq folder is set right
     if (fseqDirectory != showDirectory) {
@@ -1238,7 +1264,8 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
     RenderIseqData(true, nullptr); // render ISEQ layers below the Nutcracker layer
     logger_base.info("   iseq below effects done.");
     ProgressBar->SetValue(10);
-    RenderGridToSeqData([this, sw, fileNames, exitOnDone] {
+    long renderStart = sw.Time();
+    RenderGridToSeqData([this, sw, renderStart, reportIndex, fileNames, exitOnDone] {
         static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
         logger_base.info("   Effects done.");
         ProgressBar->SetValue(90);
@@ -1250,10 +1277,27 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
         _appProgress->Reset();
         GaugeSizer->Layout();
 
+        {
+            std::unique_lock<std::mutex> lock(_batchRenderLock);
+            _batchRenderTimes[reportIndex].renderMS = sw.Time() - renderStart;
+        }
+
+        // before the fseq write as that may hand the sequence data to a background thread
+        if (!_renderModeVideoFolder.IsEmpty()) {
+            wxFileName video(xlightsFilename);
+            video.SetPath(_renderModeVideoFolder);
+            video.SetExt("mp4");
+            logger_base.info("Exporting house preview video %s.", (const char*)video.GetFullPath().c_str());
+            SetStatusText(_("Saving ") + xlightsFilename + _(" ... Exporting preview video."));
+            if (!ExportPreviewVideo(video.GetFullPath())) {
+                printf("Failed to export preview video %s\n", (const char*)video.GetFullPath().c_str());
+            }
+        }
+
         logger_base.info("Saving fseq file.");
         SetStatusText(_("Saving ") + xlightsFilename + _(" ... Writing fseq."));
-        WriteFalconPiFile(xlightsFilename);
-        logger_base.info("fseq file done.");
+        // if there is another sequence to do then write this one while that one loads and renders
+        WriteBatchRenderFseq(xlightsFilename, reportIndex, !fileNames.IsEmpty());
         DisplayXlightsFilename(xlightsFilename);
         float elapsedTime = sw.Time()/1000.0; // now stop stopwatch timer and get elapsed time. change into seconds from ms
         wxString displayBuff = wxString::Format(_("%s     Updated in %7.3f seconds"),xlightsFilename,elapsedTime);
@@ -1266,6 +1310,134 @@ void xLightsFrame::OpenRenderAndSaveSequences(const wxArrayString &origFilenames
     } );
 }
 
+void xLightsFrame::WriteBatchRenderFseq(const wxString& filename, size_t reportIndex, bool background)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    // only one sequence is written in the background at a time
+    WaitForBatchRenderWork();
+
+    // the frames are handed over rather than copied but the next sequence allocates its own
+    // so only overlap the write if both fit comfortably in memory
+    uint64_t dataMB = ((uint64_t)_seqData.NumFrames() * roundTo4(_seqData.NumChannels())) / (1024 * 1024);
+    if (background && dataMB > GetPhysicalMemorySizeMB() / 4) {
+        logger_base.info("Batch render: sequence data is %lluMB so writing fseq before moving on.", (unsigned long long)dataMB);
+        background = false;
+    }
+
+    if (!background) {
+        wxStopWatch sw;
+        WriteFalconPiFile(filename);
+        logger_base.info("fseq file done.");
+        std::unique_lock<std::mutex> lock(_batchRenderLock);
+        _batchRenderTimes[reportIndex].writeMS = sw.Time();
+        return;
+    }
+
+    auto data = std::make_shared<SequenceData>();
+    data->Swap(_seqData);
+    auto media = std::make_shared<std::string>(mediaFilename);
+    auto params = std::make_shared<ConvertParameters>(filename, *data, &_outputManager, ConvertParameters::READ_MODE_LOAD_MAIN,
+                                                      this, nullptr, nullptr, media.get(), nullptr, filename);
+    AddFalconPiSparseRanges(*params);
+
+    // the sequence data we were tracking is gone so the next save must write the whole file
+    InvalidateWrittenFseq();
+    {
+        std::unique_lock<std::mutex> lock(_batchRenderLock);
+        _batchRenderTimes[reportIndex].background = true;
+    }
+
+    _batchRenderWrite = std::async(std::launch::async, [this, data, media, params, reportIndex]() {
+        static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+        wxStopWatch sw;
+        // errors can't be shown from here so they are kept for the batch report
+        std::string error;
+        params->error_message = &error;
+        FileConverter::WriteFalconPiFile(*params);
+        params->error_message = nullptr;
+        if (error.empty()) {
+            logger_base.info("Batch render: background fseq write of %s done in %ldms.", (const char*)params->out_filename.c_str(), sw.Time());
+        } else {
+            logger_base.error("Batch render: background fseq write of %s failed: %s", (const char*)params->out_filename.c_str(), (const char*)error.c_str());
+        }
+        std::unique_lock<std::mutex> lock(_batchRenderLock);
+        _batchRenderTimes[reportIndex].writeMS = sw.Time();
+        _batchRenderTimes[reportIndex].writeError = error;
+    });
+}
+
+void xLightsFrame::WaitForBatchRenderWork()
+{
+    if (_batchRenderWrite.valid()) {
+        _batchRenderWrite.wait();
+        _batchRenderWrite = std::future<void>();
+    }
+    if (_batchRenderPrefetch.valid()) {
+        _batchRenderPrefetch.wait();
+        _batchRenderPrefetch = std::future<void>();
+    }
+}
+
+// Read the sequence file and its audio so they are in the OS file cache when the sequence is opened
+void xLightsFrame::PrefetchBatchRenderSequence(const wxString& filename)
+{
+    if (_batchRenderPrefetch.valid()) {
+        _batchRenderPrefetch.wait();
+    }
+
+    std::string file = filename.ToStdString();
+    _batchRenderPrefetch = std::async(std::launch::async, [file]() {
+        std::string xml;
+        wxFile f;
+        if (!f.Open(file)) return;
+        xml.resize(f.Length());
+        if (f.Read(&xml[0], xml.size()) != (ssize_t)xml.size()) return;
+        f.Close();
+
+        auto start = xml.find("<mediaFile>");
+        auto end = xml.find("</mediaFile>");
+        if (start == std::string::npos || end == std::string::npos || end < start) return;
+        std::string media = xml.substr(start + 11, end - start - 11);
+        Replace(media, "&amp;", "&");
+        if (media == "" || !wxFileExists(media) || !f.Open(media)) return;
+
+        std::vector<char> buffer(1024 * 1024);
+        while (f.Read(&buffer[0], buffer.size()) > 0) {
+        }
+    });
+}
+
+void xLightsFrame::LogBatchRenderReport()
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    std::vector<std::string> errors;
+    {
+        std::unique_lock<std::mutex> lock(_batchRenderLock);
+        if (_batchRenderTimes.empty()) return;
+
+        logger_base.info("Batch render summary:");
+        printf("Batch render summary:\n");
+        for (const auto& it : _batchRenderTimes) {
+            std::string write = it.writeMS < 0 ? "not written" : wxString::Format("write %ldms%s", it.writeMS, it.background ? " (background)" : "").ToStdString();
+            if (!it.writeError.empty()) {
+                write = "write failed: " + it.writeError;
+                errors.push_back(it.writeError);
+            }
+            std::string line = wxString::Format("    %s: open %ldms, render %ldms, %s", wxFileName(it.sequence).GetFullName(), it.openMS, it.renderMS, write).ToStdString();
+            logger_base.info("%s", (const char*)line.c_str());
+            printf("%s\n", (const char*)line.c_str());
+        }
+        _batchRenderTimes.clear();
+    }
+
+    // background write failures are reported here on the main thread as a foreground write would have
+    for (const auto& it : errors) {
+        ConversionError(it);
+    }
+}
+
 void xLightsFrame::SaveSequence()
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
@@ -11,6 +11,7 @@
  **************************************************************/
 
 #include <map>
+#include <memory>
 #include <string>
 #include <algorithm>
 
@@ -261,6 +262,35 @@ private:
     static void RemapChangedSettingKey(std::string &n,  std::string &value);
 };
 
+// Reference counted, copy-on-write holder for a SettingsMap.  Copies share the same underlying map until
+// one of them is edited, so effects loaded from the same EffectDB entry only keep a single copy of their
+// settings.  The shared map must be treated as immutable ... always go through Edit() to change it.
+class SharedSettingsMap {
+public:
+    SharedSettingsMap() : _map(EmptyMap()) {}
+    explicit SharedSettingsMap(const SettingsMap& map) : _map(std::make_shared<SettingsMap>(map)) {}
+    explicit SharedSettingsMap(SettingsMap&& map) : _map(std::make_shared<SettingsMap>(std::move(map))) {}
+
+    const SettingsMap& operator*() const { return *_map; }
+    const SettingsMap* operator->() const { return _map.get(); }
+
+    // returns a map only this holder references, copying the shared one first if needed
+    SettingsMap& Edit() {
+        if (_map.use_count() > 1) {
+            _map = std::make_shared<SettingsMap>(*_map);
+        }
+        return *_map;
+    }
+    bool IsShared() const { return _map.use_count() > 1; }
+
+private:
+    static const std::shared_ptr<SettingsMap>& EmptyMap() {
+        static const std::shared_ptr<SettingsMap> empty = std::make_shared<SettingsMap>();
+        return empty;
+    }
+    std::shared_ptr<SettingsMap> _map;
+};
+
 class RangeAccumulator
 {
     std::list<std::pair<int,int>> _ranges;
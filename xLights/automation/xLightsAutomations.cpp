@@ -410,35 +410,14 @@ bool xLightsFrame::ProcessAutomation(std::vector<std::string> &paths,
         FSEQFile* seq = FSEQFile::openFSEQFile(fseq);
         if (seq) {
             fpp->PrepareUploadSequence(*seq, fseq, m2, fseqType);
-            static const int FRAMES_TO_BUFFER = 50;
-            std::vector<std::vector<uint8_t>> frames(FRAMES_TO_BUFFER);
-            for (size_t x = 0; x < frames.size(); x++) {
-                frames[x].resize(seq->getMaxChannel() + 1);
+            std::list<FPP*> targets = { fpp };
+            // returns true if cancelled, encode and upload errors are added to the messages
+            size_t messageCount = fpp->messages.size();
+            res = !FPP::UploadSequence(targets, *seq, nullptr) && res;
+            if (fpp->messages.size() != messageCount) {
+                res = false;
             }
 
-            for (size_t frame = 0; frame < seq->getNumFrames(); frame++) {
-                int lastBuffered = 0;
-                size_t startFrame = frame;
-                //Read a bunch of frames so each parallel thread has more info to work with before returning out here
-                while (lastBuffered < FRAMES_TO_BUFFER && frame < seq->getNumFrames()) {
-                    FSEQFile::FrameData* f = seq->getFrame(frame);
-                    if (f != nullptr) {
-                        if (!f->readFrame(&frames[lastBuffered][0], frames[lastBuffered].size())) {
-                            //logger_base.error("FPPConnect FSEQ file corrupt.");
-                            res = false;
-                        }
-                        delete f;
-                    }
-                    lastBuffered++;
-                    frame++;
-                }
-                frame--;
-                for (int x = 0; x < lastBuffered; x++) {
-                    fpp->AddFrameToUpload(startFrame + x, &frames[x][0]);
-                }
-            }
-            fpp->FinalizeUploadSequence();
-
             if (fpp->fppType == FPP_TYPE::FALCONV4) {
                 // a falcon
                 std::string proxy = "";
@@ -763,6 +742,25 @@ bool xLightsFrame::ProcessAutomation(std::vector<std::string> &paths,
             return sendResponse(response, "", 200, true);
         }        
         return sendResponse("Export Video Preview Failed", "msg", 503, true);
+    } else if (cmd == "exportPreviewVideo") {
+        if (CurrentSeqXmlFile == nullptr) {
+            return sendResponse("Sequence not open.", "msg", 503, false);
+        }
+
+        auto filename = params["filename"];
+        if (filename == "" || filename == "null") {
+            filename = CurrentDir + wxFileName::GetPathSeparator() + CurrentSeqXmlFile->GetName() + ".mp4";
+        }
+        int view3d = -1;
+        if (!params["3d"].empty()) {
+            view3d = ReadBool(params["3d"]) ? 1 : 0;
+        }
+        auto const worked = ExportPreviewVideo(filename, wxAtoi(params["width"]), wxAtoi(params["height"]), view3d);
+        if (worked) {
+            std::string response = wxString::Format("{\"msg\":\"Export Preview Video.\",\"output\":\"%s\"}", JSONSafe(filename));
+            return sendResponse(response, "", 200, true);
+        }
+        return sendResponse("Export Preview Video Failed", "msg", 503, true);
     } else if (cmd == "runScript") {
         auto filename = params["filename"];
         if (filename.empty() || filename == "null" || !FileExists(filename)) {
@@ -13,6 +13,8 @@
 #include <map>
 #include <string.h>
 #include <cctype>
+#include <chrono>
+#include <future>
 #include <thread>
 
 #include <curl/curl.h>
@@ -70,7 +72,7 @@ static const std::string PIHAT("Pi Hat");
 static const std::string LEDPANELS("LED Panels");
 
 FPP::FPP(const std::string& ad) :
-    BaseController(ad, ""), majorVersion(0), minorVersion(0), outputFile(nullptr), parent(nullptr), ipAddress(ad), curl(nullptr), fppType(FPP_TYPE::FPP) {
+    BaseController(ad, ""), majorVersion(0), minorVersion(0), parent(nullptr), ipAddress(ad), curl(nullptr), fppType(FPP_TYPE::FPP) {
     wxIPV4address address;
     if (address.Hostname(ad)) {
         hostName = ad;
@@ -83,7 +85,7 @@ FPP::FPP(const std::string& ad) :
 
 
 FPP::FPP(const std::string& ip, const std::string& proxy, const std::string& model) :
-    BaseController(ip, proxy), majorVersion(0), minorVersion(0), outputFile(nullptr), parent(nullptr), curl(nullptr), fppType(FPP_TYPE::FPP) {
+    BaseController(ip, proxy), majorVersion(0), minorVersion(0), parent(nullptr), curl(nullptr), fppType(FPP_TYPE::FPP) {
     ipAddress = ip;
     pixelControllerType = model;
     wxIPV4address address;
@@ -96,21 +98,13 @@ FPP::FPP(const std::string& ip, const std::string& proxy, const std::string& mod
 }
 
 FPP::FPP(const FPP &c)
-    : majorVersion(c.majorVersion), minorVersion(c.minorVersion), outputFile(nullptr), parent(nullptr), curl(nullptr),
+    : majorVersion(c.majorVersion), minorVersion(c.minorVersion), parent(nullptr), curl(nullptr),
     hostName(c.hostName), description(c.description), ipAddress(c.ipAddress), fullVersion(c.fullVersion), platform(c.platform),
     model(c.model), ranges(c.ranges), mode(c.mode), pixelControllerType(c.pixelControllerType), username(c.username), password(c.password), fppType(c.fppType) {
 
 }
 
 FPP::~FPP() {
-    if (outputFile) {
-        delete outputFile;
-        outputFile = nullptr;
-    }
-    if (tempFileName != "") {
-        ::wxRemoveFile(tempFileName);
-        tempFileName = "";
-    }
     if (curl) {
         curl_easy_cleanup(curl);
         curl = nullptr;
@@ -124,7 +118,8 @@ void FPP::setIPAddress(const std::string &ip) {
 
 struct FPPWriteData {
     FPPWriteData() : file(nullptr), progress(nullptr), data(nullptr), dataSize(0), curPos(0),
-        postData(nullptr), postDataSize(0), totalWritten(0), cancelled(false), lastDone(0) {}
+        postData(nullptr), postDataSize(0), totalWritten(0), cancelled(false), lastDone(0),
+        bytesSent(nullptr), abort(nullptr) {}
 
     uint8_t *data;
     size_t dataSize;
@@ -141,6 +136,10 @@ struct FPPWriteData {
     size_t lastDone;
     bool cancelled;
 
+    // uploads running on a background thread report progress and are cancelled through these
+    std::atomic<uint64_t> *bytesSent;
+    const std::atomic_bool *abort;
+
     size_t readData(void *ptr, size_t buffer_size) {
         if (data != nullptr) {
             size_t remaining = dataSize - curPos;
@@ -181,6 +180,12 @@ struct FPPWriteData {
                     wxYield();
                 }
             }
+            if (bytesSent) {
+                *bytesSent += t;
+            }
+            if (abort && *abort) {
+                cancelled = true;
+            }
             if (file->Eof()) {
                 curPos = 0;
                 data = postData;
@@ -782,6 +787,8 @@ bool FPP::uploadFile(const std::string &filename, const std::string &file) {
     data.progress = progressDialog;
     data.progressString = "Transferring " + filename + " to " + ipAddress;
     data.lastDone = lastDone;
+    data.bytesSent = uploadBytesSent;
+    data.abort = uploadAbort;
 
     int i = curl_easy_perform(curl);
     curl_slist_free_all(chunk);
@@ -895,14 +902,8 @@ bool FPP::PrepareUploadSequence(const FSEQFile &file,
                                 const std::string &seq,
                                 const std::string &media,
                                 int type) {
-    if (outputFile) {
-        delete outputFile;
-        outputFile = nullptr;
-    }
-    if (tempFileName != "") {
-        ::wxRemoveFile(tempFileName);
-        tempFileName = "";
-    }
+    pendingSequence.reset();
+    sequenceFile.reset();
 
     wxFileName fn(seq);
     std::string baseName = fn.GetFullName();
@@ -934,9 +935,6 @@ bool FPP::PrepareUploadSequence(const FSEQFile &file,
     std::string fileName;
     if (IsDrive()) {
         fileName = ipAddress + wxFileName::GetPathSeparator() + "sequences" + wxFileName::GetPathSeparator() + baseName;
-    } else {
-        tempFileName = wxFileName::CreateTempFileName(baseName);
-        fileName = tempFileName;
     }
 
     FSEQFile::CompressionType ctype = ::FSEQFile::CompressionType::zstd;
@@ -1061,44 +1059,250 @@ bool FPP::PrepareUploadSequence(const FSEQFile &file,
             }
         }
     }
-    outputFile = FSEQFile::createFSEQFile(fileName, type == 0 ? 1 : 2, ctype, clevel);
-    outputFile->initializeFromFSEQ(file);
-    if (IsVersionAtLeast(5, 0)) {
-        outputFile->enableMinorVersionFeatures(1);
-    }
-    if (type >= 2 && !newRanges.empty()) {
-        for (auto &a : newRanges) {
-            ((V2FSEQFile*)outputFile)->m_sparseRanges.push_back(a);
-        }
+    // the file itself is generated by UploadSequence so it can be shared with other instances
+    pendingSequence = std::make_unique<PendingSequence>();
+    pendingSequence->fileName = fileName;
+    pendingSequence->version = type == 0 ? 1 : 2;
+    pendingSequence->compression = (int)ctype;
+    pendingSequence->compressionLevel = clevel;
+    pendingSequence->minorVersionFeatures = IsVersionAtLeast(5, 0);
+    if (type >= 2) {
+        pendingSequence->sparseRanges = newRanges;
     }
-    outputFile->writeHeader();
     return false;
 }
 
 bool FPP::WillUploadSequence() const {
-    return outputFile != nullptr;
+    return pendingSequence != nullptr;
 }
 
-bool FPP::AddFrameToUpload(uint32_t frame, uint8_t *data) {
-    if (outputFile) {
-        outputFile->addFrame(frame, data);
+std::string FPP::PendingSequence::GetKey() const {
+    if (fileName != "") {
+        // written straight to the drive so can't be shared
+        return fileName;
     }
-    return false;
+    std::string key = std::to_string(version) + ":" + std::to_string(compression) + ":" + std::to_string(compressionLevel) + ":" + std::to_string(minorVersionFeatures);
+    for (const auto& r : sparseRanges) {
+        key += ":" + std::to_string(r.first) + "-" + std::to_string(r.second);
+    }
+    return key;
 }
 
-bool FPP::FinalizeUploadSequence() {
-    bool cancelled = false;
-    if (outputFile) {
-        outputFile->finalize();
+// A generated sequence file shared by every instance it was generated for. Temp files are
+// removed once the last instance using it is done with it.
+class FPP::SharedSequenceFile {
+public:
+    SharedSequenceFile(const std::string& name, bool temp) : fileName(name), isTemp(temp) {}
+    ~SharedSequenceFile() {
+        if (isTemp) {
+            ::wxRemoveFile(fileName);
+        }
+    }
+
+    const std::string fileName;
+    const bool isTemp;
+};
+
+std::string FPP::GetTempFile() const {
+    if (sequenceFile && sequenceFile->isTemp) {
+        return sequenceFile->fileName;
+    }
+    return "";
+}
+
+void FPP::ClearTempFile() {
+    sequenceFile.reset();
+}
+
+// more than this and the players (and any proxy in front of them) start to struggle
+#define FPP_MAX_CONCURRENT_UPLOADS 8
 
-        delete outputFile;
-        outputFile = nullptr;
-        if (tempFileName != "" && (fppType == FPP_TYPE::FPP || fppType == FPP_TYPE::ESPIXELSTICK)) {
-            cancelled = uploadOrCopyFile(baseSeqName, tempFileName, "sequences");
-            ::wxRemoveFile(tempFileName);
-            tempFileName = "";
+bool FPP::UploadSequence(const std::list<FPP*>& instances, FSEQFile& file, wxProgressDialog* prgs) {
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    struct Encode {
+        const PendingSequence* settings = nullptr;
+        std::string seqName;
+        std::shared_ptr<SharedSequenceFile> sequenceFile;
+        FSEQFile* output = nullptr;
+        std::list<FPP*> targets;
+    };
+    std::list<Encode> encodes;
+    std::map<std::string, Encode*> encodesByKey;
+    int instanceCount = 0;
+    for (const auto& inst : instances) {
+        if (!inst->pendingSequence) {
+            continue;
+        }
+        instanceCount++;
+        std::string key = inst->pendingSequence->GetKey();
+        auto it = encodesByKey.find(key);
+        if (it == encodesByKey.end()) {
+            encodes.emplace_back();
+            encodes.back().settings = inst->pendingSequence.get();
+            encodes.back().seqName = inst->baseSeqName;
+            it = encodesByKey.emplace(key, &encodes.back()).first;
+        }
+        it->second->targets.push_back(inst);
+    }
+    if (encodes.empty()) {
+        return false;
+    }
+    const std::string seqName = encodes.front().seqName;
+    logger_base.debug("FPP Connect generating %d distinct sequence file(s) of %s for %d instance(s).",
+                      (int)encodes.size(), (const char*)seqName.c_str(), instanceCount);
+
+    for (auto& e : encodes) {
+        const PendingSequence& p = *e.settings;
+        std::string fileName = p.fileName;
+        if (fileName == "") {
+            fileName = wxFileName::CreateTempFileName(e.seqName);
         }
+        e.sequenceFile = std::make_shared<SharedSequenceFile>(fileName, p.fileName == "");
+        e.output = FSEQFile::createFSEQFile(fileName, p.version, (FSEQFile::CompressionType)p.compression, p.compressionLevel);
+        e.output->initializeFromFSEQ(file);
+        if (p.minorVersionFeatures) {
+            e.output->enableMinorVersionFeatures(1);
+        }
+        for (auto& a : p.sparseRanges) {
+            ((V2FSEQFile*)e.output)->m_sparseRanges.push_back(a);
+        }
+        e.output->writeHeader();
+    }
+
+    // read each frame once and feed it to all the files
+    bool cancelled = false;
+    if (prgs != nullptr) {
+        prgs->SetTitle("Generating FSEQ Files");
+        cancelled |= !prgs->Update(0, "Generating " + seqName);
+        prgs->Show();
+    }
+    int lastDone = 0;
+    bool corrupt = false;
+    static const int FRAMES_TO_BUFFER = 50;
+    std::vector<std::vector<uint8_t>> frames(FRAMES_TO_BUFFER);
+    for (size_t x = 0; x < frames.size(); x++) {
+        frames[x].resize(file.getMaxChannel() + 1);
+    }
+    for (size_t frame = 0; frame < file.getNumFrames() && !cancelled; frame++) {
+        int donePct = frame * 1000 / file.getNumFrames();
+        if (prgs != nullptr && donePct != lastDone) {
+            lastDone = donePct;
+            cancelled |= !prgs->Update(donePct, "Generating " + seqName);
+            wxYield();
+        }
+
+        int lastBuffered = 0;
+        size_t startFrame = frame;
+        //Read a bunch of frames so each parallel thread has more info to work with before returning out here
+        while (lastBuffered < FRAMES_TO_BUFFER && frame < file.getNumFrames()) {
+            FSEQFile::FrameData *f = file.getFrame(frame);
+            if (f != nullptr) {
+                if (!f->readFrame(&frames[lastBuffered][0], frames[lastBuffered].size())) {
+                    logger_base.error("FPPConnect FSEQ file corrupt.");
+                    corrupt = true;
+                }
+                delete f;
+            }
+            lastBuffered++;
+            frame++;
+        }
+        frame--;
+        std::function<void(Encode&, int)> func = [startFrame, lastBuffered, &frames](Encode& e, int) {
+            for (int x = 0; x < lastBuffered; x++) {
+                e.output->addFrame(startFrame + x, &frames[x][0]);
+            }
+        };
+        parallel_for(encodes, func);
+    }
+
+    if (corrupt) {
+        for (auto& e : encodes) {
+            for (const auto& inst : e.targets) {
+                inst->messages.push_back("ERROR - FSEQ file " + seqName + " is corrupt, some frames could not be read.");
+            }
+        }
+    }
+
+    // hand the finished files to the instances, queuing the ones we upload
+    struct UploadJob {
+        FPP* inst = nullptr;
+        std::string fileName;
+        bool cancelled = false;
+    };
+    std::vector<UploadJob> jobs;
+    uint64_t totalBytes = 0;
+    for (auto& e : encodes) {
+        e.output->finalize();
+        delete e.output;
+        e.output = nullptr;
+        for (const auto& inst : e.targets) {
+            inst->pendingSequence.reset();
+            if (cancelled) {
+                continue;
+            }
+            inst->sequenceFile = e.sequenceFile;
+            if (e.sequenceFile->isTemp && (inst->fppType == FPP_TYPE::FPP || inst->fppType == FPP_TYPE::ESPIXELSTICK)) {
+                jobs.push_back(UploadJob());
+                jobs.back().inst = inst;
+                jobs.back().fileName = e.sequenceFile->fileName;
+                totalBytes += wxFileName(e.sequenceFile->fileName).GetSize().GetValue();
+            }
+        }
+        e.settings = nullptr;
+    }
+    if (cancelled || jobs.empty()) {
+        return cancelled;
+    }
+
+    // each instance has its own curl handle so the uploads can run side by side, the
+    // progress dialog can only be updated from here though
+    std::atomic<uint64_t> bytesSent(0);
+    std::atomic_bool abort(false);
+    std::atomic_int nextJob(0);
+    std::vector<wxProgressDialog*> dialogs;
+    for (auto& j : jobs) {
+        dialogs.push_back(j.inst->progressDialog);
+        j.inst->progressDialog = nullptr;
+        j.inst->uploadBytesSent = &bytesSent;
+        j.inst->uploadAbort = &abort;
+    }
+    std::vector<std::future<void>> uploaders;
+    int threads = std::min((int)jobs.size(), FPP_MAX_CONCURRENT_UPLOADS);
+    for (int t = 0; t < threads; t++) {
+        uploaders.push_back(std::async(std::launch::async, [&jobs, &nextJob, &abort]() {
+            for (int j = nextJob++; j < (int)jobs.size() && !abort; j = nextJob++) {
+                jobs[j].cancelled = jobs[j].inst->uploadFile(jobs[j].inst->baseSeqName, jobs[j].fileName);
+            }
+        }));
+    }
+    if (prgs != nullptr) {
+        prgs->SetTitle("FPP Upload");
+        cancelled |= !prgs->Update(0, "Transferring " + seqName + " to " + std::to_string(jobs.size()) + " player(s)");
+    }
+    for (auto& u : uploaders) {
+        while (u.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready) {
+            if (prgs != nullptr && !cancelled) {
+                int donePct = totalBytes ? std::min((int)(bytesSent * 1000 / totalBytes), 999) : 0;
+                cancelled |= !prgs->Update(donePct);
+                wxYield();
+            }
+            if (cancelled) {
+                abort = true;
+            }
+        }
+    }
+    for (size_t x = 0; x < jobs.size(); x++) {
+        jobs[x].inst->progressDialog = dialogs[x];
+        jobs[x].inst->uploadBytesSent = nullptr;
+        jobs[x].inst->uploadAbort = nullptr;
+        jobs[x].inst->sequenceFile.reset();
+        cancelled |= jobs[x].cancelled;
+    }
+    if (prgs != nullptr) {
+        cancelled |= !prgs->Update(1000);
     }
+    logger_base.debug("FPP Connect uploaded %s to %d instance(s), %llu bytes.", (const char*)seqName.c_str(), (int)jobs.size(), (unsigned long long)totalBytes);
     return cancelled;
 }
 
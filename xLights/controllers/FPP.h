@@ -1,10 +1,13 @@
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <algorithm>
 #include <string>
+#include <vector>
 
 #include "../models/ModelManager.h"
 #include "ControllerUploadData.h"
@@ -26,7 +29,7 @@ class FPP : public BaseController
 {
     public:
     FPP() :
-            BaseController("", ""), majorVersion(0), minorVersion(0), outputFile(nullptr), parent(nullptr), curl(nullptr), fppType(FPP_TYPE::FPP) {}
+            BaseController("", ""), majorVersion(0), minorVersion(0), parent(nullptr), curl(nullptr), fppType(FPP_TYPE::FPP) {}
     FPP(const std::string &ip, const std::string &proxy, const std::string &model);
     FPP(const std::string &address);
     FPP(const FPP &c);
@@ -83,10 +86,13 @@ class FPP : public BaseController
                                const std::string &media,
                                int type);
     bool WillUploadSequence() const;
-    bool AddFrameToUpload(uint32_t frame, uint8_t *data);
-    bool FinalizeUploadSequence();
-    std::string GetTempFile() const { return tempFileName; }
-    void ClearTempFile() { tempFileName = ""; }
+    // Generates the sequence file for every instance PrepareUploadSequence decided needs one and
+    // uploads them. Instances needing an identical file (same version, compression and sparse
+    // ranges) share a single encode and the uploads to the different instances run concurrently.
+    // FxxV4 files are not uploaded, they are left in GetTempFile() for the Falcon upload.
+    static bool UploadSequence(const std::list<FPP*> &instances, FSEQFile &file, wxProgressDialog *prgs);
+    std::string GetTempFile() const;
+    void ClearTempFile();
 #endif
 
     bool UploadUDPOutputsForProxy(OutputManager* outputManager);
@@ -177,9 +183,26 @@ private:
         float duration = 0;
     };
     std::map<std::string, PlaylistEntry> sequences;
-    std::string tempFileName;
     std::string baseSeqName;
-    FSEQFile *outputFile = nullptr;
+
+    // how PrepareUploadSequence decided the sequence file needs to be generated
+    struct PendingSequence {
+        std::string fileName;           // written directly when on a drive, empty to use a temp file
+        int version = 2;
+        int compression = 0;            // FSEQFile::CompressionType
+        int compressionLevel = 2;
+        bool minorVersionFeatures = false;
+        std::vector<std::pair<uint32_t, uint32_t>> sparseRanges;
+
+        std::string GetKey() const;
+    };
+    class SharedSequenceFile;
+    std::unique_ptr<PendingSequence> pendingSequence;
+    std::shared_ptr<SharedSequenceFile> sequenceFile;
+
+    // set while uploading from a background thread in place of the progress dialog
+    std::atomic<uint64_t> *uploadBytesSent = nullptr;
+    const std::atomic_bool *uploadAbort = nullptr;
 
     void setupCurl();
     CURL *curl = nullptr;
@@ -879,55 +879,10 @@ void FPPConnectDialog::OnButton_UploadClick(wxCommandEvent& event)
                     row++;
                 }
                 if (!cancelled && uploadCount) {
-                    prgs.SetTitle("Generating FSEQ Files");
-                    cancelled |= !prgs.Update(0, "Generating " + wxFileName(fseq).GetFullName());
-                    prgs.Show();
-                    int lastDone = 0;
-                    static const int FRAMES_TO_BUFFER = 50;
-                    std::vector<std::vector<uint8_t>> frames(FRAMES_TO_BUFFER);
-                    for (size_t x = 0; x < frames.size(); x++) {
-                        frames[x].resize(seq->getMaxChannel() + 1);
-                    }
-
-                    for (size_t frame = 0; frame < seq->getNumFrames() && !cancelled; frame++) {
-                        int donePct = frame * 1000 / seq->getNumFrames();
-                        if (donePct != lastDone) {
-                            lastDone = donePct;
-                            cancelled |= !prgs.Update(donePct, "Generating " + wxFileName(fseq).GetFullName());
-                            wxYield();
-                        }
-
-                        int lastBuffered = 0;
-                        size_t startFrame = frame;
-                        //Read a bunch of frames so each parallel thread has more info to work with before returning out here
-                        while (lastBuffered < FRAMES_TO_BUFFER && frame < seq->getNumFrames()) {
-                            FSEQFile::FrameData *f = seq->getFrame(frame);
-                            if (f != nullptr)
-                            {
-                                if (!f->readFrame(&frames[lastBuffered][0], frames[lastBuffered].size()))
-                                {
-                                    logger_base.error("FPPConnect FSEQ file corrupt.");
-                                }
-                                delete f;
-                            }
-                            lastBuffered++;
-                            frame++;
-                        }
-                        frame--;
-                        std::function<void(FPP * &, int)> func = [startFrame, lastBuffered, &frames, &doUpload](FPP* &inst, int row) {
-                            if (doUpload[row]) {
-                                for (int x = 0; x < lastBuffered; x++) {
-                                    inst->AddFrameToUpload(startFrame + x, &frames[x][0]);
-                                }
-                            }
-                        };
-                        parallel_for(instances, func);
-                    }
+                    cancelled |= FPP::UploadSequence(instances, *seq, &prgs);
                     row = 0;
                     for (const auto &inst : instances) {
                         if (!cancelled && doUpload[row]) {
-                            cancelled |= inst->FinalizeUploadSequence();
-
                             if (inst->fppType == FPP_TYPE::FALCONV4) {
                                 // a falcon
                                 std::string proxy = "";
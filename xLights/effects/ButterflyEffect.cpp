@@ -23,6 +23,19 @@
 #include "../../include/butterfly-64.xpm"
 
 #include "../Parallel.h"
+#include "CoordinateField.h"
+
+#include <algorithm>
+
+class ButterflyRenderCache : public EffectRenderCache {
+public:
+    ButterflyRenderCache() {};
+    virtual ~ButterflyRenderCache() {};
+
+    CoordinateField field;
+    std::vector<float> rowSin; // sin((ry + time) / 2) for the current frame
+    std::vector<float> cy2;    // (ry + cos(time / 3) / 2)^2 for the current frame
+};
 
 ButterflyEffect::ButterflyEffect(int i) : RenderableEffect(i, "Butterfly", butterfly_16, butterfly_24, butterfly_32, butterfly_48, butterfly_64)
 {
@@ -100,213 +113,227 @@ void ButterflyEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuf
     const double offset = (ButterflyDirection==1 ? -1 : 1) * double(curState)/200.0;
     const int xc=buffer.BufferWi/2;
     const int yc=buffer.BufferHt/2;
+    // every cell is independent so cells without nodes can be skipped ... except style 10 which
+    // carries h from one cell to the next
+    const bool sparse = Style != 10 && buffer.CanRenderSparse();
+
+    ButterflyRenderCache *cache = static_cast<ButterflyRenderCache*>(buffer.infoCache[id]);
+    if (cache == nullptr) {
+        cache = new ButterflyRenderCache();
+        buffer.infoCache[id] = cache;
+    }
+
+    // plasma styles
+    const int state = (buffer.curPeriod - buffer.curEffStartPer); // frames 0 to N
+    const double Speed_plasma = (Style == 10) ? (101-butterFlySpeed)*3 : (101-butterFlySpeed)*5;
+    const float time = (state+1.0)/Speed_plasma;
+    const float sin_time_5 = FastTrig::sin(time/5);
+    const float cos_time_3 = FastTrig::cos(time/3);
+    const float sin_time_2 = FastTrig::sin(time/2);
+    const float vScale = 0.5 * Chunks * pi; // v / 2 and into radians for the colour maths
+    CoordinateField &field = cache->field;
+    xlColor plasmaBase;
+    if (Style > 5) {
+        if (!field.IsValid(buffer.BufferWi, buffer.BufferHt, buffer.BufferWi, -0.5f, buffer.BufferHt, -0.5f, 1.0f)) {
+            field.Build(buffer.BufferWi, buffer.BufferHt, buffer.BufferWi, -0.5f, buffer.BufferHt, -0.5f, 1.0f);
+        }
+
+        // the parts of the equations that only depend on the row
+        cache->rowSin.resize(field.GetStride());
+        cache->cy2.resize(field.GetStride());
+        for (int y = 0; y < field.GetStride(); y++) {
+            const float ry = field.ry[y];
+            const float cy = ry + .5f * cos_time_3;
+            cache->rowSin[y] = FastTrig::sin((ry + time) / 2.0f);
+            cache->cy2[y] = cy * cy;
+        }
+
+        // styles 6 to 9 replace the colour channels of the first palette colour
+        buffer.GetMultiColorBlend(0.0, false, plasmaBase);
+    }
+
+    // butterfly styles
+    const float f2 = (frame < maxframe/2) ? frame+1 : maxframe - frame;
+    const float f3 = f2*0.1+double(buffer.BufferHt)/60.0;
+    const float phase = offset;
+    const float step = pi2 / ((Style == 5) ? float(buffer.BufferHt*buffer.BufferWi) : float(buffer.BufferHt+buffer.BufferWi));
+
     int block = buffer.BufferHt * buffer.BufferWi > 100 ? 1 : -1;
-    parallel_for(0, buffer.BufferWi, [&buffer, Style, &xc, &yc, &offset, frame, maxframe, Chunks, colorcnt, Skip, ColorScheme, butterFlySpeed](int x) {
-        double  fractpart, intpart;
-        double h=0.0,hue1,hue2;
+    parallel_for(0, buffer.BufferWi, [&buffer, &field, cache, Style, Chunks, colorcnt, Skip, ColorScheme, sparse,
+                                      time, sin_time_5, cos_time_3, sin_time_2, vScale, &plasmaBase, f2, f3, phase, step](int x) {
+        const int BufferHt = buffer.BufferHt;
+        // h carries from cell to cell down a column for style 10
+        float h = 0.0f;
         xlColor color;
         HSVValue hsv;
-        int y, d, x0, y0;
-        double n,x1,y1,f;
-        double rx,ry,cx,cy,v,time,multiplier;
-
-        for (y=0; y<buffer.BufferHt; y++)
-        {
-            switch (Style)
-            {
-                case 1:
-                    //  http://mathworld.wolfram.com/ButterflyFunction.html
-                    n = std::abs((x*x - y*y) * buffer.sin (offset + ((x+y)*pi2 / float(buffer.BufferHt+buffer.BufferWi))));
-                    d = x*x + y*y;
-                    
-                    //  This section is to fix the colors on pixels at {0,1} and {1,0}
-                    x0=x+1;
-                    y0=y+1;
-                    if((x==0 && y==1))
-                    {
-                        n = std::abs((x*x - y0*y0) * buffer.sin (offset + ((x+y0)*pi2 / float(buffer.BufferHt+buffer.BufferWi))));
-                        d = x*x + y0*y0;
-                    }
-                    if((x==1 && y==0))
-                    {
-                        n = std::abs((x0*x0 - y*y) * buffer.sin (offset + ((x0+y)*pi2 / float(buffer.BufferHt+buffer.BufferWi))));
-                        d = x0*x0 + y*y;
-                    }
-                    // end of fix
-                    
-                    h=d>0.001 ? n/d : 0.0;
-                    break;
-                    
-                case 2:
-                    f=(frame < maxframe/2) ? frame+1 : maxframe - frame;
-                    x1=(double(x)-buffer.BufferWi/2.0)/f;
-                    y1=(double(y)-buffer.BufferHt/2.0)/f;
-                    h=sqrt(x1*x1+y1*y1);
-                    break;
-                    
-                case 3:
-                    f=(frame < maxframe/2) ? frame+1 : maxframe - frame;
-                    f=f*0.1+double(buffer.BufferHt)/60.0;
-                    x1 = (x-buffer.BufferWi/2.0)/f;
-                    y1 = (y-buffer.BufferHt/2.0)/f;
-                    h=buffer.sin(x1) * buffer.cos(y1);
-                    break;
-                    
-                case 4:
-                    //  http://mathworld.wolfram.com/ButterflyFunction.html
-                    n = ((x*x - y*y) * buffer.sin (offset + ((x+y)*pi2 / float(buffer.BufferHt+buffer.BufferWi))));
-                    d = x*x + y*y;
-                    
-                    //  This section is to fix the colors on pixels at {0,1} and {1,0}
-                    x0=x+1;
-                    y0=y+1;
-                    if((x==0 && y==1))
-                    {
-                        n = ((x*x - y0*y0) * buffer.sin (offset + ((x+y0)*pi2 / float(buffer.BufferHt+buffer.BufferWi))));
-                        d = x*x + y0*y0;
-                    }
-                    if((x==1 && y==0))
-                    {
-                        n = ((x0*x0 - y*y) * buffer.sin (offset + ((x0+y)*pi2 / float(buffer.BufferHt+buffer.BufferWi))));
-                        d = x0*x0 + y*y;
-                    }
-                    // end of fix
-                    
-                    h=d>0.001 ? n/d : 0.0;
-                    fractpart = modf (h , &intpart);
-                    h=fractpart;
-                    if(h<0) h=1.0+h;
-                    break;
-                    
-                case 5:
-                    //  http://mathworld.wolfram.com/ButterflyFunction.html
-                    n = std::abs((x*x - y*y) * buffer.sin (offset + ((x+y)*pi2 / float(buffer.BufferHt*buffer.BufferWi))));
-                    d = x*x + y*y;
-                    
-                    //  This section is to fix the colors on pixels at {0,1} and {1,0}
-                    x0=x+1;
-                    y0=y+1;
-                    if((x==0 && y==1))
-                    {
-                        n = std::abs((x*x - y0*y0) * buffer.sin (offset + ((x+y0)*pi2 / float(buffer.BufferHt*buffer.BufferWi))));
-                        d = x*x + y0*y0;
-                    }
-                    if((x==1 && y==0))
-                    {
-                        n = std::abs((x0*x0 - y*y) * buffer.sin (offset + ((x0+y)*pi2 / float(buffer.BufferHt*buffer.BufferWi))));
-                        d = x0*x0 + y*y;
+        hsv.saturation = 1.0;
+        hsv.value = 1.0;
+
+        // cells are evaluated a block of a column at a time in plain loops over arrays with
+        // no table lookups or branches so the compiler can vectorise them
+        float v[COORDINATE_FIELD_BLOCK];
+        float c1[COORDINATE_FIELD_BLOCK];
+        float c2[COORDINATE_FIELD_BLOCK];
+        float c3[COORDINATE_FIELD_BLOCK];
+        for (int y0 = 0; y0 < BufferHt; y0 += COORDINATE_FIELD_BLOCK) {
+            const int n = std::min(COORDINATE_FIELD_BLOCK, BufferHt - y0);
+
+            if (Style <= 5) {
+                switch (Style) {
+                    case 1:
+                    case 4:
+                    case 5:
+                        for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                            //  http://mathworld.wolfram.com/ButterflyFunction.html
+                            //  pixels {0,1} and {1,0} take their colour from {0,2} and {2,0}
+                            const int y = y0 + i;
+                            const int xx = x + ((x == 1) & (y == 0));
+                            const int yy = y + ((x == 0) & (y == 1));
+                            const int d = xx*xx + yy*yy;
+                            const float nn = (xx*xx - yy*yy) * FastTrig::sin(phase + (xx+yy)*step);
+                            v[i] = nn / (float)(d + (d == 0)); // nn is 0 where d is
+                        }
+                        if (Style == 4) {
+                            for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                                const float fract = v[i] - (float)(int)v[i];
+                                v[i] = fract + (float)(fract < 0);
+                            }
+                        } else {
+                            for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                                v[i] = std::abs(v[i]);
+                            }
+                        }
+                        break;
+
+                    case 2: {
+                        const float x1 = (float(x)-buffer.BufferWi/2.0f)/f2;
+                        for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                            const float y1 = (float(y0 + i)-BufferHt/2.0f)/f2;
+                            v[i] = std::sqrt(x1*x1+y1*y1);
+                        }
+                        break;
                     }
-                    // end of fix
-                    
-                    h=d>0.001 ? n/d : 0.0;
-                    break;
-                    
-            }
-            if(Style<=5)
-            {
-                
-                
-                hsv.saturation=1.0;
-                hsv.value=1.0;
-                if (Chunks <= 1 || int(h*Chunks) % Skip != 0)
-                {
-                    if (ColorScheme == 0)
-                    {
-                        hsv.hue=h;
-                        buffer.SetPixel(x,y,hsv);
+
+                    case 3: {
+                        const float sinx1 = FastTrig::sin((x-buffer.BufferWi/2.0f)/f3);
+                        for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                            v[i] = sinx1 * FastTrig::cos((y0 + i - BufferHt/2.0f)/f3);
+                        }
+                        break;
                     }
-                    else
-                    {
-                        buffer.GetMultiColorBlend(h,false,color);
-                        buffer.SetPixel(x,y,color);
+                }
+
+                for (int i = 0; i < n; i++) {
+                    const int y = y0 + i;
+                    if (sparse && !buffer.IsCellOccupied(x, y)) continue;
+
+                    h = v[i];
+                    if (Chunks <= 1 || int(h*Chunks) % Skip != 0) {
+                        if (ColorScheme == 0) {
+                            hsv.hue = h;
+                            buffer.SetPixel(x, y, hsv);
+                        } else {
+                            buffer.GetMultiColorBlend(h, false, color);
+                            buffer.SetPixel(x, y, color);
+                        }
                     }
                 }
+                continue;
+            }
+
+            // Plasma
+            // reference: http://www.bidouille.org/prog/plasma
+            const float rx = field.rx[x];
+            const float cx = rx + .5f * sin_time_5;
+            const float cx2 = cx * cx;
+            const float rxs = rx * sin_time_2;
+            const float v1 = FastTrig::sin(rx*10 + time) + FastTrig::sin(rx + time);
+            const float *ry = field.ry.data() + y0;
+            const float *radius = field.Radius(x) + y0;
+            const float *rowSin = cache->rowSin.data() + y0;
+            const float *cy2 = cache->cy2.data() + y0;
+
+            // kept apart as sqrt may set errno which stops some compilers vectorising the loop
+            for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                c1[i] = std::sqrt(100*(cx2 + cy2[i]) + 1 + time);
             }
-            else  // Plasma
-            {
-                // reference: http://www.bidouille.org/prog/plasma
-                
-                int state = (buffer.curPeriod - buffer.curEffStartPer); // frames 0 to N
-                double Speed_plasma = (Style == 10) ? (101-butterFlySpeed)*3 : (101-butterFlySpeed)*5;
-                time = (state+1.0)/Speed_plasma;
-                
-                v=0;
-                
-                rx = ((float)x/buffer.BufferWi) -0.5;
-                ry = ((float)y/buffer.BufferHt) -0.5;
-                
-                
-                
+            for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
                 // 1st equation
-                v=buffer.sin(rx*10+time);
-                
+                float vv = v1;
                 //  second equation
-                v+=buffer.sin(10*(rx*buffer.sin(time/2)+ry*buffer.cos(time/3))+time);
-                
+                vv += FastTrig::sin(10*(rxs + ry[i]*cos_time_3) + time);
                 //  third equation
-                cx=rx+.5*buffer.sin(time/5);
-                cy=ry+.5*buffer.cos(time/3);
-                v+=buffer.sin ( sqrt(100*((cx*cx)+(cy*cy))+1+time));
-                
-                
+                vv += FastTrig::sin(c1[i]);
                 //    vec2 c = v_coords * u_k - u_k/2.0;
-                v += buffer.sin(rx+time);
-                v += buffer.sin((ry+time)/2.0);
-                v += buffer.sin((rx+ry+time)/2.0);
+                vv += rowSin[i];
+                vv += FastTrig::sin((rx + ry[i] + time)/2.0f);
                 //   c += u_k/2.0 * vec2(sin(u_time/3.0), cos(u_time/2.0));
-                v += buffer.sin(sqrt(rx*rx+ry*ry+1.0)+time);
-                v = v/2.0;
+                vv += FastTrig::sin(radius[i] + time);
                 // vec3 col = vec3(1, sin(PI*v), cos(PI*v));
                 //   gl_FragColor = vec4(col*.5 + .5, 1);
-                
-                buffer.GetMultiColorBlend(h,false,color);
-                //color.red=color.green=color.blue=h*255;
-                switch (Style)
-                {
+                v[i] = vv * vScale;
+            }
+
+            switch (Style) {
+                case 6:
+                case 7:
+                    for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                        c1[i] = FastTrig::ToChannel(FastTrig::sin(v[i]));
+                        c2[i] = FastTrig::ToChannel(FastTrig::cos(v[i]));
+                    }
+                    break;
+                case 8:
+                    for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                        c1[i] = FastTrig::ToChannel(FastTrig::sin(v[i]));
+                        c2[i] = FastTrig::ToChannel(FastTrig::sin(v[i] + 2*pi/3));
+                        c3[i] = FastTrig::ToChannel(FastTrig::sin(v[i] + 4*pi/3));
+                    }
+                    break;
+                case 9:
+                    for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                        c1[i] = FastTrig::ToChannel(FastTrig::sin(v[i]));
+                    }
+                    break;
+                case 10:
+                    for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                        c1[i] = FastTrig::sin(v[i] + 2*pi/3)+1*0.5;
+                    }
+                    break;
+            }
+
+            for (int i = 0; i < n; i++) {
+                const int y = y0 + i;
+                if (sparse && !buffer.IsCellOccupied(x, y)) continue;
+
+                color = plasmaBase;
+                switch (Style) {
                     case 6:
-                        color.red = (buffer.sin(v*Chunks*pi)+1)*128;
-                        color.green= (buffer.cos(v*Chunks*pi)+1)*128;
-                        color.blue =0;
+                        color.red = c1[i];
+                        color.green = c2[i];
+                        color.blue = 0;
                         break;
                     case 7:
                         color.red = 1;
-                        color.green= (buffer.cos(v*Chunks*pi)+1)*128;
-                        color.blue =(buffer.sin(v*Chunks*pi)+1)*128;
+                        color.green = c2[i];
+                        color.blue = c1[i];
                         break;
-                        
                     case 8:
-                        color.red = (buffer.sin(v*Chunks*pi)+1)*128;
-                        color.green= (buffer.sin(v*Chunks*pi + 2*pi/3)+1)*128;
-                        color.blue =(buffer.sin(v*Chunks*pi+4*pi/3)+1)*128;
+                        color.red = c1[i];
+                        color.green = c2[i];
+                        color.blue = c3[i];
                         break;
-                        
                     case 9:
-                        color.red=color.green=color.blue=(buffer.sin(v*Chunks*pi) +1) * 128;
+                        color.red = color.green = color.blue = c1[i];
                         break;
                     case 10:
-                        if(colorcnt>=2)
-                        {
-                            buffer.GetMultiColorBlend(h,false,color);
-                            
-                            hue1=.1;
-                            hue1=0;
-                            hue2=.7;
-                            hue2=1;
-                            multiplier=(hue2-hue1)/2;
-                            h=hue1+ multiplier*(v+1); // v is between -1 to 1. h
-                            h = buffer.sin(v*Chunks*pi+2*pi/3)+1*0.5;
-                            
-                            hsv.hue=h;
-                            //  hsv.hue=hsv.hue + (v+1)/20.0;
-                            //color.red = (buffer.sin(v*color.red)+1)*128;
-                            //color.green = (buffer.sin(v*color.green)+1)*128;
-                            //color.blue = (buffer.sin(v*color.blue)+1)*128;
-                            
+                        // each cell takes its colour from the h of the cell before it
+                        buffer.GetMultiColorBlend(h, false, color);
+                        if (colorcnt >= 2) {
+                            h = c1[i];
                         }
                         break;
                 }
-                
-                buffer.SetPixel(x,y,color);
+                buffer.SetPixel(x, y, color);
             }
         }
     }, block);
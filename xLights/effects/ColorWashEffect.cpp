@@ -177,6 +177,7 @@ void ColorWashEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuf
         double HalfHt=double(endY - startY)/2.0;
         double HalfWi=double(endX - startX)/2.0;
 
+        const bool sparse = buffer.CanRenderSparse();
         orig = color;
         HSVValue hsvOrig = color.asHSV();
         xlColor color2 = color;
@@ -198,6 +199,7 @@ void ColorWashEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuf
 
             color2.alpha = color.alpha;
             for (y=startY; y<=endY; y++) {
+                if (sparse && !buffer.IsCellOccupied(x, y)) continue;
                 if (VertFade) {
                     if (buffer.allowAlpha) {
                         color.alpha = (double)color2.alpha*(1.0-std::abs(HalfHt-(y-startY))/HalfHt);
@@ -0,0 +1,126 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Inline polynomial sine/cosine for per pixel effect maths.
+// The argument is reduced to [-pi/2, pi/2] and a degree 9 odd polynomial evaluated. There
+// are no table lookups or data dependent branches so loops over a row of cells calling
+// these can be vectorised by the compiler. Absolute error stays under MAX_ERROR for
+// arguments within +/-1000 radians, well inside the 1/600 radian step of the
+// RenderBuffer sine table these replace in the hot loops.
+namespace FastTrig
+{
+    constexpr float MAX_ERROR = 1.0e-4f;
+
+    inline float sin(float a)
+    {
+        // Cody-Waite reduction by 2pi split into an exact high part and a small correction.
+        // The nearest multiple comes from a truncating conversion as that vectorises where
+        // nearbyint may not.
+        const float q = a * 0.159154943f;
+        const float k = (float)(int)(q + std::copysign(0.5f, q));
+        float z = a - k * 6.28125f;
+        z -= k * 1.93530717e-3f;
+
+        // fold [-pi, pi] onto [-pi/2, pi/2] as sin(pi - z) == sin(z) ... blended rather
+        // than selected so the compiler doesn't need to if-convert it
+        const float fold = (float)(std::fabs(z) > 1.57079633f);
+        z += fold * (std::copysign(3.14159265f, z) - 2.0f * z);
+
+        const float z2 = z * z;
+        return z * (1.0f + z2 * (-1.66666667e-1f + z2 * (8.33333333e-3f + z2 * (-1.98412698e-4f + z2 * 2.75573192e-6f))));
+    }
+
+    inline float cos(float a)
+    {
+        return sin(a + 1.57079633f);
+    }
+
+    // Scales a sine in [-1, 1] to a 0-255 colour channel the way the effects always have,
+    // clamped as unlike the old table these can reach 1.0 and 256 would wrap the byte
+    inline float ToChannel(float s)
+    {
+        return std::min((s + 1.0f) * 128.0f, 255.0f);
+    }
+}
+
+// Cells are evaluated in blocks of this many down a column. Fields pad each column to a
+// whole number of blocks so block loops can always run the full count, giving the compiler
+// a fixed trip count to vectorise with no remainder handling.
+#define COORDINATE_FIELD_BLOCK 64
+
+// Normalised coordinates of every cell of a buffer for the plasma style effects.
+// rx/ry hold the per column/row coordinate (x / xDivisor + xOffset) and radius the per
+// cell sqrt(rx^2 + ry^2 + radiusBias). They only depend on the buffer size and mapping
+// so are built once and reused every frame rather than recomputed per pixel. radius is
+// stored column by column, GetStride() apart, to match the column parallel render loops.
+class CoordinateField
+{
+public:
+    bool IsValid(int width, int height, float xDivisor, float xOffset, float yDivisor, float yOffset, float radiusBias) const
+    {
+        return _width == width && _height == height && _xDivisor == xDivisor && _xOffset == xOffset &&
+               _yDivisor == yDivisor && _yOffset == yOffset && _radiusBias == radiusBias;
+    }
+
+    void Build(int width, int height, float xDivisor, float xOffset, float yDivisor, float yOffset, float radiusBias)
+    {
+        _width = width;
+        _height = height;
+        _xDivisor = xDivisor;
+        _xOffset = xOffset;
+        _yDivisor = yDivisor;
+        _yOffset = yOffset;
+        _radiusBias = radiusBias;
+
+        _stride = (height + COORDINATE_FIELD_BLOCK - 1) / COORDINATE_FIELD_BLOCK * COORDINATE_FIELD_BLOCK;
+
+        rx.resize(width);
+        ry.resize(_stride);
+        radius.resize((size_t)width * _stride);
+        for (int x = 0; x < width; ++x) {
+            rx[x] = (float)x / xDivisor + xOffset;
+        }
+        for (int y = 0; y < _stride; ++y) {
+            ry[y] = (float)y / yDivisor + yOffset;
+        }
+        for (int x = 0; x < width; ++x) {
+            float* col = &radius[(size_t)x * _stride];
+            const double rx2 = (double)rx[x] * rx[x];
+            for (int y = 0; y < _stride; ++y) {
+                col[y] = std::sqrt(rx2 + (double)ry[y] * ry[y] + radiusBias);
+            }
+        }
+    }
+
+    int GetWidth() const { return _width; }
+    int GetHeight() const { return _height; }
+    int GetStride() const { return _stride; }
+    const float* Radius(int x) const { return &radius[(size_t)x * _stride]; }
+
+    std::vector<float> rx;
+    std::vector<float> ry;
+    std::vector<float> radius;
+
+private:
+    int _width = -1;
+    int _height = -1;
+    int _stride = 0;
+    float _xDivisor = 0.0f;
+    float _xOffset = 0.0f;
+    float _yDivisor = 0.0f;
+    float _yOffset = 0.0f;
+    float _radiusBias = 0.0f;
+};
@@ -23,6 +23,7 @@
 #include "../xLightsMain.h" 
 #include "PicturesEffect.h"
 #include "../ExternalHooks.h"
+#include "../ImageAssetCache.h"
 
 #include <wx/tokenzr.h>
 
@@ -200,11 +201,10 @@ std::list<std::string> FacesEffect::CheckEffectSettings(const SettingsMap& setti
                     }
 
                     if (FileExists(picture)) {
-                        wxImage i;
-                        i.LoadFile(picture);
-                        if (i.IsOk()) {
-                            int ih = i.GetHeight();
-                            int iw = i.GetWidth();
+                        auto i = ImageAssetCache::Instance().GetImage(picture);
+                        if (i != nullptr) {
+                            int ih = i->GetHeight();
+                            int iw = i->GetWidth();
 
 #define IMAGESIZETHRESHOLD 10
                             if (ih > IMAGESIZETHRESHOLD * model->GetDefaultBufferHt() || iw > IMAGESIZETHRESHOLD * model->GetDefaultBufferWi()) {
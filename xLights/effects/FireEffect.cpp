@@ -163,6 +163,7 @@ class FireRenderCache : public EffectRenderCache {
 public:
     FireRenderCache() {};
     virtual ~FireRenderCache() {};
+    virtual EffectRenderCache* Checkpoint() const override { return new FireRenderCache(*this); }
 
     std::vector<int> FireBuffer;
 };
@@ -18,6 +18,7 @@
 #include "../models/Model.h"
 #include "../UtilFunctions.h"
 #include "../sequencer/SequenceElements.h"
+#include "ParticleSystem.h"
 
 #include "../../include/fireworks-16.xpm"
 #include "../../include/fireworks-24.xpm"
@@ -56,13 +57,14 @@ xlEffectPanel *FireworksEffect::CreatePanel(wxWindow *parent) {
     return new FireworksPanel(parent);
 }
 
-class FireworkParticle
+// One explosion. Its particles live in the render cache's particle pool, tagged with the
+// firework's index, in the order the fireworks were launched.
+class Firework
 {
-    const int _maxFade = 100;
-    double _x;
-    double _y;
-    double _vx;
-    double _vy;
+    const int _maxCycles = 500;
+    int _cycles = 0;
+    bool _done = false;
+    int _particles = 0;
     int _fade;
     bool _gravity;
     HSVValue _startColour;
@@ -71,15 +73,13 @@ class FireworkParticle
     int _width;
     int _height;
     double _fps;
-    int _age = 0;
 
 public:
-    FireworkParticle(int x, int y, double vx, double vy, int fade, bool gravity, int colourIndex, bool holdColour, double velocity, int width, int height, int frameMS, const PaletteClass& palette)
+    Firework(ParticleSystem& pool, int tag, int particles, int x, int y, double vx, double vy, int fade, bool gravity, int colourIndex, bool holdColour, double velocity, int width, int height, int frameMS, const PaletteClass& palette)
     {
+        _particles = particles;
         _width = width;
         _height = height;
-        _x = x;
-        _y = y;
         _fade = fade;
         _gravity = gravity;
         _colourIndex = colourIndex;
@@ -92,118 +92,78 @@ public:
 
         _fps = 1000.0 / frameMS;
 
-        double explosionVelocity = (rand() - RAND_MAX / 2)*velocity / (RAND_MAX / 2);
-        double angle = 2 * M_PI*rand() / RAND_MAX;
-        _vx = 3.0 * vx / 100 + explosionVelocity * cos(angle);
-        _vy = 3.0 * -vy / 100 + explosionVelocity * sin(angle);
+        for (int i = 0; i < particles; i++)
+        {
+            double explosionVelocity = (rand() - RAND_MAX / 2)*velocity / (RAND_MAX / 2);
+            double angle = 2 * M_PI*rand() / RAND_MAX;
+            pool.Emit(x, y,
+                      3.0 * vx / 100 + explosionVelocity * cos(angle),
+                      3.0 * -vy / 100 + explosionVelocity * sin(angle),
+                      _startColour, tag);
+        }
     }
 
-    virtual ~FireworkParticle() {}
+    // number of this firework's particles in the pool
+    int GetParticleCount() const { return _particles; }
+    void ParticlesRemoved() { _particles = 0; }
+    bool IsDone() const { return _done; }
 
-    bool Done() const
+    bool ParticleDone(const ParticleSystem& pool, size_t i) const
     {
-        return (_fade < _age * 2 || _x < 0 || _y < 0 || _x > _width || (!_gravity && _y > _height));
+        return (_fade < pool.age[i] * 2 || pool.x[i] < 0 || pool.y[i] < 0 || pool.x[i] > _width || (!_gravity && pool.y[i] > _height));
     }
 
-    void Advance()
+    bool AllGone(const ParticleSystem& pool, size_t first) const
     {
-        _x += _vx;
-        if (_gravity)
+        for (size_t i = first; i < first + _particles; i++)
         {
-            _vy += 0.98 / _fps;
+            if (!ParticleDone(pool, i)) return false;
         }
-        _y += -_vy;
-        _age++;
+        return true;
     }
 
-    int GetX() const { return _x; }
-    int GetY() const { return _y; }
+    bool Done(const ParticleSystem& pool, size_t first)
+    {
+        if (!_done && (_cycles >= _maxCycles || AllGone(pool, first))) _done = true;
+        return _done;
+    }
 
-    xlColor GetColour(const PaletteClass& palette, bool alpha) const
+    void Advance(ParticleSystem& pool, size_t first)
     {
-        double v = ((10.0*_fade) - _age * 20.0) / (10.0*_fade);
-        if (v < 0.0) v = 0.0;
+        _cycles++;
 
-        HSVValue cv = _startColour;
-        if (_holdColour)
+        for (size_t i = first; i < first + _particles; i++)
         {
-            if (alpha)
+            pool.x[i] += pool.vx[i];
+            if (_gravity)
             {
-                xlColor c(cv);
-                c.alpha = 255.0 *v;
-                return c;
-            }
-            else
-            {
-                cv.value = v;
-                return xlColor(cv);
-            }
-        }
-        else
-        {
-            palette.GetHSV(_colourIndex, cv);
-            if (alpha)
-            {
-                xlColor c(cv);
-                c.alpha = 255.0 * v;
-                return c;
-            }
-            else
-            {
-                cv.value = v;
-                return xlColor(cv);
+                pool.vy[i] += 0.98 / _fps;
             }
+            pool.y[i] += -pool.vy[i];
+            pool.age[i]++;
         }
-    }
-};
 
-class Firework
-{
-    const int _maxCycles = 500;
-    int _cycles = 0;
-    mutable bool _done = false;
-    std::vector<FireworkParticle> _particles;
-
-public:
-    Firework(int particles, int x, int y, double vx, double vy, int fade, bool gravity, int colourIndex, bool holdColour, double velocity, int width, int height, int frameMS, const PaletteClass& palette)
-    {
-        _cycles = 0;
-        for (int i = 0; i < particles; i++)
-        {
-            _particles.push_back(FireworkParticle(x, y, vx, vy, fade, gravity, colourIndex, holdColour, velocity, width, height, frameMS, palette));
-        }
-    }
-
-    const std::vector<FireworkParticle>& GetParticles() const {
-        return _particles;
+        Done(pool, first);
     }
 
-    void Advance()
+    xlColor GetColour(const ParticleSystem& pool, size_t i, const PaletteClass& palette, bool alpha) const
     {
-        _cycles++;
+        double v = ((10.0*_fade) - pool.age[i] * 20.0) / (10.0*_fade);
+        if (v < 0.0) v = 0.0;
 
-        for (auto& it : _particles)
+        HSVValue cv = _startColour;
+        if (!_holdColour)
         {
-            it.Advance();
+            palette.GetHSV(_colourIndex, cv);
         }
-
-        if (Done()) _particles.clear();
-    }
-
-    bool AllGone() const
-    {
-        for (const auto& it : _particles)
+        if (alpha)
         {
-            if (!it.Done()) return false;
+            xlColor c(cv);
+            c.alpha = 255.0 *v;
+            return c;
         }
-
-        _done = true;
-        return true;
-    }
-
-    bool Done() const
-    {
-        return _done || _cycles >= _maxCycles || AllGone();
+        cv.value = v;
+        return xlColor(cv);
     }
 };
 
@@ -211,8 +171,11 @@ class FireworksRenderCache : public EffectRenderCache {
 public:
     FireworksRenderCache() {};
     virtual ~FireworksRenderCache() {};
+    virtual EffectRenderCache* Checkpoint() const override { return new FireworksRenderCache(*this); }
     int _sinceLastTriggered = 0;
-    std::list<Firework> _fireworks;
+    // finished fireworks stay in the list with no particles so particle tags stay valid
+    std::vector<Firework> _fireworks;
+    ParticleSystem _particles;
     std::vector<int> _firePeriods;
 };
 
@@ -375,6 +338,7 @@ void FireworksEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuf
 
     auto& sinceLastTriggered = cache->_sinceLastTriggered;
     auto& fireworks = cache->_fireworks;
+    auto& particles = cache->_particles;
     auto& firePeriods = cache->_firePeriods;
 
     size_t colorcnt = buffer.GetColorCount();
@@ -406,7 +370,7 @@ void FireworksEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuf
             {
                 auto location = GetFireworkLocation(buffer.BufferWi, buffer.BufferHt, xLocation, yLocation);
                 int colourIndex = rand() % colorcnt;
-                fireworks.push_back(Firework(particleCount,
+                fireworks.push_back(Firework(particles, fireworks.size(), particleCount,
                     location.first, location.second,
                     xVelocity, yVelocity,
                     fade, gravity,
@@ -455,7 +419,7 @@ void FireworksEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuf
                     {
                         auto location = GetFireworkLocation(buffer.BufferWi, buffer.BufferHt, xLocation, yLocation);
                         int colourIndex = rand() % colorcnt;
-                        fireworks.push_back(Firework(particleCount,
+                        fireworks.push_back(Firework(particles, fireworks.size(), particleCount,
                             location.first, location.second,
                             xVelocity, yVelocity,
                             fade, gravity,
@@ -478,7 +442,7 @@ void FireworksEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuf
             {
                 auto location = GetFireworkLocation(buffer.BufferWi, buffer.BufferHt, xLocation, yLocation);
                 int colourIndex = rand() % colorcnt;
-                fireworks.push_back(Firework(particleCount,
+                fireworks.push_back(Firework(particles, fireworks.size(), particleCount,
                     location.first, location.second,
                     xVelocity, yVelocity,
                     fade, gravity,
@@ -490,16 +454,30 @@ void FireworksEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuf
         }
     }
 
-    for (auto& it: fireworks)
+    size_t first = 0;
+    bool finished = false;
+    for (auto& it : fireworks)
     {
-        if (!it.Done())
+        if (it.GetParticleCount() > 0 && !it.Done(particles, first))
         {
-            for (auto p : it.GetParticles())
+            for (size_t i = first; i < first + it.GetParticleCount(); i++)
             {
-                buffer.SetPixel(p.GetX(), p.GetY(), p.GetColour(buffer.palette, buffer.allowAlpha));
+                buffer.SetPixel((int)particles.x[i], (int)particles.y[i], it.GetColour(particles, i, buffer.palette, buffer.allowAlpha));
             }
 
-            it.Advance();
+            it.Advance(particles, first);
+        }
+        finished |= it.GetParticleCount() > 0 && it.Done(particles, first);
+        first += it.GetParticleCount();
+    }
+
+    if (finished)
+    {
+        // drop the particles of fireworks that are done, everything else keeps its order
+        particles.Kill([&fireworks, &particles](size_t i) { return fireworks[particles.tag[i]].IsDone(); });
+        for (auto& it : fireworks)
+        {
+            if (it.GetParticleCount() > 0 && it.IsDone()) it.ParticlesRemoved();
         }
     }
 }
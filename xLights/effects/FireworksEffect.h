@@ -42,6 +42,7 @@ class FireworksEffect : public RenderableEffect
         virtual void SetDefaultParameters() override;
         virtual void SetPanelStatus(Model *cls) override;
         virtual void Render(Effect *effect, SettingsMap &settings, RenderBuffer &buffer) override;
+        virtual bool SupportsStateCheckpoints() const override { return true; }
         virtual std::list<std::string> CheckEffectSettings(const SettingsMap& settings, AudioManager* media, Model* model, Effect* eff, bool renderCache) override;
         virtual bool AppropriateOnNodes() const override { return false; }
 protected:
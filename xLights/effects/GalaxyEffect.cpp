@@ -155,6 +155,8 @@ void GalaxyEffect::Render(Effect* effect, SettingsMap& SettingsMap, RenderBuffer
         return;
     std::vector<std::vector<double>> temp_colors_pct(buffer.BufferWi, std::vector<double>(buffer.BufferHt, 0.0));
     std::vector<std::vector<double>> pixel_age(buffer.BufferWi, std::vector<double>(buffer.BufferHt, 0.0));
+    // the blend passes only touch each cell's own data so cells without nodes can be skipped
+    const bool sparse = buffer.CanRenderSparse();
 
     int num_colors = buffer.palette.Size();
     double eff_pos_adj = buffer.calcAccel(eff_pos, acceleration);
@@ -310,6 +312,7 @@ void GalaxyEffect::Render(Effect* effect, SettingsMap& SettingsMap, RenderBuffer
         if (blend_edges && ((inward ? (last_check - abs(adj_angle)) : (abs(adj_angle) - last_check)) >= 90.0)) {
             for (int x = 0; x < buffer.BufferWi; x++) {
                 for (int y = 0; y < buffer.BufferHt; y++) {
+                    if (sparse && !buffer.IsCellOccupied(x, y)) continue;
                     if (temp_colors_pct[x][y] > 0.0 && ((inward ? (pixel_age[x][y] - abs(adj_angle)) : (abs(adj_angle) - pixel_age[x][y])) >= 180.0)) {
                         xlColor c_new;
                         buffer.GetTempPixel(x, y, c_new);
@@ -386,8 +389,9 @@ void GalaxyEffect::Render(Effect* effect, SettingsMap& SettingsMap, RenderBuffer
 
     // blend remaining data down into final buffer
     if (blend_edges) {
-        parallel_for(0, buffer.BufferWi, [&buffer, &temp_colors_pct](int x) {
+        parallel_for(0, buffer.BufferWi, [&buffer, &temp_colors_pct, sparse](int x) {
             for (int y = 0; y < buffer.BufferHt; y++) {
+                if (sparse && !buffer.IsCellOccupied(x, y)) continue;
                 if (temp_colors_pct[x][y] > 0.0) {
                     xlColor c_new;
                     buffer.GetTempPixel(x, y, c_new);
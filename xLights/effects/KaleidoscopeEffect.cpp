@@ -27,6 +27,7 @@
 #include "UtilFunctions.h"
 
 #include "../Parallel.h"
+#include "../RemapTable.h"
 #include <log4cpp/Category.hh>
 
 KaleidoscopeEffect::KaleidoscopeEffect(int i) : RenderableEffect(i, "Kaleidoscope", kaleidoscope_16, kaleidoscope_24, kaleidoscope_32, kaleidoscope_48, kaleidoscope_64)
@@ -304,16 +305,15 @@ public:
 
     std::vector<std::vector<bool>> _startUsed;
     std::list<KaleidoscopeEdge> _edges;
+    // which pixel each pixel ends up copied from ... only depends on the geometry
+    RemapTable _remap;
 };
 
-bool KaleidoscopeEffect::KaleidoscopeDone(const std::vector<std::vector<bool>>& current)
+bool KaleidoscopeEffect::KaleidoscopeDone(const std::vector<uint8_t>& current)
 {
-    for (const auto& xx : current)
+    for (const auto used : current)
     {
-        for (const auto yy : xx)
-        {
-            if (!yy) return false;
-        }
+        if (!used) return false;
     }
     return true;
 }
@@ -379,36 +379,51 @@ void KaleidoscopeEffect::Render(Effect *eff, SettingsMap &SettingsMap, RenderBuf
         cache->Initialise(size, rotation, xCentre, yCentre, buffer.BufferWi, buffer.BufferHt, type, false);
     }
 
-    auto currentUsed = cache->_startUsed;
-    auto &edges = cache->_edges;
+    // type isnt part of the cache change check so it goes in the table key
+    std::vector<double> key = { (double)size, (double)rotation, (double)xCentre, (double)yCentre, type == "Square" ? 1.0 : 0.0 };
+    if (!cache->_remap.IsValid(buffer.BufferWi, buffer.BufferHt, key))
+    {
+        BuildRemap(cache->_remap, cache->_startUsed, cache->_edges, buffer.BufferWi, buffer.BufferHt, key);
+    }
+    cache->_remap.Apply(buffer, xlBLACK);
+}
+
+// Reflect the unset pixels across the edges until every pixel has been copied from somewhere.
+// The reflections only depend on the geometry so rather than moving colours we record where
+// each pixel's colour originally came from and render the frame with a single gather.
+void KaleidoscopeEffect::BuildRemap(RemapTable& remap, const std::vector<std::vector<bool>>& startUsed, const std::list<KaleidoscopeEdge>& edges, int width, int height, const std::vector<double>& key)
+{
+    remap.Reset(width, height, key, true);
+
+    // one byte per pixel as rows are updated in parallel
+    std::vector<uint8_t> currentUsed(width * height);
+    for (int x = 0; x < width; x++) {
+        for (int y = 0; y < height; y++) {
+            currentUsed[y * width + x] = startUsed[x][y] ? 1 : 0;
+        }
+    }
 
     auto edge = edges.begin();
-    //logger_base.debug("frame. Edges %d", (int)edges.size());
     std::atomic_int setSinceBegin;
     setSinceBegin = 0;
     while (!KaleidoscopeDone(currentUsed) && edges.size() > 0)
     {
-        //logger_base.debug("   iterate");
-        //int set = 0;
-
-        //DumpUsed(currentUsed, buffer.BufferWi, buffer.BufferHt);
-        parallel_for(0, buffer.BufferHt, [&currentUsed, this, &buffer, &edge, &setSinceBegin] (int y) {
-            for (int x = 0; x < buffer.BufferWi; x++) {
-                if (!currentUsed[x][y]) {
+        parallel_for(0, height, [&currentUsed, this, &remap, &edge, &setSinceBegin, width, height] (int y) {
+            for (int x = 0; x < width; x++) {
+                if (!currentUsed[y * width + x]) {
                     // this pixel needs to be set
-                    auto source = GetSourceLocation(x, y, *edge, buffer.BufferWi, buffer.BufferHt);
-                    if (source.first >= 0 && source.first < buffer.BufferWi && source.second >= 0 && source.second < buffer.BufferHt) {
-                        if (currentUsed[source.first][source.second]) {
-                            buffer.SetPixel(x, y, buffer.GetPixel(source.first, source.second));
-                            currentUsed[x][y] = true;
-                            //set++;
+                    auto source = GetSourceLocation(x, y, *edge, width, height);
+                    if (source.first >= 0 && source.first < width && source.second >= 0 && source.second < height) {
+                        int s = source.second * width + source.first;
+                        if (currentUsed[s]) {
+                            remap.Set(x, y, remap.Get(s));
+                            currentUsed[y * width + x] = 1;
                             setSinceBegin++;
                         }
                     }
                 }
             }
         });
-        //logger_base.debug("   set this iteration %d", set);
         ++edge;
         if (edge == edges.end()) {
             if (setSinceBegin == 0)
@@ -10,6 +10,7 @@
  * License: https://github.com/smeighan/xLights/blob/master/License.txt
  **************************************************************/
 
+#include <list>
 #include <vector>
 
 #include "RenderableEffect.h"
@@ -26,6 +27,8 @@
 #define KALEIDOSCOPE_ROTATION_MIN 0
 #define KALEIDOSCOPE_ROTATION_MAX 359
 
+class RemapTable;
+
 struct KaleidoscopeEdge
 {
     wxPoint _p1;
@@ -46,6 +49,7 @@ class KaleidoscopeEffect : public RenderableEffect
 
     protected:
         virtual xlEffectPanel *CreatePanel(wxWindow *parent) override;
-        bool KaleidoscopeDone(const std::vector<std::vector<bool>>& current);
+        bool KaleidoscopeDone(const std::vector<uint8_t>& current);
+        void BuildRemap(RemapTable& remap, const std::vector<std::vector<bool>>& startUsed, const std::list<KaleidoscopeEdge>& edges, int width, int height, const std::vector<double>& key);
         std::pair<int, int> GetSourceLocation(int x, int y, const KaleidoscopeEdge& edge, int width, int height);
 };
@@ -60,6 +60,7 @@ class LifeRenderCache : public EffectRenderCache {
 public:
     LifeRenderCache() : LastLifeCount(0), LastLifeType(0), LastLifeState(0) {};
     virtual ~LifeRenderCache() {};
+    virtual EffectRenderCache* Checkpoint() const override { return new LifeRenderCache(*this); }
     int LastLifeCount;
     int LastLifeType;
     int LastLifeState;
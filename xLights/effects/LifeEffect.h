@@ -19,6 +19,7 @@ public:
     virtual ~LifeEffect();
     virtual void SetDefaultParameters() override;
     virtual void Render(Effect* effect, SettingsMap& settings, RenderBuffer& buffer) override;
+    virtual bool SupportsStateCheckpoints() const override { return true; }
     virtual bool AppropriateOnNodes() const override { return false; }
 protected:
     virtual xlEffectPanel* CreatePanel(wxWindow* parent) override;
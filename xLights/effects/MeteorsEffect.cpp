@@ -26,6 +26,7 @@
 #include "../UtilFunctions.h"
 
 #include "../Parallel.h"
+#include "ParticleSystem.h"
 
 MeteorsEffect::MeteorsEffect(int id) : RenderableEffect(id, "Meteors", meteors_16, meteors_24, meteors_32, meteors_48, meteors_64)
 {
@@ -95,34 +96,17 @@ static inline int GetMeteorColorScheme(const std::string &color) {
     return 0;
 }
 
-class MeteorClass {
-public:
-
-    int x,y;
-    HSVValue hsv;
-    int h; //variable length; only used for icicle drip -DJ
-};
-
-// for radial meteor effect
-class MeteorRadialClass {
-public:
-
-    double x,y,dx,dy;
-    int cnt;
-    HSVValue hsv;
-};
-
-typedef std::list<MeteorClass> MeteorList;
-typedef std::list<MeteorRadialClass> MeteorRadialList;
-
 class MeteorsRenderCache : public EffectRenderCache {
 public:
     MeteorsRenderCache() {};
     virtual ~MeteorsRenderCache() {};
+    virtual EffectRenderCache* Checkpoint() const override { return new MeteorsRenderCache(*this); }
 
     int effectState;
-    MeteorList meteors;
-    MeteorRadialList meteorsRadial;
+    // x/y are whole pixels for the straight meteors, tag is the icicle drip length
+    ParticleSystem meteors;
+    // x/y/vx/vy is the position and direction, age counts frames
+    ParticleSystem meteorsRadial;
 };
 
 
@@ -235,23 +219,9 @@ void MeteorsEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuffe
  * *************************************************************
  */
 
-class MeteorHasExpiredX
-{
-    int TailLength;
-public:
-    MeteorHasExpiredX(int t)
-    : TailLength(t)
-    {}
-
-    // operator() is what's called when you do MeteorHasExpired()
-    bool operator()(const MeteorClass& obj) {
-        return obj.x + TailLength < 0;
-    }
-};
-
 void MeteorsEffect::RenderMeteorsHorizontal(RenderBuffer &buffer, int ColorScheme, int Count, int Length, int MeteorsEffect, int SwirlIntensity, int mspeed)
 {
-    MeteorClass m;
+    HSVValue mhsv;
     HSVValue hsv,hsv0,hsv1;
     buffer.palette.GetHSV(0,hsv0);
     buffer.palette.GetHSV(1,hsv1);
@@ -263,26 +233,26 @@ void MeteorsEffect::RenderMeteorsHorizontal(RenderBuffer &buffer, int ColorSchem
 
     // create new meteors
 
+    ParticleSystem& meteors = cache->meteors;
     for (int i = 0; i < buffer.BufferHt; i++) {
         if (rand() % 200 < Count) {
-            m.x=buffer.BufferWi - 1;
-            m.y=i;
-
             switch (ColorScheme) {
                 case 1:
-                    buffer.SetRangeColor(hsv0,hsv1,m.hsv);
+                    buffer.SetRangeColor(hsv0,hsv1,mhsv);
                     break;
                 case 2:
-                    buffer.palette.GetHSV(rand()%colorcnt, m.hsv);
+                    buffer.palette.GetHSV(rand()%colorcnt, mhsv);
                     break;
             }
-            cache->meteors.push_back(m);
+            meteors.Emit(buffer.BufferWi - 1, i, 0.0, 0.0, mhsv);
         }
     }
 
     // render meteors
 
-    std::function<void(MeteorClass &, int)> f = [&buffer, MeteorsEffect, TailLength, mspeed, SwirlIntensity, ColorScheme] (MeteorClass &meteor, int n) {
+    parallel_for(0, meteors.Size(), [&buffer, &meteors, MeteorsEffect, TailLength, SwirlIntensity, ColorScheme] (int n) {
+        int mx = meteors.x[n];
+        int my = meteors.y[n];
         int x,y,dy;
         HSVValue hsv;
         for (int ph = 0; ph <= TailLength; ph++) {
@@ -293,15 +263,15 @@ void MeteorsEffect::RenderMeteorsHorizontal(RenderBuffer &buffer, int ColorSchem
                     hsv.value=1.0;
                     break;
                 default:
-                    hsv=meteor.hsv;
+                    hsv=meteors.hsv[n];
                     break;
             }
 
-            double swirl_phase=double(meteor.x)/5.0+double(n)/100.0;
+            double swirl_phase=double(mx)/5.0+double(n)/100.0;
             dy=int(double(SwirlIntensity*buffer.BufferHt)/80.0*buffer.sin(swirl_phase));
 
-            x=meteor.x+ph;
-            y=meteor.y+dy;
+            x=mx+ph;
+            y=my+dy;
             if (MeteorsEffect==3) x=buffer.BufferWi-x;
 
             if (buffer.allowAlpha) {
@@ -313,13 +283,11 @@ void MeteorsEffect::RenderMeteorsHorizontal(RenderBuffer &buffer, int ColorSchem
                 buffer.SetPixel(x,y,hsv);
             }
         }
-
-        meteor.x -= mspeed;
-    };
-    parallel_for(cache->meteors, f, 500);
+    }, 500);
+    meteors.Translate(-mspeed, 0);
 
     // delete old meteors
-    cache->meteors.remove_if(MeteorHasExpiredX(TailLength));
+    meteors.Kill([&meteors, TailLength](size_t i) { return (int)meteors.x[i] + TailLength < 0; });
 }
 
 /*
@@ -328,32 +296,9 @@ void MeteorsEffect::RenderMeteorsHorizontal(RenderBuffer &buffer, int ColorSchem
  * *************************************************************
  */
 
-class MeteorHasExpiredY
-{
-    int TailLength;
-public:
-    MeteorHasExpiredY(int t)
-    : TailLength(t)
-    {}
-
-    // operator() is what's called when you do MeteorHasExpired()
-    bool operator()(const MeteorClass& obj) {
-        return obj.y + TailLength < 0;
-    }
-};
-
-//predicate to remove variable length meteors (icicles):
-class IcicleHasExpired
-{
-public:
-    bool operator()(const MeteorClass& obj) { return obj.y < -obj.h; }
-};
-//bool end_of_icicle(const MeteorClass& obj) { return obj.y > obj.h; }
-
-
 void MeteorsEffect::RenderMeteorsVertical(RenderBuffer &buffer, int ColorScheme, int Count, int Length, int MeteorsEffect, int SwirlIntensity, int mspeed)
 {
-    MeteorClass m;
+    HSVValue mhsv;
     HSVValue hsv,hsv0,hsv1;
     buffer.palette.GetHSV(0,hsv0);
     buffer.palette.GetHSV(1,hsv1);
@@ -364,26 +309,26 @@ void MeteorsEffect::RenderMeteorsVertical(RenderBuffer &buffer, int ColorScheme,
 
     // create new meteors
 
+    ParticleSystem& meteors = cache->meteors;
     for (int i = 0; i < buffer.BufferWi; i++) {
         if (rand() % 200 < Count) {
-            m.x=i;
-            m.y=buffer.BufferHt - 1;
-
             switch (ColorScheme) {
                 case 1:
-                    buffer.SetRangeColor(hsv0,hsv1,m.hsv);
+                    buffer.SetRangeColor(hsv0,hsv1,mhsv);
                     break;
                 case 2:
-                    buffer.palette.GetHSV(rand()%colorcnt, m.hsv);
+                    buffer.palette.GetHSV(rand()%colorcnt, mhsv);
                     break;
             }
-            cache->meteors.push_back(m);
+            meteors.Emit(i, buffer.BufferHt - 1, 0.0, 0.0, mhsv);
         }
     }
 
     // render meteors
 
-    std::function<void(MeteorClass &, int)> f = [&buffer, MeteorsEffect, TailLength, mspeed, SwirlIntensity, ColorScheme] (MeteorClass &meteor, int n) {
+    parallel_for(0, meteors.Size(), [&buffer, &meteors, MeteorsEffect, TailLength, SwirlIntensity, ColorScheme] (int n) {
+        int mx = meteors.x[n];
+        int my = meteors.y[n];
         int x,y,dx;
         HSVValue hsv;
         for (int ph = 0; ph <= TailLength; ph++) {
@@ -394,16 +339,16 @@ void MeteorsEffect::RenderMeteorsVertical(RenderBuffer &buffer, int ColorScheme,
                     hsv.value=1.0;
                     break;
                 default:
-                    hsv=meteor.hsv;
+                    hsv=meteors.hsv[n];
                     break;
             }
 
             // we adjust x axis with some sine function if swirl1 or swirl2
             // swirling more than 25% of the buffer width doesn't look good
-            double swirl_phase=double(meteor.y)/5.0+double(n)/100.0;
+            double swirl_phase=double(my)/5.0+double(n)/100.0;
             dx=int(double(SwirlIntensity*buffer.BufferWi)/80.0*buffer.sin(swirl_phase));
-            x=meteor.x+dx;
-            y=meteor.y+ph;
+            x=mx+dx;
+            y=my+ph;
             if (MeteorsEffect==1) y=buffer.BufferHt-y;
 
             if (buffer.allowAlpha) {
@@ -415,14 +360,11 @@ void MeteorsEffect::RenderMeteorsVertical(RenderBuffer &buffer, int ColorScheme,
                 buffer.SetPixel(x,y,hsv);
             }
         }
-
-        meteor.y -= mspeed;
-    };
-    parallel_for(cache->meteors, f, 500);
-
+    }, 500);
+    meteors.Translate(0, -mspeed);
 
     // delete old meteors
-    cache->meteors.remove_if(MeteorHasExpiredY(TailLength));
+    meteors.Kill([&meteors, TailLength](size_t i) { return (int)meteors.y[i] + TailLength < 0; });
 }
 
 #define numents(thing)  (sizeof(thing) / sizeof(thing[0]))
@@ -447,23 +389,22 @@ void MeteorsEffect::RenderIcicleDrip(RenderBuffer &buffer, int ColorScheme, int
 
     // create new meteors
 
-    MeteorClass m;
+    ParticleSystem& meteors = cache->meteors;
+    HSVValue mhsv;
     for (int i = 0; i < buffer.BufferWi; i++) {
         if (rand() % 200 < Count) {
-            m.x=i;
-            m.y=buffer.BufferHt - 1;
-            //            m.h = TailLength;
-            m.h = (rand() % (2 * buffer.BufferHt))/3; //somewhat variable length -DJ
+            //            h = TailLength;
+            int h = (rand() % (2 * buffer.BufferHt))/3; //somewhat variable length -DJ
 
             switch (ColorScheme) {
                 case 1:
-                    buffer.SetRangeColor(hsv0,hsv1,m.hsv);
+                    buffer.SetRangeColor(hsv0,hsv1,mhsv);
                     break;
                 case 2:
-                    buffer.palette.GetHSV(rand()%colorcnt, m.hsv);
+                    buffer.palette.GetHSV(rand()%colorcnt, mhsv);
                     break;
             }
-            cache->meteors.push_back(m);
+            meteors.Emit(i, buffer.BufferHt - 1, 0.0, 0.0, mhsv, h);
         }
     }
 
@@ -482,31 +423,32 @@ void MeteorsEffect::RenderIcicleDrip(RenderBuffer &buffer, int ColorScheme, int
                 buffer.SetPixel(x, y + ystaggered[(x/3) % numents(ystaggered)], c);
     }
 
-    std::function<void(MeteorClass &, int)> f = [&buffer, MeteorsEffect, TailLength, mspeed, SwirlIntensity] (MeteorClass &meteor, int n) {
+    parallel_for(0, meteors.Size(), [&buffer, &meteors, MeteorsEffect, TailLength, SwirlIntensity] (int n) {
+        int mx = meteors.x[n];
+        int my = meteors.y[n];
+        int mh = meteors.tag[n];
         int x,y,dx;
         HSVValue hsv;
         for (int ph = 0; ph <= TailLength; ph++) {
-            if (!ph || (ph <= meteor.h - meteor.y)) hsv = meteor.hsv; //only make the end of the drip colored
+            if (!ph || (ph <= mh - my)) hsv = meteors.hsv[n]; //only make the end of the drip colored
             else { hsv.value = .4; hsv.hue = hsv.saturation = 0; } //white icicle
 
             // we adjust x axis with some sine function if swirl1 or swirl2
             // swirling more than 25% of the buffer width doesn't look good
-            float swirl_phase=float(meteor.y)/5.0f+float(n)/100.0f;
+            float swirl_phase=float(my)/5.0f+float(n)/100.0f;
             dx=int(float(SwirlIntensity*buffer.BufferWi)/80.0f*buffer.sin(swirl_phase));
 
-            x=meteor.x+dx;
-            y=meteor.y+ph;
+            x=mx+dx;
+            y=my+ph;
             if (MeteorsEffect==1) y=buffer.BufferHt-y;
-            if (y < meteor.h) continue; //variable length icicle drips -DJ
+            if (y < mh) continue; //variable length icicle drips -DJ
             buffer.SetPixel(x,y,hsv);
         }
-        meteor.y -= mspeed;
-    };
-    parallel_for(cache->meteors, f, 500);
+    }, 500);
+    meteors.Translate(0, -mspeed);
 
-    // delete old meteors
-    //    meteors.remove_if(MeteorHasExpiredY(TailLength));
-    cache->meteors.remove_if(IcicleHasExpired());
+    // delete old meteors ... variable length so they are gone once the top of the drip is
+    meteors.Kill([&meteors](size_t i) { return (int)meteors.y[i] < -meteors.tag[i]; });
 }
 
 /*
@@ -515,19 +457,6 @@ void MeteorsEffect::RenderIcicleDrip(RenderBuffer &buffer, int ColorScheme, int
  * *************************************************************
  */
 
-class MeteorHasExpiredImplode
-{
-    int cx, cy;
-public:
-    MeteorHasExpiredImplode(int centerX, int centerY)
-    { cx=centerX; cy=centerY; }
-
-    // operator() is what's called when you do MeteorHasExpired()
-    bool operator()(const MeteorRadialClass& obj) {
-        return (std::abs(obj.y - cy) < 2) && (std::abs(obj.x - cx) < 2);
-    }
-};
-
 void MeteorsEffect::RenderMeteorsImplode(RenderBuffer &buffer, int ColorScheme, int Count, int Length, int SwirlIntensity, int mspeed, int xoffset, int yoffset, bool fadeWithDistance)
 {
     int truexoffset = xoffset * buffer.BufferWi / 2 / 100;
@@ -542,7 +471,7 @@ void MeteorsEffect::RenderMeteorsImplode(RenderBuffer &buffer, int ColorScheme,
             std::max(sqrt((buffer.BufferWi - centerX)*(buffer.BufferWi - centerX) + (0 - centerY)*(0 - centerY)),
                 sqrt((buffer.BufferWi - centerX)*(buffer.BufferWi - centerX) + (buffer.BufferHt - centerY)*(buffer.BufferHt - centerY)))));
 
-    MeteorRadialClass m;
+    HSVValue mhsv;
     HSVValue hsv,hsv0,hsv1;
     buffer.palette.GetHSV(0,hsv0);
     buffer.palette.GetHSV(1,hsv1);
@@ -555,7 +484,7 @@ void MeteorsEffect::RenderMeteorsImplode(RenderBuffer &buffer, int ColorScheme,
 
     // create new meteors
 
-    m.cnt=1;
+    ParticleSystem& meteors = cache->meteorsRadial;
     for (int i = 0; i < MinDimension; i++) {
         if (rand() % 200 < Count) {
             if (buffer.BufferHt == 1) {
@@ -565,34 +494,34 @@ void MeteorsEffect::RenderMeteorsImplode(RenderBuffer &buffer, int ColorScheme,
             } else {
                 angle=rand01()*2.0*M_PI;
             }
-            m.dx=buffer.cos(angle);
-            m.dy=buffer.sin(angle);
-            //m.x = centerX + double(halfdiag + TailLength)*m.dx;
-            //m.y = centerY + double(halfdiag + TailLength)*m.dy;
-            m.x = centerX + double(maxdiag + TailLength)*m.dx;
-            m.y = centerY + double(maxdiag + TailLength)*m.dy;
+            double dx=buffer.cos(angle);
+            double dy=buffer.sin(angle);
 
             switch (ColorScheme) {
                 case 1:
-                    buffer.SetRangeColor(hsv0,hsv1,m.hsv);
+                    buffer.SetRangeColor(hsv0,hsv1,mhsv);
                     break;
                 case 2:
-                    buffer.palette.GetHSV(rand()%colorcnt, m.hsv);
+                    buffer.palette.GetHSV(rand()%colorcnt, mhsv);
                     break;
             }
-            cache->meteorsRadial.push_back(m);
+            meteors.Emit(centerX + double(maxdiag + TailLength)*dx, centerY + double(maxdiag + TailLength)*dy, dx, dy, mhsv, 0, 1);
         }
     }
 
     // render meteors
 
-    std::function<void(MeteorRadialClass&, int)> f = [&buffer, fadeWithDistance, centerX, centerY, maxdiag, TailLength, ColorScheme, mspeed](MeteorRadialClass& meteor, int n) {
+    parallel_for(0, meteors.Size(), [&buffer, &meteors, fadeWithDistance, centerX, centerY, maxdiag, TailLength, ColorScheme, mspeed](int n) {
+        double& mx = meteors.x[n];
+        double& my = meteors.y[n];
+        double mdx = meteors.vx[n];
+        double mdy = meteors.vy[n];
         int x,y;
         HSVValue hsv;
         float hdistance = 1.0f;
         if (fadeWithDistance) {
-            float x = meteor.x;
-            float y = meteor.y;
+            float x = mx;
+            float y = my;
             hdistance = std::max(0.1f, (float)sqrt((x - (float)centerX) * (x - (float)centerX) + (y - (float)centerY) * (y - (float)centerY)) / (float)maxdiag);
         }
 
@@ -604,13 +533,13 @@ void MeteorsEffect::RenderMeteorsImplode(RenderBuffer &buffer, int ColorScheme,
                     hsv.value=1.0;
                     break;
                 default:
-                    hsv=meteor.hsv;
+                    hsv=meteors.hsv[n];
                     break;
             }
             // if we were to swirl, it would need to alter the angle here
 
-            x = int(meteor.x-meteor.dx*double(ph));
-            y = int(meteor.y-meteor.dy*double(ph));
+            x = int(mx-mdx*double(ph));
+            y = int(my-mdy*double(ph));
 
             // the next line cannot test for exact center! Some lines miss by 1 because of rounding.
             if ((abs(y - centerY) < 2) && (abs(x - centerX) < 2)) break;
@@ -634,14 +563,15 @@ void MeteorsEffect::RenderMeteorsImplode(RenderBuffer &buffer, int ColorScheme,
             }
         }
 
-        meteor.x -= meteor.dx*mspeed * hdistance;
-        meteor.y -= meteor.dy*mspeed * hdistance;
-        meteor.cnt++;
-    };
-    parallel_for(cache->meteorsRadial, f, 500);
+        mx -= mdx*mspeed * hdistance;
+        my -= mdy*mspeed * hdistance;
+        meteors.age[n]++;
+    }, 500);
 
     // delete old meteors
-    cache->meteorsRadial.remove_if(MeteorHasExpiredImplode(buffer.BufferWi/2+truexoffset,buffer.BufferHt/2+trueyoffset));
+    int cx = buffer.BufferWi/2+truexoffset;
+    int cy = buffer.BufferHt/2+trueyoffset;
+    meteors.Kill([&meteors, cx, cy](size_t i) { return (std::abs(meteors.y[i] - cy) < 2) && (std::abs(meteors.x[i] - cx) < 2); });
 }
 
 /*
@@ -650,19 +580,6 @@ void MeteorsEffect::RenderMeteorsImplode(RenderBuffer &buffer, int ColorScheme,
  * *************************************************************
  */
 
-class MeteorHasExpiredExplode
-{
-    int ht, wi;
-public:
-    MeteorHasExpiredExplode(int h, int w)
-    { ht=h; wi=w; }
-
-    // operator() is what's called when you do MeteorHasExpired()
-    bool operator()(const MeteorRadialClass& obj) {
-        return obj.y < 0 || obj.x < 0 || obj.y > ht || obj.x > wi;
-    }
-};
-
 void MeteorsEffect::RenderMeteorsExplode(RenderBuffer &buffer, int ColorScheme, int Count, int Length, int SwirlIntensity, int mspeed, int xoffset, int yoffset, bool fadeWithDistance)
 {
     int truexoffset = xoffset * buffer.BufferWi / 2 / 100;
@@ -677,7 +594,7 @@ void MeteorsEffect::RenderMeteorsExplode(RenderBuffer &buffer, int ColorScheme,
             std::max(sqrt((buffer.BufferWi - centerX)*(buffer.BufferWi - centerX) + (0 - centerY)*(0 - centerY)),
                 sqrt((buffer.BufferWi - centerX)*(buffer.BufferWi - centerX) + (buffer.BufferHt - centerY)*(buffer.BufferHt - centerY)))));
 
-    MeteorRadialClass m;
+    HSVValue mhsv;
     HSVValue hsv,hsv0,hsv1;
     buffer.palette.GetHSV(0,hsv0);
     buffer.palette.GetHSV(1,hsv1);
@@ -690,9 +607,7 @@ void MeteorsEffect::RenderMeteorsExplode(RenderBuffer &buffer, int ColorScheme,
 
     // create new meteors
 
-    m.x=buffer.BufferWi/2+truexoffset;
-    m.y=buffer.BufferHt/2+trueyoffset;
-    m.cnt=1;
+    ParticleSystem& meteors = cache->meteorsRadial;
     for (int i = 0; i < MinDimension; i++) {
         if (rand() % 200 < Count) {
             if (buffer.BufferHt == 1) {
@@ -702,31 +617,35 @@ void MeteorsEffect::RenderMeteorsExplode(RenderBuffer &buffer, int ColorScheme,
             } else {
                 angle=rand01()*2.0*M_PI;
             }
-            m.dx=buffer.cos(angle);
-            m.dy=buffer.sin(angle);
+            double dx=buffer.cos(angle);
+            double dy=buffer.sin(angle);
 
             switch (ColorScheme) {
                 case 1:
-                    buffer.SetRangeColor(hsv0,hsv1,m.hsv);
+                    buffer.SetRangeColor(hsv0,hsv1,mhsv);
                     break;
                 case 2:
-                    buffer.palette.GetHSV(rand()%colorcnt, m.hsv);
+                    buffer.palette.GetHSV(rand()%colorcnt, mhsv);
                     break;
             }
-            cache->meteorsRadial.push_back(m);
+            meteors.Emit(buffer.BufferWi/2+truexoffset, buffer.BufferHt/2+trueyoffset, dx, dy, mhsv, 0, 1);
         }
     }
 
     // render meteors
 
-    std::function<void(MeteorRadialClass&, int)> f = [&buffer, fadeWithDistance, centerX, centerY, maxdiag, TailLength, ColorScheme, mspeed](MeteorRadialClass& meteor, int n) {
+    parallel_for(0, meteors.Size(), [&buffer, &meteors, fadeWithDistance, centerX, centerY, maxdiag, TailLength, ColorScheme, mspeed](int n) {
+        double& mx = meteors.x[n];
+        double& my = meteors.y[n];
+        double mdx = meteors.vx[n];
+        double mdy = meteors.vy[n];
         int x,y;
         HSVValue hsv;
 
         float hdistance = 1.0f;
         if (fadeWithDistance) {
-            float x = meteor.x;
-            float y = meteor.y;
+            float x = mx;
+            float y = my;
             hdistance = std::max(0.1f, (float)sqrt((x - (float)centerX) * (x - (float)centerX) + (y - (float)centerY) * (y - (float)centerY)) / (float)maxdiag);
         }
 
@@ -739,14 +658,14 @@ void MeteorsEffect::RenderMeteorsExplode(RenderBuffer &buffer, int ColorScheme,
                     hsv.value=1.0;
                     break;
                 default:
-                    hsv=meteor.hsv;
+                    hsv=meteors.hsv[n];
                     break;
             }
 
             // if we were to swirl, it would need to alter the angle here
 
-            x=int(meteor.x+meteor.dx*double(ph));
-            y=int(meteor.y+meteor.dy*double(ph));
+            x=int(mx+mdx*double(ph));
+            y=int(my+mdy*double(ph));
 
             if (fadeWithDistance) {
                 // distance
@@ -767,13 +686,14 @@ void MeteorsEffect::RenderMeteorsExplode(RenderBuffer &buffer, int ColorScheme,
             }
         }
 
-        meteor.x += meteor.dx*mspeed * hdistance;
-        meteor.y += meteor.dy*mspeed * hdistance;
-        meteor.cnt++;
-    };
-    parallel_for(cache->meteorsRadial, f, 500);
+        mx += mdx*mspeed * hdistance;
+        my += mdy*mspeed * hdistance;
+        meteors.age[n]++;
+    }, 500);
 
     // delete old meteors
-    cache->meteorsRadial.remove_if(MeteorHasExpiredExplode(buffer.BufferHt,buffer.BufferWi));
+    int ht = buffer.BufferHt;
+    int wi = buffer.BufferWi;
+    meteors.Kill([&meteors, ht, wi](size_t i) { return meteors.y[i] < 0 || meteors.x[i] < 0 || meteors.y[i] > ht || meteors.x[i] > wi; });
 }
 
@@ -0,0 +1,122 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <vector>
+
+#include "../Color.h"
+
+// Pooled particle storage for effects that spawn and retire lots of short lived objects.
+// Each attribute lives in its own array (structure of arrays) so update and draw loops
+// walk contiguous memory, and the arrays keep their capacity when particles are killed
+// or the pool is cleared so a running effect stops allocating once it reaches its peak.
+// Particles stay in the order they were emitted ... Kill compacts without reordering so
+// index based behaviour (swirl phase, draw order) is the same as a list would give.
+class ParticleSystem
+{
+public:
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> vx;
+    std::vector<double> vy;
+    std::vector<HSVValue> hsv;
+    std::vector<int> age;
+    std::vector<int> tag; // effect specific ... length, group, index
+
+    size_t Size() const { return x.size(); }
+    bool Empty() const { return x.empty(); }
+
+    void Clear()
+    {
+        Resize(0);
+    }
+
+    void Reserve(size_t n)
+    {
+        x.reserve(n);
+        y.reserve(n);
+        vx.reserve(n);
+        vy.reserve(n);
+        hsv.reserve(n);
+        age.reserve(n);
+        tag.reserve(n);
+    }
+
+    // Adds a particle and returns its index
+    size_t Emit(double px, double py, double pvx = 0.0, double pvy = 0.0, const HSVValue& colour = HSVValue(), int ptag = 0, int page = 0)
+    {
+        x.push_back(px);
+        y.push_back(py);
+        vx.push_back(pvx);
+        vy.push_back(pvy);
+        hsv.push_back(colour);
+        age.push_back(page);
+        tag.push_back(ptag);
+        return x.size() - 1;
+    }
+
+    // Removes every particle for which dead(index) is true. dead is called once per particle
+    // in index order. Returns the number removed.
+    template <typename F>
+    size_t Kill(F&& dead)
+    {
+        size_t count = Size();
+        size_t out = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (dead(i)) continue;
+            if (out != i) {
+                x[out] = x[i];
+                y[out] = y[i];
+                vx[out] = vx[i];
+                vy[out] = vy[i];
+                hsv[out] = hsv[i];
+                age[out] = age[i];
+                tag[out] = tag[i];
+            }
+            ++out;
+        }
+        Resize(out);
+        return count - out;
+    }
+
+    // Moves every particle by its velocity and ages it a frame
+    void Advance()
+    {
+        size_t count = Size();
+        for (size_t i = 0; i < count; ++i) {
+            x[i] += vx[i];
+            y[i] += vy[i];
+            ++age[i];
+        }
+    }
+
+    // Moves every particle by the same amount
+    void Translate(double dx, double dy)
+    {
+        size_t count = Size();
+        for (size_t i = 0; i < count; ++i) {
+            x[i] += dx;
+            y[i] += dy;
+        }
+    }
+
+private:
+    void Resize(size_t n)
+    {
+        x.resize(n);
+        y.resize(n);
+        vx.resize(n);
+        vy.resize(n);
+        hsv.resize(n);
+        age.resize(n);
+        tag.resize(n);
+    }
+};
@@ -31,6 +31,7 @@
 #include "../UtilFunctions.h"
 #include "../ExternalHooks.h"
 #include "GIFImage.h"
+#include "../ImageAssetCache.h"
 #include "../xLightsMain.h" 
 
 #include <log4cpp/Category.hh>
@@ -68,7 +69,7 @@ std::list<std::string> PicturesEffect::CheckEffectSettings(const SettingsMap& se
             res.push_back(wxString::Format("    WARN: Picture effect image file '%s' not under show directory. Model '%s', Start %s", pictureFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
         }
 
-        int imageCount = wxImage::GetImageCount(pictureFilename);
+        int imageCount = ImageAssetCache::Instance().GetImageCount(pictureFilename.ToStdString());
         if (imageCount <= 0)
         {
             res.push_back(wxString::Format("    ERR: Picture effect '%s' contains no images. Image invalid. Model '%s', Start %s", pictureFilename, model->GetName(), FORMATTIME(eff->GetStartTimeMS())).ToStdString());
@@ -76,12 +77,11 @@ std::list<std::string> PicturesEffect::CheckEffectSettings(const SettingsMap& se
 
         if (!renderCache)
         {
-            wxImage i;
-            i.LoadFile(pictureFilename);
-            if (i.IsOk())
+            auto i = ImageAssetCache::Instance().GetImage(pictureFilename.ToStdString());
+            if (i != nullptr)
             {
-                int ih = i.GetHeight();
-                int iw = i.GetWidth();
+                int ih = i->GetHeight();
+                int iw = i->GetWidth();
 
 #define IMAGESIZETHRESHOLD 10
                 if (ih > IMAGESIZETHRESHOLD * model->GetDefaultBufferHt() || iw > IMAGESIZETHRESHOLD * model->GetDefaultBufferWi())
@@ -259,6 +259,12 @@ public:
 
     wxImage image;
     wxImage rawimage;
+    // shared decoded images ... image/rawimage may reference their pixels so they must be kept alive
+    ImageAssetCache::ImagePtr decodedImage;
+    ImageAssetCache::ImagePtr scaledImage;
+    ImageAssetCache::SCALE_MODE scaledMode = ImageAssetCache::SCALE_MODE::NONE;
+    int scaledWi = 0;
+    int scaledHt = 0;
     int imageCount;
     int frame;
     int maxmovieframes;
@@ -298,8 +304,11 @@ void PicturesEffect::LoadPixelsFromTextFile(RenderBuffer &buffer, wxFile& debug,
     wxImage &rawimage = cache->rawimage;
     std::vector<PixelVector> &PixelsByFrame = cache->PixelsByFrame;
 
-    if (image.GetWidth() && image.GetHeight()) image.Clear(); //CAUTION: image must be non-empty to clear it (memory error otherwise)
-    if (rawimage.GetWidth() && rawimage.GetHeight()) rawimage.Clear(); //CAUTION: image must be non-empty to clear it (memory error otherwise)
+    // the images may be views over the shared image cache's pixels so they are released rather than cleared
+    image = wxImage();
+    rawimage = wxImage();
+    cache->decodedImage = nullptr;
+    cache->scaledImage = nullptr;
 
     if (!cache->PictureName.CmpNoCase(filename)) { wrdebug("no change: " + filename); return; }
     if (!FileExists(filename)) { wrdebug("not found: " + filename); return; }
@@ -573,6 +582,12 @@ void PicturesEffect::Render(RenderBuffer& buffer,
                     return;
                 }
                 sPicture = wxString::Format("%s-%d.%s", BasePicture, frame, extension);
+
+                // get the next frame decoding while we render this one
+                if (frame < cache->maxmovieframes) {
+                    ImageAssetCache::Instance().Prefetch(wxString::Format("%s-%d.%s", BasePicture, frame + 1, extension).ToStdString(),
+                                                         0, BufferWi, BufferHt, ImageAssetCache::ScaleModeFromString(scale_to_fit));
+                }
             }
         }
 
@@ -602,7 +617,7 @@ void PicturesEffect::Render(RenderBuffer& buffer,
 #ifdef LINUX
                 logger_base.debug("About to count images in bitmap %s.", (const char*)NewPictureName.c_str());
 #endif
-                cache->imageCount = wxImage::GetImageCount(NewPictureName);
+                cache->imageCount = ImageAssetCache::Instance().GetImageCount(NewPictureName.ToStdString());
                 if (cache->imageCount <= 0) {
                     logger_base.error("Image %s reports %d frames which is invalid. Overriding it to be 1.", (const char*)NewPictureName.c_str(), cache->imageCount);
 
@@ -610,9 +625,13 @@ void PicturesEffect::Render(RenderBuffer& buffer,
                     cache->imageCount = 1;
                 }
 
-                if (!image.LoadFile(NewPictureName, wxBITMAP_TYPE_ANY, 0)) {
+                cache->decodedImage = ImageAssetCache::Instance().GetImage(NewPictureName.ToStdString());
+                cache->scaledImage = nullptr;
+                if (cache->decodedImage == nullptr) {
                     logger_base.error("Error loading image file: %s.", (const char*)NewPictureName.c_str());
                     image.Create(5, 5, true);
+                } else {
+                    image = cache->decodedImage->WrapImage();
                 }
 
                 rawimage = image;
@@ -682,22 +701,45 @@ void PicturesEffect::Render(RenderBuffer& buffer,
     int yoffset = (BufferHt + imght) / 2; //centered if sizes don't match
     int xoffset = (imgwidth - BufferWi) / 2; //centered if sizes don't match
 
+    // stills come pre-scaled from the shared image cache, animated GIF frames are scaled here
+    auto getScaledImage = [&](ImageAssetCache::SCALE_MODE mode) {
+        if (cache->imageCount > 1 || cache->decodedImage == nullptr) {
+            return false;
+        }
+        if (cache->scaledImage == nullptr || cache->scaledMode != mode || cache->scaledWi != BufferWi || cache->scaledHt != BufferHt) {
+            auto scaled = ImageAssetCache::Instance().GetImage(cache->PictureName.ToStdString(), 0, BufferWi, BufferHt, mode);
+            if (scaled == nullptr) {
+                return false;
+            }
+            cache->scaledImage = scaled;
+            cache->scaledMode = mode;
+            cache->scaledWi = BufferWi;
+            cache->scaledHt = BufferHt;
+        }
+        image = cache->scaledImage->WrapImage();
+        return true;
+    };
+
     if (scale_to_fit == "Scale To Fit" && (BufferWi != imgwidth || BufferHt != imght)) {
-        image = rawimage;
-        image.Rescale(BufferWi, BufferHt);
+        if (!getScaledImage(ImageAssetCache::SCALE_MODE::EXACT)) {
+            image = rawimage;
+            image.Rescale(BufferWi, BufferHt);
+        }
         imgwidth = image.GetWidth();
         imght = image.GetHeight();
         yoffset = (BufferHt + imght) / 2; //centered if sizes don't match
         xoffset = (imgwidth - BufferWi) / 2; //centered if sizes don't match
     }
     else if (scale_to_fit == "Scale Keep Aspect Ratio" || scale_to_fit == "Scale Keep Aspect Ratio Crop") {
-        image = rawimage;
-        float xr = (float)BufferWi / (float)image.GetWidth();
-        float yr = (float)BufferHt / (float)image.GetHeight();
-        float sc = std::min(xr, yr);
-        if(scale_to_fit.find("Crop") != std::string::npos)
-            sc = std::max(xr, yr);
-        image.Rescale(image.GetWidth() * sc, image.GetHeight() * sc);
+        if (!getScaledImage(ImageAssetCache::ScaleModeFromString(scale_to_fit))) {
+            image = rawimage;
+            float xr = (float)BufferWi / (float)image.GetWidth();
+            float yr = (float)BufferHt / (float)image.GetHeight();
+            float sc = std::min(xr, yr);
+            if (scale_to_fit.find("Crop") != std::string::npos)
+                sc = std::max(xr, yr);
+            image.Rescale(image.GetWidth() * sc, image.GetHeight() * sc);
+        }
         imgwidth = image.GetWidth();
         imght = image.GetHeight();
         yoffset = (BufferHt + imght) / 2; //centered if sizes don't match
@@ -22,6 +22,19 @@
 #include "../../include/plasma-64.xpm"
 
 #include "../Parallel.h"
+#include "CoordinateField.h"
+
+#include <algorithm>
+
+class PlasmaRenderCache : public EffectRenderCache {
+public:
+    PlasmaRenderCache() {};
+    virtual ~PlasmaRenderCache() {};
+
+    CoordinateField field;
+    std::vector<float> rowSin; // sin((ry + time) / 2) for the current frame
+    std::vector<float> cy2;    // (ry + cos(time / 3) / 2)^2 for the current frame
+};
 
 PlasmaEffect::PlasmaEffect(int id) : RenderableEffect(id, "Plasma", plasma_16, plasma_24, plasma_32, plasma_48, plasma_64)
 {
@@ -93,78 +106,143 @@ void PlasmaEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuffer
 
     if (PlasmaDirection==1) offset = -offset;
 
-    const double sin_time_5 = buffer.sin(time / 5);
-    const double cos_time_3 = buffer.cos(time / 3);
-    const double sin_time_2 = buffer.sin(time / 2);
-    static const double pi3 = pi / 3.0;
+    const float sin_time_5 = FastTrig::sin(time / 5);
+    const float cos_time_3 = FastTrig::cos(time / 3);
+    const float sin_time_2 = FastTrig::sin(time / 2);
+    static const float pi3 = pi / 3.0;
+    const float ftime = time;
+    const float style50 = Style * 50;
+    const float vScale = 0.5 * Line_Density * pi; // v / 2 and into radians for the colour maths
+
+    PlasmaRenderCache *cache = static_cast<PlasmaRenderCache*>(buffer.infoCache[id]);
+    if (cache == nullptr) {
+        cache = new PlasmaRenderCache();
+        buffer.infoCache[id] = cache;
+    }
+    CoordinateField &field = cache->field;
+    if (!field.IsValid(buffer.BufferWi, buffer.BufferHt, buffer.BufferWi - 1, 0.0f, buffer.BufferHt - 1, 0.0f, 0.0f)) {
+        field.Build(buffer.BufferWi, buffer.BufferHt, buffer.BufferWi - 1, 0.0f, buffer.BufferHt - 1, 0.0f, 0.0f);
+    }
 
+    // the parts of the equations that only depend on the row
+    std::vector<float> &rowSin = cache->rowSin;
+    std::vector<float> &cy2 = cache->cy2;
+    rowSin.resize(field.GetStride());
+    cy2.resize(field.GetStride());
+    for (int y = 0; y < field.GetStride(); y++) {
+        const float ry = field.ry[y];
+        const float cy = ry + .5f * cos_time_3;
+        rowSin[y] = FastTrig::sin((ry + ftime) / 2.0f);
+        cy2[y] = cy * cy;
+    }
+
+    // every cell is independent so cells without nodes can be skipped
+    const bool sparse = buffer.CanRenderSparse();
     int block = buffer.BufferHt * buffer.BufferWi > 100 ? 1 : -1;
     parallel_for(0, buffer.BufferWi, [&] (int x) {
-        double rx = ((float)x / (buffer.BufferWi - 1)); // rx is now in the range 0.0 to 1.0
-        double rx2 = rx * rx;
-        double cx = rx + .5*sin_time_5;
-        double cx2 = cx*cx;
-        double sin_rx_time = buffer.sin(rx + time);
-
-        // 1st equation
-        double v1 = buffer.sin(rx * 10 + time);
+        const float rx = field.rx[x];
+        const float cx = rx + .5f * sin_time_5;
+        const float cx2 = cx * cx;
+        const float rxs = rx * sin_time_2;
+        const float *ry = field.ry.data();
+        const float *radius = field.Radius(x);
+
+        // 1st equation and the other column only terms
+        const float v1 = FastTrig::sin(rx * 10 + ftime) + FastTrig::sin(rx + ftime);
+
+        // cells are evaluated a block of a column at a time in plain loops over arrays with
+        // no table lookups or branches so the compiler can vectorise them
+        float v[COORDINATE_FIELD_BLOCK];
+        float c1[COORDINATE_FIELD_BLOCK];
+        float c2[COORDINATE_FIELD_BLOCK];
+        float c3[COORDINATE_FIELD_BLOCK];
+        for (int y0 = 0; y0 < buffer.BufferHt; y0 += COORDINATE_FIELD_BLOCK) {
+            const int n = std::min(COORDINATE_FIELD_BLOCK, buffer.BufferHt - y0);
+            const float *bry = ry + y0;
+            const float *bradius = radius + y0;
+            const float *browSin = rowSin.data() + y0;
+            const float *bcy2 = cy2.data() + y0;
 
-        for (int y=0; y<buffer.BufferHt; y++)
-        {
             // reference: http://www.bidouille.org/prog/plasma
+            // kept apart as sqrt may set errno which stops some compilers vectorising the loop
+            for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                c1[i] = std::sqrt(style50 * (cx2 + bcy2[i]) + ftime);
+            }
+            for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                float vv = v1;
+                //  second equation
+                vv += FastTrig::sin(10 * (rxs + bry[i] * cos_time_3) + ftime);
+                //  third equation
+                vv += FastTrig::sin(c1[i]);
+                //    vec2 c = v_coords * u_k - u_k/2.0;
+                vv += browSin[i];
+                vv += FastTrig::sin((rx + bry[i] + ftime) / 2.0f);
+                //   c += u_k/2.0 * vec2(buffer.sin (u_time/3.0), buffer.cos (u_time/2.0));
+                vv += FastTrig::sin(bradius[i] + ftime);
+                // vec3 col = vec3(1, buffer.sin (PI*v), buffer.cos (PI*v));
+                //   gl_FragColor = vec4(col*.5 + .5, 1);
+                v[i] = vv * vScale;
+            }
 
-            double ry = ((float)y/(buffer.BufferHt-1)) ;
-            double v = v1;
-
-            //  second equation
-            v+=buffer.sin (10*(rx*sin_time_2+ry*cos_time_3)+time);
-
-            //  third equation
-            double cy=ry+.5*cos_time_3;
-            v+=buffer.sin ( sqrt((Style*50)*((cx2)+(cy*cy))+time));
-
-            //    vec2 c = v_coords * u_k - u_k/2.0;
-            v += sin_rx_time;
-            v += buffer.sin ((ry+time)/2.0);
-            v += buffer.sin ((rx+ry+time)/2.0);
-            //   c += u_k/2.0 * vec2(buffer.sin (u_time/3.0), buffer.cos (u_time/2.0));
-            v += buffer.sin (sqrt(rx2+ry*ry)+time);
-            v = v/2.0;
-            // vec3 col = vec3(1, buffer.sin (PI*v), buffer.cos (PI*v));
-            //   gl_FragColor = vec4(col*.5 + .5, 1);
-
-            double vldpi = v*Line_Density*pi;
-
-            xlColor color;
             switch (ColorScheme)
             {
                 case PLASMA_NORMAL_COLORS:
-                    {
-                        double h = (buffer.sin (vldpi + 2 * pi3) + 1) * 0.5;
-                        buffer.GetMultiColorBlend(h,false,color);
+                    for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                        c1[i] = (FastTrig::sin(v[i] + 2 * pi3) + 1) * 0.5f;
                     }
                     break;
                 case PLASMA_PRESET1:
-                    color.red = (buffer.sin (vldpi) + 1) * 128;
-                    color.green = (buffer.cos (vldpi) + 1) * 128;
-                    color.blue = 0;
-                    break;
                 case PLASMA_PRESET2:
-                    color.red = 1;
-                    color.green = (buffer.cos (vldpi) + 1) * 128;
-                    color.blue = (buffer.sin (vldpi) + 1) * 128;
+                    for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                        c1[i] = FastTrig::ToChannel(FastTrig::sin(v[i]));
+                        c2[i] = FastTrig::ToChannel(FastTrig::cos(v[i]));
+                    }
                     break;
-
                 case PLASMA_PRESET3:
-                    color.red = (buffer.sin (vldpi) + 1) * 128;
-                    color.green = (buffer.sin (vldpi + 2 * pi3) + 1) * 128;
-                    color.blue = (buffer.sin (vldpi + 4 * pi3) + 1) * 128;
+                    for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                        c1[i] = FastTrig::ToChannel(FastTrig::sin(v[i]));
+                        c2[i] = FastTrig::ToChannel(FastTrig::sin(v[i] + 2 * pi3));
+                        c3[i] = FastTrig::ToChannel(FastTrig::sin(v[i] + 4 * pi3));
+                    }
                     break;
                 case PLASMA_PRESET4:
-                    color.red=color.green=color.blue = (buffer.sin(vldpi) + 1) * 128;
+                    for (int i = 0; i < COORDINATE_FIELD_BLOCK; i++) {
+                        c1[i] = FastTrig::ToChannel(FastTrig::sin(v[i]));
+                    }
                     break;
             }
-            buffer.SetPixel(x,y,color);
+
+            for (int i = 0; i < n; i++) {
+                const int y = y0 + i;
+                if (sparse && !buffer.IsCellOccupied(x, y)) continue;
+
+                xlColor color;
+                switch (ColorScheme)
+                {
+                    case PLASMA_NORMAL_COLORS:
+                        buffer.GetMultiColorBlend(c1[i], false, color);
+                        break;
+                    case PLASMA_PRESET1:
+                        color.red = c1[i];
+                        color.green = c2[i];
+                        color.blue = 0;
+                        break;
+                    case PLASMA_PRESET2:
+                        color.red = 1;
+                        color.green = c2[i];
+                        color.blue = c1[i];
+                        break;
+                    case PLASMA_PRESET3:
+                        color.red = c1[i];
+                        color.green = c2[i];
+                        color.blue = c3[i];
+                        break;
+                    case PLASMA_PRESET4:
+                        color.red = color.green = color.blue = c1[i];
+                        break;
+                }
+                buffer.SetPixel(x, y, color);
+            }
         }
     }, block);
 }
@@ -68,6 +68,8 @@ class RenderableEffect
         //Methods for rendering the effect
         virtual bool CanRenderOnBackgroundThread(Effect *effect, const SettingsMap &settings, RenderBuffer &buffer) { return true; }
         virtual bool SupportsRenderCache(const SettingsMap& settings) const;
+        // true if the effect's EffectRenderCache can Checkpoint() its state so renders can resume part way through the effect
+        virtual bool SupportsStateCheckpoints() const { return false; }
         virtual void Render(Effect *effect, SettingsMap &settings, RenderBuffer &buffer) = 0;
         virtual void RenameTimingTrack(std::string oldname, std::string newname, Effect *effect) { }
         virtual std::list<std::string> CheckEffectSettings(const SettingsMap& settings, AudioManager* media, Model* model, Effect* eff, bool renderCache) { std::list<std::string> res; return res; };
@@ -76,6 +76,7 @@
 #include "../ExternalHooks.h"
 #include "../../xSchedule/wxJSON/jsonreader.h"
 #include "graphics/opengl/DrawGLUtils.h"
+#include "graphics/opengl/xlOffscreenGLContext.h"
 
 #include <wx/regex.h>
 
@@ -86,6 +87,7 @@
 #include <set>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace
 {
@@ -541,8 +543,9 @@ public:
 
     public:
         std::list<unsigned> programIds;
+        const std::string code;
 
-        ShaderInfo(GLint pid) {
+        ShaderInfo(GLint pid, const std::string &c) : code(c) {
             LoadUniforms(pid);
         }
 
@@ -611,16 +614,40 @@ public:
 
     };
 
-    static std::map<std::string, ShaderInfo*> shaderMap;
-    static std::set<std::string> failedShaders;
+    // keyed on ShaderConfig::GetCodeHash() ... the source itself is only compared when hashes match
+    static std::unordered_multimap<size_t, ShaderInfo*> shaderMap;
+    static std::unordered_multimap<size_t, std::string> failedShaders;
     static std::mutex shaderMapMutex;
 
+    static bool SameSource(const std::string &a, const std::string &b) {
+        return a.size() == b.size() && a == b;
+    }
+    // callers must hold shaderMapMutex
+    static ShaderInfo *FindShader(const ShaderConfig *cfg) {
+        auto range = shaderMap.equal_range(cfg->GetCodeHash());
+        for (auto it = range.first; it != range.second; ++it) {
+            if (SameSource(it->second->code, cfg->GetCode())) {
+                return it->second;
+            }
+        }
+        return nullptr;
+    }
+    static bool HasFailed(const ShaderConfig *cfg) {
+        auto range = failedShaders.equal_range(cfg->GetCodeHash());
+        for (auto it = range.first; it != range.second; ++it) {
+            if (SameSource(it->second, cfg->GetCode())) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     ShaderRenderCache() { _shaderConfig = nullptr; }
     virtual ~ShaderRenderCache()
     {
-        if (s_programId != 0 && _shaderConfig != nullptr) {
+        if (s_programId != 0 && s_programShaderInfo != nullptr) {
             std::unique_lock<std::mutex> lock(shaderMapMutex);
-            shaderMap[s_code]->programIds.push_back(s_programId);
+            s_programShaderInfo->programIds.push_back(s_programId);
             s_programId = 0;
         }
         if (_shaderConfig != nullptr) delete _shaderConfig;
@@ -641,7 +668,14 @@ public:
             }
         }
 #else
-        if (preview) {
+        if (offscreenContext) {
+            if (offscreenContext->MakeCurrent()) {
+                DestroyResources();
+                offscreenContext->ReleaseCurrent();
+            }
+            xlOffscreenGLContext::Release(offscreenContext);
+            offscreenContext = nullptr;
+        } else if (preview) {
             unsigned vertexArrayId = s_vertexArrayId;
             unsigned vertexBufferId = s_vertexBufferId;
             unsigned fbId = s_fbId;
@@ -690,9 +724,7 @@ public:
         }
         s_programId = programId;
         s_shaderInfo = si;
-        if (_shaderConfig) {
-            s_code = _shaderConfig->GetCode();
-        }
+        s_programShaderInfo = si;
     }
 
     ShaderConfig* _shaderConfig = nullptr;
@@ -705,7 +737,8 @@ public:
     unsigned s_audioTex = 0;
     unsigned s_programId = 0;
     ShaderInfo *s_shaderInfo = nullptr;
-    std::string s_code;
+    // the shader s_programId was compiled from, kept even if the config is reloaded
+    ShaderInfo *s_programShaderInfo = nullptr;
     int s_rbWidth = 0;
     int s_rbHeight = 0;
     long _timeMS = 0;
@@ -762,11 +795,12 @@ public:
 #elif defined(__WXMSW__)
     GLContextInfo *glContextInfo = nullptr;
 #else
-    xlGLCanvas *preview;
+    xlGLCanvas *preview = nullptr;
+    xlOffscreenGLContext *offscreenContext = nullptr;
 #endif
 };
-std::map<std::string, ShaderRenderCache::ShaderInfo*> ShaderRenderCache::shaderMap;
-std::set<std::string> ShaderRenderCache::failedShaders;
+std::unordered_multimap<size_t, ShaderRenderCache::ShaderInfo*> ShaderRenderCache::shaderMap;
+std::unordered_multimap<size_t, std::string> ShaderRenderCache::failedShaders;
 std::mutex ShaderRenderCache::shaderMapMutex;
 
 bool ShaderEffect::CanRenderOnBackgroundThread(Effect* effect, const SettingsMap& settings, RenderBuffer& buffer)
@@ -782,7 +816,8 @@ bool ShaderEffect::CanRenderOnBackgroundThread(Effect* effect, const SettingsMap
 #elif defined(__WXMSW__)
     return useBackgroundRender;
 #else
-    return false;
+    // with an EGL context we dont need the preview canvas so can render on any thread
+    return xlOffscreenGLContext::IsAvailable();
 #endif
 }
 
@@ -794,6 +829,10 @@ void ShaderEffect::UnsetGLContext(ShaderRenderCache* cache) {
         // release it from the thread every time so we never find ourselves in a situation where it has not been released by a thread
         cache->glContextInfo->UnsetCurrent();
     }
+#else
+    if (cache->offscreenContext != nullptr) {
+        cache->offscreenContext->ReleaseCurrent();
+    }
 #endif
 }
 
@@ -967,6 +1006,16 @@ bool ShaderEffect::SetGLContext(ShaderRenderCache *cache) {
     }
     return true;
 #else
+    if (xlOffscreenGLContext::IsAvailable()) {
+        if (cache->offscreenContext == nullptr) {
+            // we grab it here and release it when the cache is deleted
+            cache->offscreenContext = xlOffscreenGLContext::Acquire();
+            if (cache->offscreenContext == nullptr) {
+                return false;
+            }
+        }
+        return cache->offscreenContext->MakeCurrent();
+    }
     ShaderPanel *p = (ShaderPanel *)panel;
     cache->preview = p->_preview;
     p->_preview->SetCurrentGLContext();
@@ -1322,16 +1371,14 @@ unsigned ShaderEffect::programIdForShaderCode(ShaderConfig* cfg, ShaderRenderCac
     }
 
     std::unique_lock<std::mutex> lock(ShaderRenderCache::shaderMapMutex);
-    std::string fragmentShaderSrc(cfg->GetCode());
-    if (ShaderRenderCache::failedShaders.find(fragmentShaderSrc) != ShaderRenderCache::failedShaders.end()) {
+    const std::string &fragmentShaderSrc = cfg->GetCode();
+    if (ShaderRenderCache::HasFailed(cfg)) {
         //previously failed to compile, don't try again
         return 0u;
     }
 
-    ShaderRenderCache::ShaderInfo *shaderInfo = nullptr;
-    auto iter = ShaderRenderCache::shaderMap.find(fragmentShaderSrc);
-    if (iter != ShaderRenderCache::shaderMap.cend()) {
-        shaderInfo = (*iter).second;
+    ShaderRenderCache::ShaderInfo *shaderInfo = ShaderRenderCache::FindShader(cfg);
+    if (shaderInfo != nullptr) {
         while (!shaderInfo->programIds.empty()) {
             unsigned programId = shaderInfo->programIds.front();
             shaderInfo->programIds.pop_front();
@@ -1350,16 +1397,18 @@ unsigned ShaderEffect::programIdForShaderCode(ShaderConfig* cfg, ShaderRenderCac
     if (programId == 0u) {
         lock.lock();
         logger_base.error("ShaderEffect::programIdForShaderCode() - failed to compile shader program %s", (const char *)cfg->GetFilename().c_str());
-        ShaderRenderCache::failedShaders.emplace(fragmentShaderSrc);
+        if (!ShaderRenderCache::HasFailed(cfg)) {
+            ShaderRenderCache::failedShaders.emplace(cfg->GetCodeHash(), fragmentShaderSrc);
+        }
         lock.unlock();
     } else {
         logger_base.debug("ShaderEffect::programIdForShaderCode() - fragment shader %s compiled successfully", (const char*)cfg->GetFilename().c_str());
         if (shaderInfo == nullptr) {
             lock.lock();
-            shaderInfo = ShaderRenderCache::shaderMap[fragmentShaderSrc];
-            if (shaderInfo  == nullptr) {
-                shaderInfo = new ShaderRenderCache::ShaderInfo(programId);
-                ShaderRenderCache::shaderMap[fragmentShaderSrc] = shaderInfo;
+            shaderInfo = ShaderRenderCache::FindShader(cfg);
+            if (shaderInfo == nullptr) {
+                shaderInfo = new ShaderRenderCache::ShaderInfo(programId, fragmentShaderSrc);
+                ShaderRenderCache::shaderMap.emplace(cfg->GetCodeHash(), shaderInfo);
             }
             lock.unlock();
         }
@@ -1715,6 +1764,7 @@ ShaderConfig::ShaderConfig(const wxString& filename, const wxString& code, const
     _code += prependText.ToStdString();
     _code += shaderCode.ToStdString();
     wxASSERT(_code != "");
+    _codeHash = std::hash<std::string>()(_code);
 #if 0
     std::ofstream s("C:\\Temp\\shader.txt");
     if (s.good())
@@ -164,6 +164,7 @@ class ShaderConfig
     std::string _description;
     std::list<ShaderPass> _passes;
     std::string _code;
+    size_t _codeHash = 0;
     bool _canvasMode = false;
     bool _audioFFTMode = false;
     bool _audioIntensityMode = false;
@@ -178,6 +179,7 @@ public:
     const std::string &GetFilename() const { return _filename; }
     const std::string &GetDescription() const { return _description; }
     const std::string &GetCode() const { return _code; }
+    size_t GetCodeHash() const { return _codeHash; }
     bool IsCanvasShader() const { return _canvasMode; }
     bool IsAudioFFTShader() const { return _audioFFTMode; }
     bool IsAudioIntensityShader() const { return _audioIntensityMode; }
@@ -14,6 +14,7 @@
 #include "../sequencer/Effect.h"
 #include "../RenderBuffer.h"
 #include "../UtilClasses.h"
+#include "ParticleSystem.h"
 
 #include "../../include/snowstorm-16.xpm"
 #include "../../include/snowstorm-24.xpm"
@@ -32,18 +33,6 @@ xlEffectPanel *SnowstormEffect::CreatePanel(wxWindow *parent) {
     return new SnowstormPanel(parent);
 }
 
-class SnowstormClass
-{
-public:
-    std::vector<wxPoint> points;
-    HSVValue hsv;
-    int idx,ssDecay;
-    ~SnowstormClass()
-    {
-        points.clear();
-    }
-};
-
 // 0 <= idx <= 7
 static wxPoint SnowstormVector(int idx)
 {
@@ -85,12 +74,12 @@ static wxPoint SnowstormVector(int idx)
     return xy;
 }
 
-static void SnowstormAdvance(RenderBuffer& buffer, SnowstormClass& ssItem)
+static void SnowstormAdvance(RenderBuffer& buffer, int idx, std::vector<wxPoint>& points)
 {
     const int cnt = 8;  // # of integers in each set in arr[]
     const int arr[] = { 30,20,10,5,0,5,10,20,20,15,10,10,10,10,10,15 }; // 2 sets of 8 numbers, each of which add up to 100
     wxPoint adv = SnowstormVector(7);
-    int i0 = ssItem.idx % 7 <= 4 ? 0 : cnt;
+    int i0 = idx % 7 <= 4 ? 0 : cnt;
     int r = rand() % 100;
     for (int i = 0, val = 0; i < cnt; i++)
     {
@@ -102,26 +91,30 @@ static void SnowstormAdvance(RenderBuffer& buffer, SnowstormClass& ssItem)
         }
     }
 
-    if (ssItem.idx % 3 == 0) {
+    if (idx % 3 == 0) {
         adv.x *= 2;
         adv.y *= 2;
     }
 
-    wxPoint xy = ssItem.points.back() + adv;
+    wxPoint xy = points.back() + adv;
     xy.x %= buffer.BufferWi;
     xy.y %= buffer.BufferHt;
     if (xy.x < 0) xy.x += buffer.BufferWi;
     if (xy.y < 0) xy.y += buffer.BufferHt;
-    ssItem.points.push_back(xy);
+    points.push_back(xy);
 }
 
 class SnowstormRenderCache : public EffectRenderCache {
 public:
     SnowstormRenderCache() {};
     virtual ~SnowstormRenderCache() {};
+    virtual EffectRenderCache* Checkpoint() const override { return new SnowstormRenderCache(*this); }
     
     int LastSnowstormCount;
-    std::list<SnowstormClass> SnowstormItems;
+    // tag is the flake index, age counts the frames it has been fading
+    ParticleSystem SnowstormItems;
+    // the trail of each flake, oldest first ... kept between frames so the storage is reused
+    std::vector<std::vector<wxPoint>> SnowstormTrails;
 };
 
 void SnowstormEffect::SetDefaultParameters()
@@ -155,84 +148,89 @@ void SnowstormEffect::Render(Effect* effect, SettingsMap& SettingsMap, RenderBuf
         cache = new SnowstormRenderCache();
         buffer.infoCache[id] = cache;
     }
-    std::list<SnowstormClass>& SnowstormItems = cache->SnowstormItems;
+    ParticleSystem& SnowstormItems = cache->SnowstormItems;
+    auto& trails = cache->SnowstormTrails;
 
     if (buffer.needToInit || Count != cache->LastSnowstormCount) {
         buffer.needToInit = false;
         // create snowstorm elements
         cache->LastSnowstormCount = Count;
-        SnowstormItems.clear();
+        SnowstormItems.Clear();
+        SnowstormItems.Reserve(Count);
+        trails.resize(std::max(Count, 0));
         for (int i = 0; i < Count; i++)
         {
-            SnowstormClass ssItem;
-            ssItem.idx = i;
-            ssItem.ssDecay = 0;
-            ssItem.points.clear();
-            buffer.SetRangeColor(hsv0, hsv1, ssItem.hsv);
+            HSVValue hsv;
+            buffer.SetRangeColor(hsv0, hsv1, hsv);
+            auto& points = trails[i];
+            points.clear();
 
             // start in a random state
+            int ssDecay = 0;
             int r = rand() % (2 * TailLength);
             if (r > 0) {
                 wxPoint xy;
                 xy.x = rand() % buffer.BufferWi;
                 xy.y = rand() % buffer.BufferHt;
-                ssItem.points.push_back(xy);
+                points.push_back(xy);
             }
             if (r >= TailLength) {
-                ssItem.ssDecay = r - TailLength;
+                ssDecay = r - TailLength;
                 r = TailLength;
             }
             for (int j = 1; j < r; j++) {
-                SnowstormAdvance(buffer, ssItem);
+                SnowstormAdvance(buffer, i, points);
             }
-            SnowstormItems.push_back(ssItem);
+            SnowstormItems.Emit(0.0, 0.0, 0.0, 0.0, hsv, i, ssDecay);
         }
     }
     else
     {
         // This updates the colours where using colour curves
-        for (auto& it : SnowstormItems) {
-            int val = it.hsv.value;
-            buffer.SetRangeColor(hsv0, hsv1, it.hsv);
-            it.hsv.value = val;
+        for (auto& hsv : SnowstormItems.hsv) {
+            int val = hsv.value;
+            buffer.SetRangeColor(hsv0, hsv1, hsv);
+            hsv.value = val;
         }
     }
 
     // render Snowstorm Items
-    for (auto& it : SnowstormItems) {
-        
-        if (it.points.size() > TailLength) {
-            if (it.ssDecay > TailLength) {
-                it.points.clear();  // start over
-                it.ssDecay = 0;
+    for (size_t n = 0; n < SnowstormItems.Size(); n++) {
+        auto& points = trails[n];
+        int& ssDecay = SnowstormItems.age[n];
+
+        if (points.size() > TailLength) {
+            if (ssDecay > TailLength) {
+                points.clear();  // start over
+                ssDecay = 0;
             }
             else if (rand() % 20 < sSpeed) {
-                it.ssDecay++;
+                ssDecay++;
             }
         }
 
-        if (it.points.empty()) {
+        if (points.empty()) {
             wxPoint xy;
             xy.x = rand() % buffer.BufferWi;
             xy.y = rand() % buffer.BufferHt;
-            it.points.push_back(xy);
+            points.push_back(xy);
         }
         else if (rand() % 20 < sSpeed) {
-            SnowstormAdvance(buffer, it);
+            SnowstormAdvance(buffer, SnowstormItems.tag[n], points);
         }
 
-        int sz = it.points.size();
+        int sz = points.size();
         for (int pt = 0; pt < sz; pt++) {
-            HSVValue hsv = it.hsv;
+            HSVValue hsv = SnowstormItems.hsv[n];
             if (buffer.allowAlpha) {
                 xlColor c(hsv);
-                c.alpha = 255.8 * (1.0 - double(sz - pt + it.ssDecay) / TailLength);
-                buffer.SetPixel(it.points[pt].x, it.points[pt].y, c);
+                c.alpha = 255.8 * (1.0 - double(sz - pt + ssDecay) / TailLength);
+                buffer.SetPixel(points[pt].x, points[pt].y, c);
             }
             else {
-                hsv.value = 1.0 - double(sz - pt + it.ssDecay) / TailLength;
+                hsv.value = 1.0 - double(sz - pt + ssDecay) / TailLength;
                 if (hsv.value < 0.0) hsv.value = 0.0;
-                buffer.SetPixel(it.points[pt].x, it.points[pt].y, hsv);
+                buffer.SetPixel(points[pt].x, points[pt].y, hsv);
             }
         }
     }
@@ -103,6 +103,7 @@ void SpiralsEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuffe
 
     SpiralThickness += ThicknessState;
 
+    const bool sparse = buffer.CanRenderSparse();
     for (int ns = 0; ns < SpiralCount; ns++) {
         int strand_base = ns * deltaStrands;
         int ColorIdx = ns % colorcnt;
@@ -115,6 +116,7 @@ void SpiralsEffect::Render(Effect *effect, SettingsMap &SettingsMap, RenderBuffe
             for (int y = 0; y < buffer.BufferHt; y++) {
                 int x = (int)((strand + SpiralState / 10.0 + y * Rotation / buffer.BufferHt)) % buffer.BufferWi;
                 if (x < 0) x += buffer.BufferWi;
+                if (sparse && !buffer.IsCellOccupied(x, y)) continue;
 
                 if (isSpacial) {
                     buffer.palette.GetSpatialColor(ColorIdx, (float)thick / (float)SpiralThickness, (float)y / (float)buffer.BufferHt, color);
@@ -30,6 +30,7 @@
 #include "UtilFunctions.h"
 
 #include "../Parallel.h"
+#include "../RemapTable.h"
 
 namespace
 {
@@ -152,6 +153,17 @@ namespace
 
       return cb.GetPixel( x, y );
    }
+   // the pixel tex2D( cb, s, t, borderColor ) reads or FILL for the border
+   int32_t tex2DIndex( int w, int h, double s, double t )
+   {
+      if ( s < 0. || s > 1. || t < 0. || t > 1. )
+         return RemapTable::FILL;
+
+      int x = int( s * ( w - 1 ) );
+      int y = int( t * ( h - 1 ) );
+
+      return y * w + x;
+   }
 
    xlColor dissolveTex( double s, double t )
    {
@@ -414,7 +426,7 @@ namespace
       return lerp( foo, bar, u.y );
    }
 
-   xlColor mirror(const ColorBuffer& cb, double s, double t, const WarpEffectParams& params)
+   int32_t mirror(int w, int h, double s, double t, const WarpEffectParams& params)
    {
        Vec2D uv(s, t);
        Vec2D pos2(uv);
@@ -425,10 +437,10 @@ namespace
            pos2.y = 2 * params.xy.y - uv.y;
        }
 
-       return tex2D(cb, pos2.x, pos2.y, xlBLACK);
+       return tex2DIndex(w, h, pos2.x, pos2.y);
    }
 
-   xlColor copy(const ColorBuffer& cb, double s, double t, const WarpEffectParams& params)
+   int32_t copy(int w, int h, double s, double t, const WarpEffectParams& params)
    {
        Vec2D uv(s, t);
        Vec2D pos2(uv);
@@ -436,7 +448,7 @@ namespace
        if (pos2.x > params.xy.x) pos2.x -= params.xy.x;
        if (pos2.y > params.xy.y) pos2.y -= params.xy.y;
 
-       return tex2D(cb, pos2.x, pos2.y, xlBLACK);
+       return tex2DIndex(w, h, pos2.x, pos2.y);
    }
 
    xlColor wavy( const ColorBuffer& cb, double s, double t, const WarpEffectParams& params )
@@ -452,6 +464,17 @@ namespace
    }
 
    typedef xlColor( *PixelTransform ) ( const ColorBuffer& cb, double s, double t, const WarpEffectParams& params );
+   // warps that only move pixels and dont depend on progress
+   typedef int32_t( *PixelRemap ) ( int w, int h, double s, double t, const WarpEffectParams& params );
+
+   class WarpRenderCache : public EffectRenderCache
+   {
+   public:
+      WarpRenderCache() {}
+      virtual ~WarpRenderCache() {}
+
+      RemapTable remap;
+   };
 
    void RenderSampleOn(RenderBuffer& rb, double x, double y)
    {
@@ -482,6 +505,23 @@ namespace
             }
         }, 25);
     }
+
+    // The remap only changes when the buffer size or warp centre does so most frames are just a gather
+    void RenderPixelRemap( PixelRemap remap, int warpType, RenderBuffer& rb, const WarpEffectParams& params, RemapTable& table )
+    {
+        std::vector<double> key = { double( warpType ), params.xy.x, params.xy.y };
+        if ( !table.IsValid( rb.BufferWi, rb.BufferHt, key ) ) {
+            table.Reset( rb.BufferWi, rb.BufferHt, key );
+            parallel_for(0, rb.BufferHt, [&rb, &remap, &params, &table](int y) {
+                double t = double( y ) / ( rb.BufferHt - 1 );
+                for ( int x = 0; x < rb.BufferWi; ++x ) {
+                    double s = double( x ) / ( rb.BufferWi - 1 );
+                    table.Set( x, y, remap( rb.BufferWi, rb.BufferHt, s, t, params ) );
+                }
+            }, 25);
+        }
+        table.Apply( rb, xlBLACK );
+    }
 }
 
 WarpEffect::WarpEffect(int i) : RenderableEffect(i, "Warp", warp_16_xpm, warp_24_xpm, warp_32_xpm, warp_48_xpm, warp_64_xpm)
@@ -602,10 +642,13 @@ void WarpEffect::Render(Effect *eff, SettingsMap &SettingsMap, RenderBuffer &buf
         LinearInterpolater interpolater;
         params.speed = interpolate( params.speed, 0.0,0.5, 40.0,5.0, interpolater );
         RenderPixelTransform( wavy, buffer, params );
-    } else if (warpType == WarpEffect::WarpType::MIRROR) {
-        RenderPixelTransform(mirror, buffer, params);
-    } else if (warpType == WarpEffect::WarpType::COPY) {
-        RenderPixelTransform(copy, buffer, params);
+    } else if (warpType == WarpEffect::WarpType::MIRROR || warpType == WarpEffect::WarpType::COPY) {
+        WarpRenderCache *cache = static_cast<WarpRenderCache*>(buffer.infoCache[id]);
+        if (cache == nullptr) {
+            cache = new WarpRenderCache();
+            buffer.infoCache[id] = cache;
+        }
+        RenderPixelRemap(warpType == WarpEffect::WarpType::MIRROR ? mirror : copy, warpType, buffer, params, cache->remap);
     } else if (warpType == WarpEffect::WarpType::SINGLE_WATER_DROP) {
         float cycleCount = std::stof( warpStrCycleCount );
         float intervalLen = 1.f / cycleCount;
@@ -1143,24 +1143,24 @@ public:
         if (ret == 0) {
             ret = input.size();
             MeshVertexInput mvi;
-            mvi.positionX = objects.GetAttrib().vertices[idx.vertex_index * 3];
-            mvi.positionY = objects.GetAttrib().vertices[idx.vertex_index * 3 + 1];
-            mvi.positionZ = objects.GetAttrib().vertices[idx.vertex_index * 3 + 2];
+            mvi.positionX = objects->GetAttrib().vertices[idx.vertex_index * 3];
+            mvi.positionY = objects->GetAttrib().vertices[idx.vertex_index * 3 + 1];
+            mvi.positionZ = objects->GetAttrib().vertices[idx.vertex_index * 3 + 2];
             if (idx.normal_index == -1) {
                 mvi.normalX = 0;
                 mvi.normalY = 0;
                 mvi.normalZ = 0;
             } else {
-                mvi.normalX = objects.GetAttrib().normals[idx.normal_index * 3];
-                mvi.normalY = objects.GetAttrib().normals[idx.normal_index * 3 + 1];
-                mvi.normalZ = objects.GetAttrib().normals[idx.normal_index * 3 + 2];
+                mvi.normalX = objects->GetAttrib().normals[idx.normal_index * 3];
+                mvi.normalY = objects->GetAttrib().normals[idx.normal_index * 3 + 1];
+                mvi.normalZ = objects->GetAttrib().normals[idx.normal_index * 3 + 2];
             }
             if (idx.texcoord_index == -1) {
                 mvi.texcoordX = 0;
                 mvi.texcoordY = 0;
             } else {
-                mvi.texcoordX = objects.GetAttrib().texcoords[idx.texcoord_index * 2];
-                mvi.texcoordY = objects.GetAttrib().texcoords[idx.texcoord_index * 2 + 1];
+                mvi.texcoordX = objects->GetAttrib().texcoords[idx.texcoord_index * 2];
+                mvi.texcoordY = objects->GetAttrib().texcoords[idx.texcoord_index * 2 + 1];
             }
             indexMap[key] = ret;
             input.emplace_back(mvi);
@@ -1184,20 +1184,20 @@ public:
         std::map<simd::int3, uint32_t, CompareSimdInt3> indexMap;
         
         std::vector<MeshVertexInput> input;
-        input.reserve(objects.GetAttrib().vertices.size());
+        input.reserve(objects->GetAttrib().vertices.size());
         input.resize(1); // 0 position is ignored, indexMap[key] == 0 means not found yet
         
         std::vector<uint32_t> indexes;
-        indexes.reserve(objects.GetAttrib().vertices.size());
+        indexes.reserve(objects->GetAttrib().vertices.size());
         
         std::vector<uint32_t> lines;
-        lines.reserve(objects.GetAttrib().vertices.size() * 2);
+        lines.reserve(objects->GetAttrib().vertices.size() * 2);
 
         std::vector<uint32_t> wireFrame;
-        wireFrame.reserve(objects.GetAttrib().vertices.size() * 2);
+        wireFrame.reserve(objects->GetAttrib().vertices.size() * 2);
 
         xlMetalSubMesh *lastMesh = nullptr;
-        for (auto &s : objects.GetShapes()) {
+        for (auto &s : objects->GetShapes()) {
             if (!s.mesh.indices.empty()) {
                 xlMetalSubMesh *sm;
                 if (lastMesh && (s.mesh.material_ids[0] == lastMesh->material)) {
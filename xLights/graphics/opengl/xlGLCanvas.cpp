@@ -965,7 +965,7 @@ public:
             }
             materialsNeedResyncing = false;
             mesh = DrawGLUtils::createMesh();
-            for (auto &s : objects.GetShapes()) {
+            for (auto &s : objects->GetShapes()) {
                 if (!s.mesh.indices.empty()) {
                     for (int idx = 0; idx < s.mesh.material_ids.size(); idx++) {
                         float vert[3][3];
@@ -984,7 +984,7 @@ public:
                         for (int x = 0; x < 3; x++) {
                             tinyobj::index_t vi = s.mesh.indices[idx*3 + x];
 
-                            auto& objVerts = objects.GetAttrib().vertices;
+                            auto& objVerts = objects->GetAttrib().vertices;
                             if ((vi.vertex_index < 0) || ((vi.vertex_index * 3 + 2) >= objVerts.size())) {
                                 vert[x][0] = 0;
                                 vert[x][1] = 0;
@@ -995,7 +995,7 @@ public:
                                 vert[x][2] = objVerts[vi.vertex_index * 3 + 2];
                             }
 
-                            auto& objNorms = objects.GetAttrib().normals;
+                            auto& objNorms = objects->GetAttrib().normals;
                             if ((vi.vertex_index < 0) || ((vi.normal_index * 3 + 2) >= objNorms.size())) {
                                 vert[x][0] = 0;
                                 vert[x][1] = 0;
@@ -1006,7 +1006,7 @@ public:
                                 norms[x][2] = objNorms[vi.normal_index * 3 + 2];
                             }
 
-                            auto& objTexCoords = objects.GetAttrib().texcoords;
+                            auto& objTexCoords = objects->GetAttrib().texcoords;
                             if ((vi.vertex_index < 0) || ((vi.texcoord_index * 2 + 1) >= objTexCoords.size())) {
                                 tc[x][0] = 0;
                                 tc[x][1] = 0;
@@ -1028,9 +1028,9 @@ public:
                         float vert[2][3];
                         for (int x = 0; x < 2; x++) {
                             tinyobj::index_t vi = s.lines.indices[idx + x];
-                            vert[x][0] = objects.GetAttrib().vertices[vi.vertex_index * 3];
-                            vert[x][1] = objects.GetAttrib().vertices[vi.vertex_index * 3 + 1];
-                            vert[x][2] = objects.GetAttrib().vertices[vi.vertex_index * 3 + 2];
+                            vert[x][0] = objects->GetAttrib().vertices[vi.vertex_index * 3];
+                            vert[x][1] = objects->GetAttrib().vertices[vi.vertex_index * 3 + 1];
+                            vert[x][2] = objects->GetAttrib().vertices[vi.vertex_index * 3 + 2];
                         }
                         mesh->addLine(vert);
                     }
@@ -0,0 +1,273 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "xlOffscreenGLContext.h"
+
+#ifdef LINUX
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GL/gl.h>
+#include <GL/glext.h>
+
+#include <cstring>
+#include <list>
+#include <mutex>
+
+#include <log4cpp/Category.hh>
+
+#include "DrawGLUtils.h"
+
+extern PFNGLUSEPROGRAMPROC glUseProgram;
+
+static std::mutex s_offscreenLock;
+static bool s_offscreenInit = false;
+static bool s_offscreenAvailable = false;
+static bool s_surfaceless = false;
+static std::string s_description;
+static EGLDisplay s_display = EGL_NO_DISPLAY;
+static EGLConfig s_config = nullptr;
+static EGLContext s_rootContext = EGL_NO_CONTEXT;
+static std::list<xlOffscreenGLContext*> s_pool;
+
+static const EGLint CONTEXT_ATTRIBS[] = {
+    EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+    EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+    EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+    EGL_NONE
+};
+
+static bool HasExtension(const char* extensions, const char* ext)
+{
+    if (extensions == nullptr) return false;
+    size_t len = strlen(ext);
+    const char* p = extensions;
+    while ((p = strstr(p, ext)) != nullptr) {
+        if ((p == extensions || p[-1] == ' ') && (p[len] == ' ' || p[len] == 0)) {
+            return true;
+        }
+        p += len;
+    }
+    return false;
+}
+
+static EGLDisplay GetOffscreenDisplay()
+{
+    // prefer the surfaceless platform as it does not need an X/Wayland connection
+    if (HasExtension(eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS), "EGL_MESA_platform_surfaceless")) {
+        auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (getPlatformDisplay != nullptr) {
+            EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, nullptr, nullptr);
+            if (display != EGL_NO_DISPLAY) {
+                return display;
+            }
+        }
+    }
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+static EGLSurface CreateSurface()
+{
+    if (s_surfaceless) {
+        return EGL_NO_SURFACE;
+    }
+    static const EGLint pbufferAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+    return eglCreatePbufferSurface(s_display, s_config, pbufferAttribs);
+}
+
+static bool InitOffscreen()
+{
+    static log4cpp::Category& logger_opengl = log4cpp::Category::getInstance(std::string("log_opengl"));
+
+    s_display = GetOffscreenDisplay();
+    if (s_display == EGL_NO_DISPLAY) {
+        logger_opengl.info("Offscreen GL: no EGL display available.");
+        return false;
+    }
+    EGLint major = 0;
+    EGLint minor = 0;
+    if (!eglInitialize(s_display, &major, &minor)) {
+        logger_opengl.info("Offscreen GL: eglInitialize failed 0x%x.", eglGetError());
+        s_display = EGL_NO_DISPLAY;
+        return false;
+    }
+    const char* extensions = eglQueryString(s_display, EGL_EXTENSIONS);
+    if (!HasExtension(extensions, "EGL_KHR_create_context") || !eglBindAPI(EGL_OPENGL_API)) {
+        logger_opengl.info("Offscreen GL: EGL %d.%d does not support desktop OpenGL core contexts.", major, minor);
+        eglTerminate(s_display);
+        s_display = EGL_NO_DISPLAY;
+        return false;
+    }
+    s_surfaceless = HasExtension(extensions, "EGL_KHR_surfaceless_context");
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, s_surfaceless ? 0 : EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_ALPHA_SIZE, 8,
+        EGL_NONE
+    };
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(s_display, configAttribs, &s_config, 1, &numConfigs) || numConfigs < 1) {
+        logger_opengl.info("Offscreen GL: no suitable EGL config.");
+        eglTerminate(s_display);
+        s_display = EGL_NO_DISPLAY;
+        return false;
+    }
+
+    s_rootContext = eglCreateContext(s_display, s_config, EGL_NO_CONTEXT, CONTEXT_ATTRIBS);
+    if (s_rootContext == EGL_NO_CONTEXT) {
+        logger_opengl.info("Offscreen GL: could not create a 3.3 core context 0x%x.", eglGetError());
+        eglTerminate(s_display);
+        s_display = EGL_NO_DISPLAY;
+        return false;
+    }
+
+    // make the root current once so we can load the function pointers and log what we got
+    EGLSurface surface = CreateSurface();
+    if (!eglMakeCurrent(s_display, surface, surface, s_rootContext)) {
+        logger_opengl.info("Offscreen GL: could not make the context current 0x%x.", eglGetError());
+        if (surface != EGL_NO_SURFACE) eglDestroySurface(s_display, surface);
+        eglDestroyContext(s_display, s_rootContext);
+        eglTerminate(s_display);
+        s_rootContext = EGL_NO_CONTEXT;
+        s_display = EGL_NO_DISPLAY;
+        return false;
+    }
+    bool functionsLoaded = glUseProgram != nullptr || DrawGLUtils::LoadGLFunctions();
+    s_description = std::string("EGL ") + std::to_string(major) + "." + std::to_string(minor)
+        + (s_surfaceless ? " surfaceless" : " pbuffer")
+        + " - glVer: " + (const char*)glGetString(GL_VERSION)
+        + " (" + (const char*)glGetString(GL_RENDERER) + ")"
+        + "(" + (const char*)glGetString(GL_VENDOR) + ")";
+    eglMakeCurrent(s_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (surface != EGL_NO_SURFACE) eglDestroySurface(s_display, surface);
+
+    if (!functionsLoaded) {
+        logger_opengl.info("Offscreen GL: could not load GL functions for %s.", s_description.c_str());
+        return false;
+    }
+    logger_opengl.info("Offscreen GL: %s", s_description.c_str());
+    return true;
+}
+
+bool xlOffscreenGLContext::IsAvailable()
+{
+    std::unique_lock<std::mutex> lock(s_offscreenLock);
+    if (!s_offscreenInit) {
+        s_offscreenInit = true;
+        s_offscreenAvailable = InitOffscreen();
+    }
+    return s_offscreenAvailable;
+}
+
+const std::string& xlOffscreenGLContext::GetDescription()
+{
+    IsAvailable();
+    return s_description;
+}
+
+xlOffscreenGLContext* xlOffscreenGLContext::Acquire()
+{
+    if (!IsAvailable()) {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(s_offscreenLock);
+    if (!s_pool.empty()) {
+        xlOffscreenGLContext* context = s_pool.front();
+        s_pool.pop_front();
+        return context;
+    }
+    EGLContext context = eglCreateContext(s_display, s_config, s_rootContext, CONTEXT_ATTRIBS);
+    if (context == EGL_NO_CONTEXT) {
+        static log4cpp::Category& logger_opengl = log4cpp::Category::getInstance(std::string("log_opengl"));
+        logger_opengl.warn("Offscreen GL: eglCreateContext failed 0x%x.", eglGetError());
+        return nullptr;
+    }
+    return new xlOffscreenGLContext(context, CreateSurface());
+}
+
+void xlOffscreenGLContext::Release(xlOffscreenGLContext* context)
+{
+    if (context == nullptr) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(s_offscreenLock);
+    s_pool.push_back(context);
+}
+
+xlOffscreenGLContext::xlOffscreenGLContext(void* context, void* surface) :
+    _context(context), _surface(surface)
+{
+}
+
+xlOffscreenGLContext::~xlOffscreenGLContext()
+{
+    if (_surface != EGL_NO_SURFACE) {
+        eglDestroySurface(s_display, (EGLSurface)_surface);
+    }
+    eglDestroyContext(s_display, (EGLContext)_context);
+}
+
+bool xlOffscreenGLContext::MakeCurrent()
+{
+    return eglMakeCurrent(s_display, (EGLSurface)_surface, (EGLSurface)_surface, (EGLContext)_context) == EGL_TRUE;
+}
+
+void xlOffscreenGLContext::ReleaseCurrent()
+{
+    eglMakeCurrent(s_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+#else
+
+// Only Linux needs these.  OSX creates a context per render cache and Windows
+// uses the GLContextPool in ShaderEffect.
+bool xlOffscreenGLContext::IsAvailable()
+{
+    return false;
+}
+
+const std::string& xlOffscreenGLContext::GetDescription()
+{
+    static std::string none;
+    return none;
+}
+
+xlOffscreenGLContext* xlOffscreenGLContext::Acquire()
+{
+    return nullptr;
+}
+
+void xlOffscreenGLContext::Release(xlOffscreenGLContext* context)
+{
+}
+
+xlOffscreenGLContext::xlOffscreenGLContext(void* context, void* surface) :
+    _context(context), _surface(surface)
+{
+}
+
+xlOffscreenGLContext::~xlOffscreenGLContext()
+{
+}
+
+bool xlOffscreenGLContext::MakeCurrent()
+{
+    return false;
+}
+
+void xlOffscreenGLContext::ReleaseCurrent()
+{
+}
+
+#endif
@@ -0,0 +1,44 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <string>
+
+// Window-less OpenGL contexts for rendering effects (shaders) on background
+// threads.  On Linux these are EGL contexts on a surfaceless (or 1x1 pbuffer)
+// display so they work without a visible canvas and, with Mesa's llvmpipe,
+// without a GPU or X server at all.  All contexts share objects with a hidden
+// root context so compiled programs can be reused by any render thread.
+//
+// Contexts are pooled: a caller Acquire()s one, makes it current on whatever
+// thread it is rendering on, and Release()s it back to the pool when done.
+// Framebuffers and vertex arrays are not shared between contexts so anything
+// created while a context is current must be destroyed with it current too.
+class xlOffscreenGLContext
+{
+public:
+    // true if offscreen contexts can be created on this platform/display
+    static bool IsAvailable();
+    static const std::string& GetDescription();
+
+    static xlOffscreenGLContext* Acquire();
+    static void Release(xlOffscreenGLContext* context);
+
+    bool MakeCurrent();
+    void ReleaseCurrent();
+
+private:
+    xlOffscreenGLContext(void* context, void* surface);
+    ~xlOffscreenGLContext();
+
+    void* _context = nullptr;
+    void* _surface = nullptr;
+};
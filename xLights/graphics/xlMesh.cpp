@@ -10,34 +10,27 @@
 #include <wx/filename.h>
 
 #include "../ExternalHooks.h"
+#include "../ImageAssetCache.h"
 #include "../UtilFunctions.h"
 
 #include <log4cpp/Category.hh>
 
 xlMesh::xlMesh(xlGraphicsContext *ctx, const std::string &f) : graphicsContext(ctx), filename(f) {
-    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     objectsLoaded = false;
     wxFileName fn(filename);
-    
-    tinyobj::ObjReaderConfig reader_config;
-    reader_config.triangulate = true;
-    reader_config.mtl_search_path = fn.GetPath();  // Path to material files
-
-    if (!objects.ParseFromFile(filename, reader_config)) {
-        if (!objects.Error().empty()) {
-            logger_base.error("TinyObjReader: %s", objects.Error().c_str());
-            return;
-        }
-    }
-    if (!objects.Warning().empty()) {
-        logger_base.warn("TinyObjReader: %s", objects.Warning().c_str());
+
+    objects = xlMeshCache::Instance().GetMesh(filename);
+    if (objects == nullptr) {
+        // leave the subclasses an empty mesh to build their buffers from
+        objects = std::make_shared<xlMeshData>();
+        return;
     }
     objectsLoaded = true;
-    
-    
-    materials.resize(objects.GetMaterials().size());
+
+    // The parsed file is shared but the materials are not as models recolour them per instance
+    materials.resize(objects->GetMaterials().size());
     int idx = 0;
-    for (auto &m : objects.GetMaterials()) {
+    for (auto &m : objects->GetMaterials()) {
         float dissolve = m.dissolve * 255.0f;
         float red = m.diffuse[0] * 255.0f;
         float green = m.diffuse[1] * 255.0f;
@@ -58,9 +51,9 @@ xlMesh::xlMesh(xlGraphicsContext *ctx, const std::string &f) : graphicsContext(c
             }
             if (FileExists(texName)) {
                 ObtainAccessToURL(texName);
-                wxImage image(texName);
-                if (image.IsOk()) {
-                    image = image.Mirror(false);
+                auto decoded = ImageAssetCache::Instance().GetImage(texName.ToStdString());
+                if (decoded != nullptr && decoded->IsOk()) {
+                    wxImage image = decoded->WrapImage().Mirror(false);
                     materials[idx].texture = ctx->createTexture(image);
                     materials[idx].texture->SetName(m.diffuse_texname);
                     materials[idx].texture->Finalize();
@@ -70,22 +63,13 @@ xlMesh::xlMesh(xlGraphicsContext *ctx, const std::string &f) : graphicsContext(c
         materials[idx].origColor = materials[idx].color;
         idx++;
     }
-    
-    xMin = 9999999;
-    yMin = 9999999;
-    zMin = 9999999;
-    xMax = -9999999;
-    yMax = -9999999;
-    zMax = -9999999;
-    auto &vertices = objects.GetAttrib().vertices;
-    for (int x = 0; x < vertices.size(); x += 3) {
-        xMin = std::min(vertices[x], xMin);
-        xMax = std::max(vertices[x], xMax);
-        yMin = std::min(vertices[x + 1], yMin);
-        yMax = std::max(vertices[x + 1], yMax);
-        zMin = std::min(vertices[x + 2], zMin);
-        zMax = std::max(vertices[x + 2], zMax);
-    }
+
+    xMin = objects->GetXMin();
+    yMin = objects->GetYMin();
+    zMin = objects->GetZMin();
+    xMax = objects->GetXMax();
+    yMax = objects->GetYMax();
+    zMax = objects->GetZMax();
 }
 
 xlMesh::~xlMesh() {
@@ -4,6 +4,7 @@
 #include <vector>
 #include "../Color.h"
 #include "tiny_obj_loader.h"
+#include "xlMeshCache.h"
 #include "xlGraphicsContext.h"
 
 
@@ -53,7 +54,8 @@ protected:
     std::string filename;
     xlGraphicsContext *graphicsContext;
     
-    tinyobj::ObjReader objects;
+    // shared with every other mesh loaded from the same file, never null
+    xlMeshCache::MeshDataPtr objects;
     bool objectsLoaded;
     
     std::vector<Material> materials;
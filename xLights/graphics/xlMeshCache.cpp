@@ -0,0 +1,447 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "xlMeshCache.h"
+#include "xlMesh.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+
+#include <wx/filename.h>
+
+#include <log4cpp/Category.hh>
+
+#define MESH_SIDECAR_MAGIC "XLMESH01"
+#define MESH_SIDECAR_EXT ".xlmesh"
+
+#pragma region Sidecar serialisation
+
+namespace
+{
+    class SidecarWriter
+    {
+        std::ofstream& _out;
+
+    public:
+        explicit SidecarWriter(std::ofstream& out) : _out(out) {}
+
+        template<typename T>
+        void Write(const T& v)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "only plain values can be written directly");
+            _out.write((const char*)&v, sizeof(T));
+        }
+        void Write(const std::string& s)
+        {
+            Write((uint32_t)s.size());
+            _out.write(s.data(), s.size());
+        }
+        template<typename T>
+        void Write(const std::vector<T>& v)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "only vectors of plain values can be written directly");
+            Write((uint32_t)v.size());
+            _out.write((const char*)v.data(), v.size() * sizeof(T));
+        }
+        bool Ok() const { return _out.good(); }
+    };
+
+    class SidecarReader
+    {
+        std::ifstream& _in;
+        uint64_t _remaining;
+
+        // a count that can't fit in what is left of the file means it is damaged
+        bool Reserve(uint64_t bytes)
+        {
+            if (!_in.good() || bytes > _remaining) {
+                _in.setstate(std::ios::failbit);
+                return false;
+            }
+            _remaining -= bytes;
+            return true;
+        }
+
+    public:
+        SidecarReader(std::ifstream& in, uint64_t size) : _in(in), _remaining(size) {}
+
+        template<typename T>
+        void Read(T& v)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "only plain values can be read directly");
+            if (Reserve(sizeof(T))) {
+                _in.read((char*)&v, sizeof(T));
+            }
+        }
+        void Read(std::string& s)
+        {
+            uint32_t size = 0;
+            Read(size);
+            if (Reserve(size)) {
+                s.resize(size);
+                _in.read(&s[0], size);
+            }
+        }
+        template<typename T>
+        void Read(std::vector<T>& v)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "only vectors of plain values can be read directly");
+            uint32_t size = 0;
+            Read(size);
+            if (Reserve((uint64_t)size * sizeof(T))) {
+                v.resize(size);
+                _in.read((char*)v.data(), (size_t)size * sizeof(T));
+            }
+        }
+        bool Ok() const { return _in.good(); }
+    };
+
+    // Only what xLights draws with is kept ... vertex weights, skin weights, subdivision tags,
+    // texture options and the PBR extensions are not
+    template<typename S, typename A, typename Sh, typename M>
+    void SerialiseMesh(S& s, A& attrib, Sh& shapes, M& materials)
+    {
+        s(attrib.vertices);
+        s(attrib.normals);
+        s(attrib.texcoords);
+        s(attrib.colors);
+
+        for (auto& shape : shapes) {
+            s(shape.name);
+            s(shape.mesh.indices);
+            s(shape.mesh.num_face_vertices);
+            s(shape.mesh.material_ids);
+            s(shape.mesh.smoothing_group_ids);
+            s(shape.lines.indices);
+            s(shape.lines.num_line_vertices);
+            s(shape.points.indices);
+        }
+
+        for (auto& m : materials) {
+            s(m.name);
+            s(m.ambient);
+            s(m.diffuse);
+            s(m.specular);
+            s(m.transmittance);
+            s(m.emission);
+            s(m.shininess);
+            s(m.ior);
+            s(m.dissolve);
+            s(m.illum);
+            s(m.ambient_texname);
+            s(m.diffuse_texname);
+            s(m.specular_texname);
+            s(m.specular_highlight_texname);
+            s(m.bump_texname);
+            s(m.displacement_texname);
+            s(m.alpha_texname);
+            s(m.reflection_texname);
+            s(m.normal_texname);
+        }
+    }
+}
+
+#pragma endregion
+
+#pragma region xlMeshData
+
+void xlMeshData::CalculateBounds()
+{
+    xMin = 9999999;
+    yMin = 9999999;
+    zMin = 9999999;
+    xMax = -9999999;
+    yMax = -9999999;
+    zMax = -9999999;
+    auto& vertices = attrib.vertices;
+    for (size_t x = 0; x + 2 < vertices.size(); x += 3) {
+        xMin = std::min(vertices[x], xMin);
+        xMax = std::max(vertices[x], xMax);
+        yMin = std::min(vertices[x + 1], yMin);
+        yMax = std::max(vertices[x + 1], yMax);
+        zMin = std::min(vertices[x + 2], zMin);
+        zMax = std::max(vertices[x + 2], zMax);
+    }
+}
+
+size_t xlMeshData::GetMemorySize() const
+{
+    size_t size = sizeof(xlMeshData);
+    size += (attrib.vertices.size() + attrib.vertex_weights.size() + attrib.normals.size() +
+             attrib.texcoords.size() + attrib.texcoord_ws.size() + attrib.colors.size()) * sizeof(tinyobj::real_t);
+    for (const auto& s : shapes) {
+        size += sizeof(tinyobj::shape_t) + s.name.size();
+        size += (s.mesh.indices.size() + s.lines.indices.size() + s.points.indices.size()) * sizeof(tinyobj::index_t);
+        size += s.mesh.num_face_vertices.size() + s.mesh.material_ids.size() * sizeof(int) +
+                s.mesh.smoothing_group_ids.size() * sizeof(unsigned int) + s.lines.num_line_vertices.size() * sizeof(int);
+    }
+    size += materials.size() * sizeof(tinyobj::material_t);
+    return size;
+}
+
+#pragma endregion
+
+xlMeshCache& xlMeshCache::Instance()
+{
+    static xlMeshCache cache;
+    return cache;
+}
+
+void xlMeshCache::SetSidecarFolder(const std::string& folder)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _sidecarFolder = folder;
+}
+
+void xlMeshCache::SetMemoryBudget(size_t bytes)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _memoryBudget = bytes;
+    Trim();
+}
+
+void xlMeshCache::Clear()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _cache.clear();
+}
+
+xlMeshCache::FileStamp xlMeshCache::Stamp(const std::string& path)
+{
+    FileStamp stamp;
+    stamp.path = path;
+    std::error_code ec;
+    auto modified = std::filesystem::last_write_time(path, ec);
+    if (!ec) {
+        stamp.modified = (int64_t)modified.time_since_epoch().count();
+        auto size = std::filesystem::file_size(path, ec);
+        stamp.size = ec ? -1 : (int64_t)size;
+    }
+    return stamp;
+}
+
+bool xlMeshCache::StampsCurrent(const std::vector<FileStamp>& stamps)
+{
+    for (const auto& it : stamps) {
+        if (!(Stamp(it.path) == it)) {
+            return false;
+        }
+    }
+    return !stamps.empty();
+}
+
+std::vector<xlMeshCache::FileStamp> xlMeshCache::StampFiles(const std::string& objFile)
+{
+    std::vector<FileStamp> stamps;
+    stamps.push_back(Stamp(objFile));
+
+    wxFileName fn(objFile);
+    for (const auto& it : xlMesh::GetMaterialFilenamesFromOBJ(objFile)) {
+        stamps.push_back(Stamp(fn.GetPath().ToStdString() + wxFileName::GetPathSeparator() + it));
+    }
+    return stamps;
+}
+
+xlMeshCache::MeshDataPtr xlMeshCache::Parse(const std::string& objFile)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    wxFileName fn(objFile);
+    auto data = std::make_shared<xlMeshData>();
+    std::string warn;
+    std::string err;
+    if (!tinyobj::LoadObj(&data->attrib, &data->shapes, &data->materials, &warn, &err,
+                          objFile.c_str(), fn.GetPath().ToStdString().c_str(), true)) {
+        if (!err.empty()) {
+            logger_base.error("TinyObjReader: %s", err.c_str());
+            return nullptr;
+        }
+    }
+    if (!warn.empty()) {
+        logger_base.warn("TinyObjReader: %s", warn.c_str());
+    }
+    data->CalculateBounds();
+    return data;
+}
+
+xlMeshCache::MeshDataPtr xlMeshCache::GetMesh(const std::string& objFile)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    std::unique_lock<std::mutex> lock(_lock);
+
+    auto it = _cache.find(objFile);
+    if (it != _cache.end()) {
+        if (StampsCurrent(it->second.stamps)) {
+            return it->second.data;
+        }
+        logger_base.debug("Mesh file '%s' has changed since it was loaded.", (const char*)objFile.c_str());
+        _cache.erase(it);
+    }
+
+    // Parsing holds the lock so models asking for the same file at the same time wait for
+    // the one parse. Meshes are loaded as the layout is drawn so this is rarely contended.
+    std::vector<FileStamp> stamps;
+    MeshDataPtr data = ReadSidecar(objFile, stamps);
+    if (data == nullptr) {
+        stamps = StampFiles(objFile);
+        data = Parse(objFile);
+        if (data == nullptr) {
+            return nullptr;
+        }
+        WriteSidecar(objFile, stamps, *data);
+    }
+
+    CacheEntry& entry = _cache[objFile];
+    entry.data = data;
+    entry.stamps = std::move(stamps);
+    entry.size = data->GetMemorySize();
+    Trim();
+    return data;
+}
+
+void xlMeshCache::Trim()
+{
+    size_t used = 0;
+    for (const auto& it : _cache) {
+        used += it.second.size;
+    }
+    for (auto it = _cache.begin(); it != _cache.end() && used > _memoryBudget;) {
+        // only the cache holds it
+        if (it->second.data.use_count() == 1) {
+            used -= it->second.size;
+            it = _cache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+std::string xlMeshCache::SidecarFile(const std::string& objFile) const
+{
+    if (_sidecarFolder.empty()) return "";
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx", (unsigned long long)std::hash<std::string>()(objFile));
+    return _sidecarFolder + wxFileName::GetPathSeparator() + name + MESH_SIDECAR_EXT;
+}
+
+xlMeshCache::MeshDataPtr xlMeshCache::ReadSidecar(const std::string& objFile, std::vector<FileStamp>& stamps) const
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    std::string sidecar = SidecarFile(objFile);
+    if (sidecar.empty()) return nullptr;
+
+    std::error_code ec;
+    auto fileSize = std::filesystem::file_size(sidecar, ec);
+    if (ec) return nullptr;
+
+    std::ifstream in(sidecar, std::ios::binary);
+    if (!in.is_open()) return nullptr;
+    SidecarReader reader(in, fileSize);
+
+    char magic[8];
+    reader.Read(magic);
+    uint32_t realSize = 0;
+    reader.Read(realSize);
+    std::string path;
+    reader.Read(path);
+    if (!reader.Ok() || memcmp(magic, MESH_SIDECAR_MAGIC, sizeof(magic)) != 0 || realSize != sizeof(tinyobj::real_t) || path != objFile) {
+        return nullptr;
+    }
+
+    uint32_t stampCount = 0;
+    reader.Read(stampCount);
+    std::vector<FileStamp> sidecarStamps;
+    for (uint32_t i = 0; i < stampCount && reader.Ok(); ++i) {
+        FileStamp stamp;
+        reader.Read(stamp.path);
+        reader.Read(stamp.modified);
+        reader.Read(stamp.size);
+        sidecarStamps.push_back(stamp);
+    }
+    if (!reader.Ok() || !StampsCurrent(sidecarStamps)) {
+        return nullptr;
+    }
+
+    auto data = std::make_shared<xlMeshData>();
+    uint32_t shapeCount = 0;
+    uint32_t materialCount = 0;
+    reader.Read(shapeCount);
+    reader.Read(materialCount);
+    if (!reader.Ok() || (uint64_t)shapeCount + materialCount > fileSize) {
+        return nullptr;
+    }
+    data->shapes.resize(shapeCount);
+    data->materials.resize(materialCount);
+    auto read = [&reader](auto& v) { reader.Read(v); };
+    SerialiseMesh(read, data->attrib, data->shapes, data->materials);
+    if (!reader.Ok()) {
+        logger_base.warn("Mesh cache file '%s' for '%s' is damaged, ignoring it.", (const char*)sidecar.c_str(), (const char*)objFile.c_str());
+        return nullptr;
+    }
+
+    data->CalculateBounds();
+    stamps = std::move(sidecarStamps);
+    logger_base.debug("Mesh file '%s' loaded from cache file '%s'.", (const char*)objFile.c_str(), (const char*)sidecar.c_str());
+    return data;
+}
+
+void xlMeshCache::WriteSidecar(const std::string& objFile, const std::vector<FileStamp>& stamps, const xlMeshData& data) const
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    std::string sidecar = SidecarFile(objFile);
+    if (sidecar.empty()) return;
+
+    std::error_code ec;
+    std::filesystem::create_directories(_sidecarFolder, ec);
+
+    // written to a temporary file and renamed so a half written file is never read
+    std::string temp = sidecar + ".tmp";
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            logger_base.warn("Unable to create mesh cache file '%s'.", (const char*)temp.c_str());
+            return;
+        }
+        SidecarWriter writer(out);
+
+        char magic[8];
+        memcpy(magic, MESH_SIDECAR_MAGIC, sizeof(magic));
+        writer.Write(magic);
+        writer.Write((uint32_t)sizeof(tinyobj::real_t));
+        writer.Write(objFile);
+        writer.Write((uint32_t)stamps.size());
+        for (const auto& it : stamps) {
+            writer.Write(it.path);
+            writer.Write(it.modified);
+            writer.Write(it.size);
+        }
+        writer.Write((uint32_t)data.shapes.size());
+        writer.Write((uint32_t)data.materials.size());
+        auto write = [&writer](const auto& v) { writer.Write(v); };
+        SerialiseMesh(write, data.attrib, data.shapes, data.materials);
+        if (!writer.Ok()) {
+            out.close();
+            std::filesystem::remove(temp, ec);
+            logger_base.warn("Unable to write mesh cache file '%s'.", (const char*)temp.c_str());
+            return;
+        }
+    }
+    std::filesystem::rename(temp, sidecar, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+    }
+}
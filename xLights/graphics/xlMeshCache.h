@@ -0,0 +1,114 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tiny_obj_loader.h"
+
+// The geometry and materials parsed from an OBJ file. Every mesh loaded from the same
+// file shares one of these and it is never modified once it is in the cache.
+class xlMeshData
+{
+    friend class xlMeshCache;
+
+    tinyobj::attrib_t attrib;
+    std::vector<tinyobj::shape_t> shapes;
+    std::vector<tinyobj::material_t> materials;
+
+    float xMin = 9999999;
+    float yMin = 9999999;
+    float zMin = 9999999;
+    float xMax = -9999999;
+    float yMax = -9999999;
+    float zMax = -9999999;
+
+    void CalculateBounds();
+
+public:
+    const tinyobj::attrib_t& GetAttrib() const { return attrib; }
+    const std::vector<tinyobj::shape_t>& GetShapes() const { return shapes; }
+    const std::vector<tinyobj::material_t>& GetMaterials() const { return materials; }
+
+    float GetXMin() const { return xMin; }
+    float GetYMin() const { return yMin; }
+    float GetZMin() const { return zMin; }
+    float GetXMax() const { return xMax; }
+    float GetYMax() const { return yMax; }
+    float GetZMax() const { return zMax; }
+
+    size_t GetMemorySize() const;
+};
+
+// Process wide cache of parsed OBJ files keyed by path. An entry is only used while the
+// OBJ file and the material files it references have the same modification time and size
+// as when it was parsed, so layouts with many copies of the same prop or moving head parse
+// the file once. If a sidecar folder is set parsed files are also written there in a
+// compact binary form which is read back instead of parsing the OBJ on later loads.
+class xlMeshCache
+{
+public:
+    typedef std::shared_ptr<const xlMeshData> MeshDataPtr;
+
+    static xlMeshCache& Instance();
+
+    // Returns nullptr if the file can't be parsed
+    MeshDataPtr GetMesh(const std::string& objFile);
+
+    // Folder to keep the binary copies of parsed files in, "" to not keep them
+    void SetSidecarFolder(const std::string& folder);
+
+    // Parsed files nothing is using are dropped once the cache holds more than this
+    void SetMemoryBudget(size_t bytes);
+    void Clear();
+
+private:
+    xlMeshCache() {}
+
+    struct FileStamp
+    {
+        std::string path;
+        int64_t modified = -1;
+        int64_t size = -1;
+
+        bool operator==(const FileStamp& other) const
+        {
+            return path == other.path && modified == other.modified && size == other.size;
+        }
+    };
+
+    struct CacheEntry
+    {
+        MeshDataPtr data;
+        std::vector<FileStamp> stamps;   // the obj file then its material files
+        size_t size = 0;
+    };
+
+    static FileStamp Stamp(const std::string& path);
+    static bool StampsCurrent(const std::vector<FileStamp>& stamps);
+    static std::vector<FileStamp> StampFiles(const std::string& objFile);
+    static MeshDataPtr Parse(const std::string& objFile);
+
+    std::string SidecarFile(const std::string& objFile) const;
+    MeshDataPtr ReadSidecar(const std::string& objFile, std::vector<FileStamp>& stamps) const;
+    void WriteSidecar(const std::string& objFile, const std::vector<FileStamp>& stamps, const xlMeshData& data) const;
+    void Trim();
+
+    std::mutex _lock;
+    std::map<std::string, CacheEntry> _cache;
+    std::string _sidecarFolder;
+    size_t _memoryBudget = 256 * 1024 * 1024;
+};
@@ -13,6 +13,7 @@
 #include <wx/propgrid/propgrid.h>
 #include <wx/propgrid/advprops.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "CustomModel.h"
@@ -239,69 +240,126 @@ int CustomModel::OnPropertyGridChange(wxPropertyGridInterface* grid, wxPropertyG
     return Model::OnPropertyGridChange(grid, event);
 }
 
-std::tuple<int, int, int> FindNode(int node, const std::vector<std::vector<std::vector<int>>>& locations)
+// Parses a non negative number without going through wxString. Blanks, text, negative
+// numbers and overflow all return false just as the old stoi based parsing ignored them
+static bool ParseCellNumber(const char*& p, const char* end, int& value)
 {
-    for (int l = 0; l < locations.size(); l++) {
-        for (int r = 0; r < locations[l].size(); r++) {
-            for (int c = 0; c < locations[l][r].size(); c++) {
-                if (locations[l][r][c] == node + 1) {
-                    return { l, r, c };
-                }
-            }
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) {
+        ++p;
+    }
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+    int64_t v = 0;
+    bool digits = false;
+    while (p < end && *p >= '0' && *p <= '9') {
+        if (v <= INT32_MAX) {
+            v = v * 10 + (*p - '0');
         }
+        digits = true;
+        ++p;
+    }
+    if (!digits || negative || v > INT32_MAX) {
+        return false;
     }
-    wxASSERT(false);
-    return { -1,-1,-1 };
+    value = (int)v;
+    return true;
 }
 
-std::vector<std::vector<std::vector<int>>> ParseCustomModel(const wxString& data, int width, int height, int depth)
+void CustomModelLayout::AddCell(int node, int layer, int row, int col)
 {
-    std::vector<std::vector<std::vector<int>>> res;
-
-    wxASSERT(width > 0);
-    wxASSERT(height > 0);
-    wxASSERT(depth > 0);
-
-    if (data == "") {
-        for (int l = 0; l < depth; l++) {
-            std::vector<std::vector<int>> ll;
-            for (int r = 0; r < height; r++) {
-                std::vector<int> rr;
-                for (int c = 0; c < width; c++) {
-                    rr.push_back(-1);
-                }
-                ll.push_back(rr);
-            }
-            res.push_back(ll);
+    // a cell can only hold one node ... first one wins
+    if (_cellNodes.emplace(CellKey(layer, row, col), node).second) {
+        _nodeCells[node].push_back({ layer, row, col });
+    }
+}
+
+void CustomModelLayout::Finalise()
+{
+    _nodes.clear();
+    _nodes.reserve(_nodeCells.size());
+    for (const auto& it : _nodeCells) {
+        _nodes.push_back(it.first);
+    }
+    std::sort(_nodes.begin(), _nodes.end());
+}
+
+CustomModelLayout CustomModelLayout::ParseLegacy(const std::string& data)
+{
+    CustomModelLayout res;
+
+    const char* p = data.c_str();
+    const char* end = p + data.size();
+    int layer = 0;
+    int row = 0;
+    int col = 0;
+    while (true) {
+        int node = 0;
+        if (ParseCellNumber(p, end, node) && node > 0) {
+            res.AddCell(node, layer, row, col);
+        }
+        while (p < end && *p != ',' && *p != ';' && *p != '|') {
+            ++p;
+        }
+        res._width = std::max(res._width, col + 1);
+        res._height = std::max(res._height, row + 1);
+        res._depth = std::max(res._depth, layer + 1);
+        if (p >= end) {
+            break;
+        }
+        char sep = *p++;
+        if (sep == ',') {
+            col++;
+        }
+        else if (sep == ';') {
+            row++;
+            col = 0;
+        }
+        else {
+            layer++;
+            row = 0;
+            col = 0;
         }
     }
-    else {
-        wxArrayString layers = wxSplit(data, '|');
-        for (auto l : layers) {
-            std::vector<std::vector<int>> ll;
-            wxArrayString rows = wxSplit(l, ';');
-            for (auto r : rows) {
-                std::vector<int> rr;
-                wxArrayString columns = wxSplit(r, ',');
-                for (auto c : columns) {
-                    if (c == "") rr.push_back(-1);
-                    else rr.push_back(wxAtoi(c));
+    res.Finalise();
+    return res;
+}
+
+std::string CustomModelLayout::ToLegacyString() const
+{
+    std::string res;
+    res.reserve((size_t)_width * _height * _depth + _cellNodes.size() * 4);
+    for (int l = 0; l < _depth; l++) {
+        if (l != 0) res += '|';
+        for (int r = 0; r < _height; r++) {
+            if (r != 0) res += ';';
+            for (int c = 0; c < _width; c++) {
+                if (c != 0) res += ',';
+                int node = GetNodeAt(l, r, c);
+                if (node > 0) {
+                    res += std::to_string(node);
                 }
-                while (rr.size() < width) rr.push_back(-1);
-                ll.push_back(rr);
             }
-            // this should not happen but I have seen situations where it does ... so pad out the model to the right size
-            while (ll.size() < height) {
-                std::vector<int> rr;
-                while (rr.size() < width) rr.push_back(-1);
-                ll.push_back(rr);
-            }
-            res.push_back(ll);
         }
     }
     return res;
 }
 
+int CustomModelLayout::GetNodeAt(int layer, int row, int col) const
+{
+    auto it = _cellNodes.find(CellKey(layer, row, col));
+    return it == _cellNodes.end() ? -1 : it->second;
+}
+
+const std::vector<CustomModelLayout::Cell>& CustomModelLayout::GetNodeCells(int node) const
+{
+    static const std::vector<Cell> empty;
+    auto it = _nodeCells.find(node);
+    return it == _nodeCells.end() ? empty : it->second;
+}
+
 int CustomModel::GetStrandLength(int strand) const
 {
     return Nodes.size();
@@ -320,15 +378,31 @@ void CustomModel::UpdateModel(int width, int height, int depth, const std::strin
     ModelXml->AddAttribute("parm2", wxString::Format("%d", height));
     ModelXml->DeleteAttribute("Depth");
     ModelXml->AddAttribute("Depth", wxString::Format("%d", depth));
-    ModelXml->DeleteAttribute("CustomModel");
-    ModelXml->AddAttribute("CustomModel", modelData);
+    StoreCustomData(modelData);
     SetFromXml(ModelXml, zeroBased);
 }
 
+void CustomModel::StoreCustomData(const std::string& data)
+{
+    ModelXml->DeleteAttribute("CustomModel");
+    ModelXml->AddAttribute("CustomModel", data);
+}
+
+// Only reparse when the model data actually changed as this is called on every start channel recalc
+void CustomModel::LoadLayout()
+{
+    // an empty layout parses to the default so the first load with no data can be skipped too
+    std::string source = ModelXml->GetAttribute("CustomModel").ToStdString();
+    if (source != _layoutSource) {
+        _layout = CustomModelLayout::ParseLegacy(source);
+        _layoutSource.swap(source);
+    }
+}
+
 void CustomModel::InitModel()
 {
-    std::string customModel = ModelXml->GetAttribute("CustomModel").ToStdString();
-    InitCustomMatrix(customModel);
+    LoadLayout();
+    InitCustomMatrix();
     //CopyBufCoord2ScreenCoord();
     custom_background = ModelXml->GetAttribute("CustomBkgImage").ToStdString();
     _strings = wxAtoi(ModelXml->GetAttribute("CustomStrings", "1"));
@@ -369,8 +443,7 @@ std::string CustomModel::GetCustomData() const
 
 void CustomModel::SetCustomData(const std::string& data)
 {
-    ModelXml->DeleteAttribute("CustomModel");
-    ModelXml->AddAttribute("CustomModel", data);
+    StoreCustomData(data);
     SetFromXml(ModelXml, zeroBased);
 }
 
@@ -433,9 +506,9 @@ std::list<std::string> CustomModel::GetFileReferences()
 
 void CustomModel::SetStringStartChannels(bool zeroBased, int NumberOfStrings, int StartChannel, int ChannelsPerString)
 {
-    std::string customModel = ModelXml->GetAttribute("CustomModel").ToStdString();
+    LoadLayout();
     _strings = wxAtoi(ModelXml->GetAttribute("CustomStrings", "1").ToStdString());
-    int maxval = GetCustomMaxChannel(customModel);
+    int maxval = _layout.GetMaxNode();
     // fix NumberOfStrings
     if (SingleNode) {
         NumberOfStrings = maxval;
@@ -476,21 +549,6 @@ int CustomModel::NodesPerString() const
     }
 }
 
-inline void split(std::string frag, char splitBy, std::vector<std::string>& tokens)
-{
-    // Loop infinitely - break is internal.
-    while (true) {
-        size_t splitAt = frag.find(splitBy);
-        // If we didn't find a new split point...
-        if (splitAt == std::string::npos) {
-            tokens.push_back(frag);
-            break;
-        }
-        tokens.push_back(frag.substr(0, splitAt));
-        frag.erase(0, splitAt + 1);
-    }
-}
-
 static std::vector<std::string> CUSTOM_BUFFERSTYLES =
 {
     "Default",
@@ -524,7 +582,7 @@ void CustomModel::GetBufferSize(const std::string& type, const std::string& came
 
     if ((SingleNode || SingleChannel) && IsMultiCoordsPerNode())
     {
-        BufferWi = GetCustomMaxChannel(ModelXml->GetAttribute("CustomModel"));
+        BufferWi = _layout.GetMaxNode();
         BufferHi = 1;
     }
     else if (StartsWith(type, "Per Preview") || type == "Single Line" || type == "As Pixel" ||
@@ -626,18 +684,26 @@ void CustomModel::InitRenderBufferNodes(const std::string& type, const std::stri
 
     GetBufferSize(type, camera, transform, BufferWi, BufferHi);
 
-    auto locations = ParseCustomModel(ModelXml->GetAttribute("CustomModel"), width, height, depth);
+    // the first cell of each node in layer, row, col order
+    auto FindNode = [this](const NodeBaseClassPtr& node) -> std::tuple<int, int, int> {
+        const auto& cells = _layout.GetNodeCells(node->StringNum + 1);
+        if (cells.empty()) {
+            wxASSERT(false);
+            return { -1, -1, -1 };
+        }
+        return { cells.front().layer, cells.front().row, cells.front().col };
+    };
 
     if (type == "Stacked X Horizontally") {
         for (auto n = 0; n < Nodes.size(); n++) {
-            auto loc = FindNode(n, locations);
+            auto loc = FindNode(Nodes[n]);
             Nodes[n]->Coords[0].bufX = depth - std::get<0>(loc) - 1 + std::get<2>(loc) * depth;
             Nodes[n]->Coords[0].bufY = height - std::get<1>(loc) - 1;
         }
     }
     else if (type == "Stacked Y Horizontally") {
         for (size_t n = 0; n < Nodes.size(); n++) {
-            auto loc = FindNode(n, locations);
+            auto loc = FindNode(Nodes[n]);
             Nodes[n]->Coords[0].bufX = std::get<2>(loc) + std::get<1>(loc) * width;
             Nodes[n]->Coords[0].bufY = std::get<0>(loc);
         }
@@ -647,63 +713,63 @@ void CustomModel::InitRenderBufferNodes(const std::string& type, const std::stri
     }
     else if (type == "Stacked X Vertically") {
         for (size_t n = 0; n < Nodes.size(); n++) {
-            auto loc = FindNode(n, locations);
+            auto loc = FindNode(Nodes[n]);
             Nodes[n]->Coords[0].bufX = depth - std::get<0>(loc) - 1;
             Nodes[n]->Coords[0].bufY = std::get<1>(loc) + height * std::get<2>(loc);
         }
     }
     else if (type == "Stacked Y Vertically") {
         for (size_t n = 0; n < Nodes.size(); n++) {
-            auto loc = FindNode(n, locations);
+            auto loc = FindNode(Nodes[n]);
             Nodes[n]->Coords[0].bufX = std::get<2>(loc);
             Nodes[n]->Coords[0].bufY = std::get<0>(loc) + depth * std::get<1>(loc);
         }
     }
     else if (type == "Stacked Z Vertically") {
         for (size_t n = 0; n < Nodes.size(); n++) {
-            auto loc = FindNode(n, locations);
+            auto loc = FindNode(Nodes[n]);
             Nodes[n]->Coords[0].bufX = std::get<2>(loc);
             Nodes[n]->Coords[0].bufY = std::get<1>(loc) + depth * std::get<0>(loc);
         }
     }
     else if (type == "Overlaid X") {
         for (size_t n = 0; n < Nodes.size(); n++) {
-            auto loc = FindNode(n, locations);
+            auto loc = FindNode(Nodes[n]);
             Nodes[n]->Coords[0].bufX = depth - std::get<0>(loc) - 1;
             Nodes[n]->Coords[0].bufY = height - std::get<1>(loc) - 1;
         }
     }
     else if (type == "Overlaid Y") {
         for (size_t n = 0; n < Nodes.size(); n++) {
-            auto loc = FindNode(n, locations);
+            auto loc = FindNode(Nodes[n]);
             Nodes[n]->Coords[0].bufX = std::get<2>(loc);
             Nodes[n]->Coords[0].bufY = std::get<0>(loc);
         }
     }
     else if (type == "Overlaid Z") {
         for (size_t n = 0; n < Nodes.size(); n++) {
-            auto loc = FindNode(n, locations);
+            auto loc = FindNode(Nodes[n]);
             Nodes[n]->Coords[0].bufX = std::get<2>(loc);
             Nodes[n]->Coords[0].bufY = height - std::get<1>(loc) - 1;
         }
     }
     else if (type == "Unique X and Y X") {
         for (size_t n = 0; n < Nodes.size(); n++) {
-            auto loc = FindNode(n, locations);
+            auto loc = FindNode(Nodes[n]);
             Nodes[n]->Coords[0].bufX = depth - std::get<0>(loc) - 1 + std::get<2>(loc) * depth;
             Nodes[n]->Coords[0].bufY = std::get<1>(loc) + std::get<2>(loc) * height;
         }
     }
     else if (type == "Unique X and Y Y") {
         for (size_t n = 0; n < Nodes.size(); n++) {
-            auto loc = FindNode(n, locations);
+            auto loc = FindNode(Nodes[n]);
             Nodes[n]->Coords[0].bufX = std::get<2>(loc) + std::get<1>(loc) * width;
             Nodes[n]->Coords[0].bufY = std::get<0>(loc) + std::get<1>(loc) * depth;
         }
     }
     else if (type == "Unique X and Y Z") {
         for (size_t n = 0; n < Nodes.size(); n++) {
-            auto loc = FindNode(n, locations);
+            auto loc = FindNode(Nodes[n]);
             Nodes[n]->Coords[0].bufX = std::get<2>(loc) + std::get<0>(loc) * width;
             Nodes[n]->Coords[0].bufY = std::get<1>(loc) + (height - std::get<1>(loc) - 1) * height;
         }
@@ -713,34 +779,11 @@ void CustomModel::InitRenderBufferNodes(const std::string& type, const std::stri
     }
 }
 
-int CustomModel::GetCustomMaxChannel(const std::string& customModel) const
-{
-    int maxval = 0;
-
-    std::string cm = customModel;
-    std::replace(cm.begin(), cm.end(), '|', ',');
-    std::replace(cm.begin(), cm.end(), ';', ',');
-    std::stringstream ss(cm);
-    std::string token;
-
-    while (std::getline(ss, token, ',')) {
-        if (token != "") {
-            try {
-                maxval = std::max(std::stoi(token), maxval);
-            }
-            catch (...) {
-                // not a number, treat as 0
-            }
-        }
-    }
-    return maxval;
-}
-
-void CustomModel::InitCustomMatrix(const std::string& customModel)
+void CustomModel::InitCustomMatrix()
 {
-    float width = 1.0;
-    float height = 1.0;
-    std::vector<int> nodemap;
+    float width = _layout.GetWidth();
+    float height = _layout.GetHeight();
+    float depth = _layout.GetDepth();
 
     int32_t firstStartChan = 999999999;
     for (auto it : stringStartChan) {
@@ -748,97 +791,29 @@ void CustomModel::InitCustomMatrix(const std::string& customModel)
     }
 
     int cpn = -1;
-    std::vector<std::string> layers;
-    std::vector<std::string> rows;
-    std::vector<std::string> cols;
-    layers.reserve(20);
-    rows.reserve(100);
-    cols.reserve(100);
-
-    split(customModel, '|', layers);
-    float depth = layers.size();
-    int layer = 0;
-
-    for (auto lv : layers) {
-        rows.clear();
-        split(lv, ';', rows);
-        height = rows.size();
-
-        int row = 0;
-        for (auto rv : rows) {
-            cols.clear();
-            split(rv, ',', cols);
-            if (cols.size() > width) width = cols.size();
-            int col = 0;
-            for (auto value : cols) {
-                while (value.length() > 0 && value[0] == ' ') {
-                    value = value.substr(1);
-                }
-                long idx = -1;
-                if (value != "") {
-                    try {
-                        idx = std::stoi(value);
-                    }
-                    catch (...) {
-                        // not a number, treat as 0
-                    }
-                }
-                if (idx > 0) {
-                    // increase nodemap size if necessary
-                    if (idx > nodemap.size()) {
-                        nodemap.resize(idx, -1);
-                    }
-                    idx--;  // adjust to 0-based
-
-                    // is node already defined in map?
-                    if (nodemap[idx] < 0) {
-                        // unmapped - so add a node
-                        nodemap[idx] = Nodes.size();
-                        SetNodeCount(1, 0, rgbOrder);  // this creates a node of the correct class
-                        Nodes.back()->StringNum = idx;
-                        if (cpn == -1) {
-                            cpn = GetChanCountPerNode();
-                        }
-                        Nodes.back()->ActChan = firstStartChan + idx * cpn;
-                        if (idx < nodeNames.size() && nodeNames[idx] != "") {
-                            Nodes.back()->SetName(nodeNames[idx]);
-                        }
-                        else {
-                            Nodes.back()->SetName("Node " + std::to_string(idx + 1));
-                        }
-
-                        Nodes.back()->AddBufCoord(layer * width + col, height - row - 1);
-                        auto& c = Nodes[nodemap[idx]]->Coords.back();
-                        c.screenX = (float)col - width / 2.0f;
-                        c.screenY = height - (float)row - 1.0f - height / 2.0f;
-                        c.screenZ = depth - (float)layer - 1.0f - depth / 2.0f;
-                    }
-                    else {
-                        // mapped - so add a coord to existing node
-                        Nodes[nodemap[idx]]->AddBufCoord(layer * width + col, height - row - 1);
-                        auto& c = Nodes[nodemap[idx]]->Coords.back();
-                        c.screenX = (float)col - width / 2.0f;
-                        c.screenY = height - (float)row - 1.0f - height / 2.0f;
-                        c.screenZ = depth - (float)layer - 1.0f - depth / 2.0f;
-                    }
-                }
-                col++;
-            }
-            row++;
+    // nodes are created in node number order so no sorting is required afterwards
+    for (int node : _layout.GetNodes()) {
+        int idx = node - 1; // adjust to 0-based
+
+        SetNodeCount(1, 0, rgbOrder); // this creates a node of the correct class
+        Nodes.back()->StringNum = idx;
+        if (cpn == -1) {
+            cpn = GetChanCountPerNode();
         }
-        layer++;
-    }
-
-    for (int x = 0; x < Nodes.size(); x++) {
-        for (int y = x + 1; y < Nodes.size(); y++) {
-            if (Nodes[y]->StringNum < Nodes[x]->StringNum) {
-                Nodes[x].swap(Nodes[y]);
-            }
+        Nodes.back()->ActChan = firstStartChan + idx * cpn;
+        if (idx < nodeNames.size() && nodeNames[idx] != "") {
+            Nodes.back()->SetName(nodeNames[idx]);
         }
-    }
-    for (int x = 0; x < Nodes.size(); x++) {
-        if (Nodes[x]->GetName() == "") {
-            Nodes[x]->SetName(GetNodeName(Nodes[x]->StringNum));
+        else {
+            Nodes.back()->SetName("Node " + std::to_string(idx + 1));
+        }
+
+        for (const auto& cell : _layout.GetNodeCells(node)) {
+            Nodes.back()->AddBufCoord(cell.layer * width + cell.col, height - cell.row - 1);
+            auto& c = Nodes.back()->Coords.back();
+            c.screenX = (float)cell.col - width / 2.0f;
+            c.screenY = height - (float)cell.row - 1.0f - height / 2.0f;
+            c.screenZ = depth - (float)cell.layer - 1.0f - depth / 2.0f;
         }
     }
 
@@ -1071,48 +1046,23 @@ std::string CustomModel::ChannelLayoutHtml(OutputManager* outputManager) {
     }
     html += "</table><p>Node numbers starting with 1 followed by string number:</p><table border=1>";
 
-    std::string data = GetCustomData();
-    if (data == "") {
+    if (_layout.GetNodes().empty()) {
         html += "<tr><td>No custom data</td></tr>";
     }
     else {
-        std::vector<std::vector<std::vector<wxString>>> _data;
-        int cols = parm1;
-        wxArrayString layers = wxSplit(data, '|');
-        for (auto l : layers) {
-            std::vector<std::vector<wxString>> ll;
-            wxArrayString rows = wxSplit(l, ';');
-            for (auto r : rows) {
-                std::vector<wxString> rr;
-                wxArrayString columns = wxSplit(r, ',');
-                for (auto c : columns) {
-                    rr.push_back(c);
-                }
-                while (rr.size() < cols) rr.push_back("");
-                ll.push_back(rr);
-            }
-            // This should never happen but i have seen files where it did so lets just pad it and not crash
-            while (ll.size() < parm2) {
-                std::vector<wxString> rr;
-                while (rr.size() < cols) rr.push_back("");
-                ll.push_back(rr);
-            }
-            _data.push_back(ll);
-        }
-
         for (int r = 0; r < parm2; r++) {
             html += "<tr>";
             for (int l = 0; l < _depth; l++) {
                 for (int c = 0; c < parm1; c++) {
-                    wxString value = _data[l][r][c];
-                    if (!value.IsEmpty() && value != "0") {
+                    int node = _layout.GetNodeAt(l, r, c);
+                    if (node > 0) {
                         wxString bgcolor = "#ADD8E6"; //"#90EE90"
                         if (_strings == 1) {
-                            html += wxString::Format("<td bgcolor='" + bgcolor + "'>n%s</td>", value);
+                            html += wxString::Format("<td bgcolor='" + bgcolor + "'>n%d</td>", node);
                         }
                         else {
-                            int string = GetCustomNodeStringNumber(wxAtoi(value));
-                            html += wxString::Format("<td bgcolor='" + bgcolor + "'>n%ss%d</td>", value, string);
+                            int string = GetCustomNodeStringNumber(node);
+                            html += wxString::Format("<td bgcolor='" + bgcolor + "'>n%ds%d</td>", node, string);
                         }
                     }
                     else {
@@ -1435,7 +1385,8 @@ void CustomModel::ExportXlightsModel()
     //    bool isnew = !FileExists(filename);
     if (!f.Create(filename, true) || !f.IsOpened())
         DisplayError(wxString::Format("Unable to create file %s. Error %d\n", filename, f.GetLastError()).ToStdString());
-    wxString cm = ModelXml->GetAttribute("CustomModel");
+    // xmodel files are always written in the legacy format so older versions can import them
+    wxString cm = GetCustomData();
     wxString p1 = ModelXml->GetAttribute("parm1");
     wxString p2 = ModelXml->GetAttribute("parm2");
     wxString d = ModelXml->GetAttribute("Depth");
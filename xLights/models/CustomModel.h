@@ -10,8 +10,57 @@
  * License: https://github.com/smeighan/xLights/blob/master/License.txt
  **************************************************************/
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "Model.h"
 
+// Sparse view of a custom model grid. Only occupied cells are held so looking up the node
+// in a cell or the cells of a node does not depend on the width x height x depth of the grid.
+class CustomModelLayout
+{
+public:
+    struct Cell
+    {
+        int layer;
+        int row;
+        int col;
+    };
+
+    // legacy format: "n,n,,n;n,,n|..." ... columns split by ',' rows by ';' and layers by '|'
+    static CustomModelLayout ParseLegacy(const std::string& data);
+
+    std::string ToLegacyString() const;
+
+    // returns the 1 based node number in the cell or -1 if the cell is empty
+    int GetNodeAt(int layer, int row, int col) const;
+    // cells are in layer, row, col order
+    const std::vector<Cell>& GetNodeCells(int node) const;
+    // all node numbers used in ascending order
+    const std::vector<int>& GetNodes() const { return _nodes; }
+    int GetMaxNode() const { return _nodes.empty() ? 0 : _nodes.back(); }
+
+    int GetWidth() const { return _width; }
+    int GetHeight() const { return _height; }
+    int GetDepth() const { return _depth; }
+
+private:
+    static uint64_t CellKey(int layer, int row, int col)
+    {
+        return ((uint64_t)(uint32_t)layer << 42) | ((uint64_t)(uint32_t)row << 21) | (uint64_t)(uint32_t)col;
+    }
+    void AddCell(int node, int layer, int row, int col);
+    void Finalise();
+
+    int _width = 1;
+    int _height = 1;
+    int _depth = 1;
+    std::unordered_map<uint64_t, int> _cellNodes;
+    std::unordered_map<int, std::vector<Cell>> _nodeCells;
+    std::vector<int> _nodes;
+};
+
 class CustomModel : public ModelWithScreenLocation<BoxedScreenLocation>
 {
     public:
@@ -75,8 +124,9 @@ class CustomModel : public ModelWithScreenLocation<BoxedScreenLocation>
         virtual void SetStringStartChannels(bool zeroBased, int NumberOfStrings, int StartChannel, int ChannelsPerString) override;
 
     private:
-        int GetCustomMaxChannel(const std::string& customModel) const;
-        void InitCustomMatrix(const std::string& customModel);
+        void LoadLayout();
+        void StoreCustomData(const std::string& data);
+        void InitCustomMatrix();
         static std::string StartNodeAttrName(int idx)
         {
             return wxString::Format(wxT("String%i"), idx + 1).ToStdString();  // a space between "String" and "%i" breaks the start channels listed in Indiv Start Chans
@@ -85,6 +135,8 @@ class CustomModel : public ModelWithScreenLocation<BoxedScreenLocation>
         int GetCustomNodeStringNumber(int node) const;
 
         int _depth = 1;
+        CustomModelLayout _layout;
+        std::string _layoutSource;
         std::string custom_background;
         int _strings;
         std::vector<int> stringStartNodes;
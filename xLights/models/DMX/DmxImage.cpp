@@ -19,6 +19,7 @@
 #include "DmxImage.h"
 #include "../../UtilFunctions.h"
 #include "../../ExternalHooks.h"
+#include "../../ImageAssetCache.h"
 #include "../../ModelPreview.h"
 #include "../../xLightsMain.h"
 
@@ -333,7 +334,8 @@ void DmxImage::Draw(BaseObject* base, ModelPreview* preview, xlGraphicsProgram *
                 (const char*)base->GetName().c_str(),
                 (const char*)_imageFile.c_str(),
                 (const char*)preview->GetName().c_str());
-            wxImage img(_imageFile);
+            auto decoded = ImageAssetCache::Instance().GetImage(_imageFile);
+            wxImage img = decoded == nullptr ? wxImage() : decoded->WrapImage();
             if (img.IsOk()) {
                 xlTexture *t = preview->getCurrentGraphicsContext()->createTexture(img);
                 _images[preview->GetName().ToStdString()] = t;
@@ -19,6 +19,7 @@
 #include "../xLightsMain.h"
 #include "UtilFunctions.h"
 #include "../ExternalHooks.h"
+#include "../ImageAssetCache.h"
 
 #include <log4cpp/Category.hh>
 
@@ -243,7 +244,8 @@ void ImageModel::DisplayEffectOnWindow(ModelPreview* preview, double pointSize)
 
         xlTexture *texture = _images[preview->GetName().ToStdString()];
         if (texture == nullptr && FileExists(_imageFile)) {
-            wxImage img(_imageFile);
+            auto decoded = ImageAssetCache::Instance().GetImage(_imageFile);
+            wxImage img = decoded == nullptr ? wxImage() : decoded->CopyImage();
             if (img.IsOk()) {
                 bool mAlpha = img.HasAlpha();
                 if (!mAlpha && _whiteAsAlpha) {
@@ -351,7 +353,8 @@ void ImageModel::DisplayModelOnWindow(ModelPreview* preview, xlGraphicsContext *
     
     xlTexture *texture = _images[preview->GetName().ToStdString()];
     if (texture == nullptr && FileExists(_imageFile)) {
-        wxImage img(_imageFile);
+        auto decoded = ImageAssetCache::Instance().GetImage(_imageFile);
+        wxImage img = decoded == nullptr ? wxImage() : decoded->CopyImage();
         if (img.IsOk()) {
             bool mAlpha = img.HasAlpha();
             if (!mAlpha && _whiteAsAlpha) {
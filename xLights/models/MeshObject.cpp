@@ -217,15 +217,10 @@ std::list<std::string> MeshObject::CheckModelSettings()
             res.push_back(wxString::Format("    WARN: Mesh object '%s' does not have a material file '%s'.", GetName(), fn.GetFullPath()).ToStdString());
         }
 
-        std::string base_path = fn.GetPath();
-        tinyobj::attrib_t attr;
-        std::vector<int> lin;
-        std::vector<tinyobj::shape_t> shap;
-        std::vector<tinyobj::material_t> mater;
-        std::string err, warn;
-        tinyobj::LoadObj(&attr, &shap, &mater, &warn, &err, (char *)_objFile.c_str(), (char *)base_path.c_str());
-
-        for (auto m : mater) {
+        auto meshData = xlMeshCache::Instance().GetMesh(_objFile);
+        std::vector<tinyobj::material_t> noMaterials;
+
+        for (const auto& m : meshData != nullptr ? meshData->GetMaterials() : noMaterials) {
             if (m.diffuse_texname.length() > 0) {
                 wxFileName tex(m.diffuse_texname);
                 tex.SetPath(fn.GetPath());
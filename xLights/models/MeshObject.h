@@ -38,6 +38,10 @@ class MeshObject : public ObjectWithScreenLocation<BoxedScreenLocation>
         virtual bool CleanupFileLocations(xLightsFrame* frame) override;
         virtual std::list<std::string> CheckModelSettings() override;
 
+        const std::string& GetObjFile() const { return _objFile; }
+        float GetBrightness() const { return brightness; }
+        bool IsMeshOnly() const { return mesh_only; }
+
     protected:
         void checkAccessToFile(const std::string &url);
         void loadObject(xlGraphicsContext *ctx);
@@ -2829,6 +2829,7 @@ void Model::SetFromXml(wxXmlNode* ModelNode, bool zb)
     GetModelScreenLocation().Read(ModelNode);
 
     InitModel();
+    modelManager.InvalidateChannelIndex(); // node channels may have moved
 
     size_t NodeCount = GetNodeCount();
     for (size_t i = 0; i < NodeCount; i++) {
@@ -2893,9 +2894,86 @@ void Model::SetFromXml(wxXmlNode* ModelNode, bool zb)
         ModelNode->RemoveChild(dimmingCurveNode);
     }
 
+    _builtStartChannel = CouldComputeStartChannel ? StartChannel : -1;
+    _builtXmlHash = HashXmlExcludingStartChannel();
+
     IncrementChangeCount();
 }
 
+static void HashXmlNode(const wxXmlNode* node, size_t& hash, bool skipStartChannel)
+{
+    std::hash<std::string> hasher;
+    auto combine = [&hash](size_t v) { hash ^= v + 0x9e3779b9 + (hash << 6) + (hash >> 2); };
+    combine(hasher(node->GetName().ToStdString()));
+    for (wxXmlAttribute* a = node->GetAttributes(); a != nullptr; a = a->GetNext()) {
+        if (skipStartChannel && a->GetName() == "StartChannel") {
+            continue;
+        }
+        combine(hasher(a->GetName().ToStdString()));
+        combine(hasher(a->GetValue().ToStdString()));
+    }
+    for (wxXmlNode* c = node->GetChildren(); c != nullptr; c = c->GetNext()) {
+        HashXmlNode(c, hash, false);
+    }
+}
+
+size_t Model::HashXmlExcludingStartChannel() const
+{
+    size_t hash = 0;
+    if (ModelXml != nullptr) {
+        HashXmlNode(ModelXml, hash, true);
+    }
+    return hash;
+}
+
+void Model::OffsetChannels(int32_t delta)
+{
+    for (auto& it : stringStartChan) {
+        it += delta;
+    }
+    for (auto& it : Nodes) {
+        if (it->ActChan != (unsigned int)-1) {
+            it->ActChan += delta;
+        }
+    }
+    for (auto& it : subModels) {
+        it->OffsetChannels(delta);
+        it->ModelStartChannel = wxString::Format("%u", it->GetFirstChannel() + 1);
+    }
+}
+
+// Re-resolves the start channel string and, if nothing but the start channel has changed since the
+// nodes were built, moves the existing nodes instead of rebuilding the model with SetFromXml.
+// Returns false if the model needs a full SetFromXml.
+bool Model::UpdateStartChannelInPlace()
+{
+    if (ModelXml == nullptr || zeroBased || _builtStartChannel < 0) {
+        return false;
+    }
+    // individual string start channels are resolved separately and can point at other models
+    if (ModelXml->GetAttribute("Advanced", "0") == "1") {
+        return false;
+    }
+    if (HashXmlExcludingStartChannel() != _builtXmlHash) {
+        return false;
+    }
+    bool valid = false;
+    std::string dependsonmodel;
+    int32_t startChannel = GetNumberFromChannelString(ModelXml->GetAttribute("StartChannel", "1").ToStdString(), valid, dependsonmodel);
+    if (!valid) {
+        return false;
+    }
+    ModelStartChannel = ModelXml->GetAttribute("StartChannel");
+    CouldComputeStartChannel = true;
+    if (startChannel != _builtStartChannel) {
+        OffsetChannels(startChannel - _builtStartChannel);
+        _builtStartChannel = startChannel;
+        IncrementChangeCount();
+        modelManager.InvalidateChannelIndex(); // node channels have moved
+    }
+    return true;
+}
+
 std::string Model::GetControllerConnectionString() const
 {
     if (GetControllerProtocol() == "") return "";
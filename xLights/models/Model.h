@@ -140,8 +140,11 @@ public:
 
     int GetPixelSize() const { return pixelSize; }
     void SetPixelSize(int size);
+    int GetTransparency() const { return transparency; }
     void SetTransparency(int t);
+    int GetBlackTransparency() const { return blackTransparency; }
     void SetBlackTransparency(int t);
+    int GetStrobeRate() const { return StrobeRate; }
     void ApplyDimensions(const std::string& units, float width, float height, float depth, float& min_x, float& max_x, float& min_y, float& max_y);
     void ExportDimensions(wxFile& f) const;
 
@@ -281,6 +284,12 @@ protected:
     long parm3 = 0;         /* Number of strands per string in the model or number of lights per arch or cane segment (except for frames & custom) */
     bool IsLtoR = true;     // true = left to right, false = right to left
     std::vector<int32_t> stringStartChan;
+    // start channel the nodes were last built with (-1 if it could not be computed) and a hash of
+    // the rest of the model xml, so a moved start channel can be applied without rebuilding the nodes
+    int32_t _builtStartChannel = -1;
+    size_t _builtXmlHash = 0;
+    size_t HashXmlExcludingStartChannel() const;
+    void OffsetChannels(int32_t delta);
     bool isBotToTop = true;
     std::string StringType; // RGB Nodes, 3 Channel RGB, Single Color Red, Single Color Green, Single Color Blue, Single Color White
     int rgbwHandlingType = 0;
@@ -396,6 +405,7 @@ public:
     bool UpdateStartChannelFromChannelString(std::map<std::string, Model*>& models, std::list<std::string>& used);
     int GetNumberFromChannelString(const std::string& sc) const;
     int GetNumberFromChannelString(const std::string& sc, bool& valid, std::string& dependsonmodel) const;
+    bool UpdateStartChannelInPlace();
 
     virtual void DisplayModelOnWindow(ModelPreview* preview, xlGraphicsContext *ctx,
                                       xlGraphicsProgram *solidProgram, xlGraphicsProgram *transparentProgram, bool is_3d = false,
@@ -439,6 +449,7 @@ public:
     const std::string& NodeType(size_t nodenum) const;
     virtual int MapToNodeIndex(int strand, int node) const;
 
+    const NodeBaseClass* GetNode(size_t nodenum) const { return nodenum < Nodes.size() ? Nodes[nodenum].get() : nullptr; }
     void GetNodeChannelValues(size_t nodenum, unsigned char* buf);
     void SetNodeChannelValues(size_t nodenum, const unsigned char* buf);
     xlColor GetNodeColor(size_t nodenum) const;
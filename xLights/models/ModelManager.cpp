@@ -11,6 +11,8 @@
 #include <wx/xml/xml.h>
 #include <wx/msgdlg.h>
 
+#include <algorithm>
+
 #include "ModelManager.h"
 #include "Model.h"
 #include "SubModel.h"
@@ -83,6 +85,7 @@ void ModelManager::clear()
         }
     }
     models.clear();
+    InvalidateChannelIndex();
 }
 
 inline BaseObject *ModelManager::GetObject(const std::string &name) const {
@@ -147,6 +150,7 @@ bool ModelManager::Rename(const std::string &oldName, const std::string &newName
         }
         models.erase(models.find(on));
         models[nn] = model;
+        InvalidateChannelIndex();
 
         // go through all the model groups looking for things that might need to be renamed
         for (const auto& it : models) {
@@ -193,31 +197,47 @@ bool ModelManager::RenameInListOnly(const std::string& oldName, const std::strin
     std::lock_guard<std::recursive_mutex> lock(_modelMutex);
     models.erase(models.find(on));
     models[nn] = model;
+    InvalidateChannelIndex();
     return true;
 }
 
+std::shared_ptr<const ModelManager::ModelChannelIndex> ModelManager::GetChannelIndex() const
+{
+    uint32_t generation = _channelIndexGeneration;
+    auto index = std::atomic_load(&_channelIndex);
+    if (index != nullptr && index->generation == generation) return index;
+
+    auto newIndex = std::make_shared<ModelChannelIndex>();
+    newIndex->generation = generation;
+    {
+        std::lock_guard<std::recursive_mutex> lock(_modelMutex);
+        for (const auto& it : models) {
+            if (it.second != nullptr && it.second->GetDisplayAs() != "ModelGroup" && it.second->GetNodeCount() > 0) {
+                int64_t start = it.second->GetFirstChannel();
+                newIndex->Add(start, start + it.second->GetChanCount() - 1, { it.second, it.first });
+            }
+        }
+    }
+    newIndex->Build();
+    index = newIndex;
+    std::atomic_store(&_channelIndex, index);
+    return index;
+}
+
 bool ModelManager::IsModelOverlapping(const Model* model) const
 {
     int32_t start = model->GetFirstChannel(); //model->GetNumberFromChannelString(model->ModelStartChannel);
     int32_t end = start + model->GetChanCount() - 1;
-    //int32_t sstart = model->GetFirstChannel() + 1;
-    //wxASSERT(sstart == start);
-    //int32_t send = model->GetLastChannel() + 1;
-    //wxASSERT(send == end);
-    for (const auto& it : *this)
-    {
-        if (it.second->GetDisplayAs() != "ModelGroup" && it.second->GetName() != model->GetName())
-        {
-            int32_t s = it.second->GetFirstChannel(); //GetNumberFromChannelString(it->second->ModelStartChannel);
-            int32_t e = s + it.second->GetChanCount() - 1;
-            //int32_t ss = it->second->GetFirstChannel() + 1;
-            //wxASSERT(ss == s);
-            //int32_t se = it->second->GetLastChannel() + 1;
-            //wxASSERT(se == e);
-            if (start <= e && end >= s) return true;
+
+    bool overlapping = false;
+    GetChannelIndex()->ForEachOverlapping(start, end, [&overlapping, model](const ChannelIntervalIndex<ModelChannel>::Interval& it) {
+        if (it.value.model->GetName() != model->GetName()) {
+            overlapping = true;
+            return false;
         }
-    }
-    return false;
+        return true;
+    });
+    return overlapping;
 }
 
 void ModelManager::LoadModels(wxXmlNode* modelNode, int previewW, int previewH)
@@ -466,94 +486,72 @@ bool ModelManager::RecalcStartChannels() const {
 
     wxStopWatch sw;
     bool changed = false;
-    std::set<std::string> modelsDone;
-    std::set<std::string> modelsOnNoController;
 
+    // Build the start channel dependency graph ... a model whose start channel is
+    // chained (>Model:1) or relative (@Model:1) depends on the referenced model
+    std::map<std::string, std::list<Model*>> dependents;
+    std::map<Model*, int> waitingOn;
+    std::list<Model*> ready;
     for (const auto& it : models) {
+        if (it.second->GetDisplayAs() == "ModelGroup") continue;
         it.second->CouldComputeStartChannel = false;
-    }
 
-    // first go through all models whose start channels are not dependent on other models
-    for (const auto& it : models) {
-        if (it.second->GetDisplayAs() != "ModelGroup")
-        {
-            char first = '0';
-            if (Trim(it.second->ModelStartChannel) != "") first = Trim(it.second->ModelStartChannel)[0];
-            if (first != '>' && first != '@')
-            {
-                modelsDone.emplace(it.first);
-                auto oldsc = it.second->GetFirstChannel();
-                it.second->SetFromXml(it.second->GetModelXml());
-                if (oldsc != it.second->GetFirstChannel())
-                {
-                    changed = true;
-                }
-            }
-            if (it.second->GetControllerName() == NO_CONTROLLER) {
-                modelsOnNoController.emplace(it.first);
-            }
+        std::string sc = Trim(it.second->GetModelXml()->GetAttribute("StartChannel", "1").ToStdString());
+        std::string dependsOn;
+        if (sc != "" && (sc[0] == '>' || sc[0] == '@')) {
+            dependsOn = Trim(sc.substr(1, sc.find(':') - 1));
+        }
+        auto dep = models.find(dependsOn);
+        if (dependsOn == "" || dependsOn == it.first || dep == models.end() || dep->second->GetDisplayAs() == "ModelGroup") {
+            ready.push_back(it.second);
+        } else {
+            dependents[dependsOn].push_back(it.second);
+            waitingOn[it.second] = 1;
         }
     }
 
-    // now go through all undone models that depend on something
-    bool workDone = false;
-    do
-    {
-        workDone = false;
-
-        for (const auto& it : models) {
-            if (it.second->GetDisplayAs() != "ModelGroup")
-            {
-                char first = '0';
-                if (Trim(it.second->ModelStartChannel) != "") first = Trim(it.second->ModelStartChannel)[0];
-                if ((first == '>' || first == '@') && !it.second->CouldComputeStartChannel)
-                {
-                    std::string dependsOn = Trim(Trim(it.second->ModelStartChannel).substr(1, Trim(it.second->ModelStartChannel).find(':') - 1));
-
-                    if (first == '>'  && modelsOnNoController.find(dependsOn) != modelsOnNoController.end()) {
-                        modelsOnNoController.emplace(it.first);
-                    }
-
-                    if (modelsDone.find(dependsOn) != modelsDone.end() && modelsOnNoController.find(dependsOn) == modelsOnNoController.end())
-                    {
-                        // the depends on model is done
-                        modelsDone.emplace(it.first);
-                        auto oldsc = it.second->GetFirstChannel();
-                        it.second->SetFromXml(it.second->GetModelXml());
-                        if (oldsc != it.second->GetFirstChannel())
-                        {
-                            changed = true;
-                        }
-                        if (it.second->CouldComputeStartChannel)
-                        {
-                            workDone = true;
-                        }
-                    }
+    // Resolve in topological order so every model is visited once, after the model it
+    // depends on. Models whose xml is unchanged apart from the start channel are moved
+    // in place, anything else is rebuilt.
+    int rebuilt = 0;
+    auto resolve = [&changed, &rebuilt](Model* m) {
+        auto oldsc = m->GetFirstChannel();
+        if (!m->UpdateStartChannelInPlace()) {
+            m->SetFromXml(m->GetModelXml());
+            rebuilt++;
+        }
+        if (oldsc != m->GetFirstChannel()) {
+            changed = true;
+        }
+    };
+    while (!ready.empty()) {
+        Model* m = ready.front();
+        ready.pop_front();
+        resolve(m);
+        auto d = dependents.find(m->GetName());
+        if (d != dependents.end()) {
+            for (const auto& it : d->second) {
+                if (--waitingOn[it] == 0) {
+                    ready.push_back(it);
                 }
             }
         }
+    }
 
-    } while (workDone);
-
-    // now process anything unprocessed
+    // anything left is part of a dependency loop, these cant be computed
     int countInvalid = 0;
     for (const auto& it : models) {
         if (it.second->GetDisplayAs() != "ModelGroup") {
-            char first = '0';
-            if (Trim(it.second->ModelStartChannel) != "") first = Trim(it.second->ModelStartChannel)[0];
-            if ((first == '>' || first == '@') && !it.second->CouldComputeStartChannel) {
-                modelsDone.emplace(it.first);
-                auto oldsc = it.second->GetFirstChannel();
-                it.second->SetFromXml(it.second->GetModelXml());
-                if (oldsc != it.second->GetFirstChannel()) {
-                    changed = true;
-                }
+            auto w = waitingOn.find(it.second);
+            if (w != waitingOn.end() && w->second > 0) {
+                resolve(it.second);
             }
             if (!it.second->CouldComputeStartChannel) {
                 countInvalid++;
             }
         }
     }
+    logger_base.debug("RecalcStartChannels rebuilt %d of %d models.", rebuilt, (int)models.size());
 
     ResetModelGroups();
 
@@ -1506,6 +1504,7 @@ void ModelManager::AddModel(Model *model) {
             ResetModelGroups();
         }
         models[model->name] = model;
+        InvalidateChannelIndex();
 
         if ("ModelGroup" == model->GetDisplayAs()) {
             if (model->GetModelXml()->GetParent() != groupNode) {
@@ -1536,18 +1535,22 @@ std::string ModelManager::GetModelsOnChannels(uint32_t start, uint32_t end, int
     std::string res;
     std::string line;
 
-    for (const auto& it : *this) {
-        if (it.second->GetDisplayAs() != "ModelGroup") {
-            if (perLine > 0 && CountChar(line, ',') >= perLine - 1) {
-                if (res != "") res += "\n";
-                res += line;
-                line = "";
-            }
-            if (it.second->GetFirstChannel()+1 <= end && it.second->GetLastChannel() + 1 >= start) {
-                if (line != "") line += ", ";
-                line += it.first;
-            }
+    // index is in channel order but we list the models in name order
+    std::vector<std::string> names;
+    GetChannelIndex()->ForEachOverlapping((int64_t)start - 1, (int64_t)end - 1, [&names](const ChannelIntervalIndex<ModelChannel>::Interval& it) {
+        names.push_back(it.value.name);
+        return true;
+    });
+    std::sort(names.begin(), names.end());
+
+    for (const auto& it : names) {
+        if (perLine > 0 && line != "" && CountChar(line, ',') >= perLine - 1) {
+            if (res != "") res += "\n";
+            res += line;
+            line = "";
         }
+        if (line != "") line += ", ";
+        line += it;
     }
 
     if (line != "") {
@@ -1644,6 +1647,7 @@ void ModelManager::Delete(const std::string& name) {
                     }
                 }
                 models.erase(it);
+                InvalidateChannelIndex();
                 ResetModelGroups();
 
                 // If models are chained to us then make their start channel ... our start channel
@@ -11,12 +11,14 @@
  **************************************************************/
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include <mutex>
 #include <atomic>
 
 #include "ObjectManager.h"
+#include "../outputs/ChannelIntervalIndex.h"
 
 class Model;
 class wxXmlNode;
@@ -82,6 +84,8 @@ class ModelManager : public ObjectManager
         bool IsValidControllerModelChain(Model* m, std::string& tip) const;
         Model *createAndAddModel(wxXmlNode *node, int previewW, int previewH);
         std::string GetModelsOnChannels(uint32_t start, uint32_t end, int perLine) const;
+        // call whenever models are added/removed or a model's channels may have changed
+        void InvalidateChannelIndex() const { ++_channelIndexGeneration; }
         std::vector<std::string> GetGroupsContainingModel(Model* model) const;
         std::string GenerateNewStartChannel( const std::string& lastModel = "" ) const;
 
@@ -90,6 +94,17 @@ class ModelManager : public ObjectManager
 
     private:
 
+    struct ModelChannel
+    {
+        Model* model;
+        std::string name;
+    };
+    struct ModelChannelIndex : public ChannelIntervalIndex<ModelChannel>
+    {
+        uint32_t generation = 0;
+    };
+    std::shared_ptr<const ModelChannelIndex> GetChannelIndex() const;
+
     wxXmlNode *layoutsNode = nullptr;
     OutputManager* _outputManager = nullptr;
     xLightsFrame* xlights = nullptr;
@@ -98,5 +113,7 @@ class ModelManager : public ObjectManager
     std::map<std::string, Model *> models;
     mutable std::recursive_mutex _modelMutex;
     std::atomic<bool> _modelsLoading;
+    mutable std::shared_ptr<const ModelChannelIndex> _channelIndex;
+    mutable std::atomic_uint32_t _channelIndexGeneration{ 1 };
 };
 
@@ -185,6 +185,11 @@ public:
         color.Set(c[0], c[1], c[2]);
     }
 
+    // Direct access for code that has already checked this is a plain NodeBaseClass and
+    // so knows GetColor/GetForChannels aren't overridden
+    const uint8_t* GetRawColor() const { return c; }
+    const uint8_t* GetChannelOffsets() const { return offsets; }
+
     void GetMaskColor(xlColor& color) const
     {
         color = _maskColor;
@@ -0,0 +1,103 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Static interval index over inclusive channel ranges.
+// Intervals are sorted by start and a max-end segment tree is built over them so overlap
+// and point queries only visit subtrees that can contain a match ... O(log n + k) rather
+// than a scan of every model/controller. Add everything then Build() before querying.
+// The index is immutable once built so it can be shared between threads.
+template <typename T>
+class ChannelIntervalIndex
+{
+public:
+    struct Interval
+    {
+        int64_t start;
+        int64_t end;
+        T value;
+    };
+
+    void Add(int64_t start, int64_t end, const T& value)
+    {
+        _intervals.push_back({ start, end, value });
+    }
+
+    void Build()
+    {
+        std::stable_sort(_intervals.begin(), _intervals.end(), [](const Interval& a, const Interval& b) {
+            return a.start < b.start;
+        });
+
+        _size = 1;
+        while (_size < _intervals.size()) _size <<= 1;
+        _maxEnd.assign(_size * 2, std::numeric_limits<int64_t>::min());
+        for (size_t i = 0; i < _intervals.size(); i++) {
+            _maxEnd[_size + i] = _intervals[i].end;
+        }
+        for (size_t i = _size - 1; i > 0; i--) {
+            _maxEnd[i] = std::max(_maxEnd[i * 2], _maxEnd[i * 2 + 1]);
+        }
+    }
+
+    size_t size() const { return _intervals.size(); }
+    bool empty() const { return _intervals.empty(); }
+
+    // Calls f(interval) in start order for every interval overlapping [start, end].
+    // Stop early by returning false from f.
+    template <typename F>
+    void ForEachOverlapping(int64_t start, int64_t end, F&& f) const
+    {
+        if (_intervals.empty()) return;
+
+        // nothing starting after the end of the range can overlap it
+        size_t limit = std::upper_bound(_intervals.begin(), _intervals.end(), end, [](int64_t v, const Interval& i) {
+            return v < i.start;
+        }) - _intervals.begin();
+        if (limit == 0) return;
+
+        Visit(1, 0, _size, limit, start, end, f);
+    }
+
+    // First interval (in start order) containing the channel or nullptr
+    const Interval* FindContaining(int64_t channel) const
+    {
+        const Interval* res = nullptr;
+        ForEachOverlapping(channel, channel, [&res](const Interval& i) { res = &i; return false; });
+        return res;
+    }
+
+private:
+    template <typename F>
+    bool Visit(size_t node, size_t lo, size_t hi, size_t limit, int64_t start, int64_t end, F& f) const
+    {
+        if (lo >= limit || _maxEnd[node] < start) return true;
+        if (hi - lo == 1) {
+            const Interval& i = _intervals[lo];
+            if (i.start <= end && i.end >= start) {
+                return f(i);
+            }
+            return true;
+        }
+        size_t mid = (lo + hi) / 2;
+        if (!Visit(node * 2, lo, mid, limit, start, end, f)) return false;
+        return Visit(node * 2 + 1, mid, hi, limit, start, end, f);
+    }
+
+    std::vector<Interval> _intervals;
+    std::vector<int64_t> _maxEnd;
+    size_t _size = 0;
+};
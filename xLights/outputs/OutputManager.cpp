@@ -472,6 +472,7 @@ void OutputManager::AddController(Controller* controller, int pos)
         std::advance(it, pos);
         _controllers.insert(it, controller);
     }
+    InvalidateControllerChannelIndex();
     UpdateUnmanaged();
 }
 
@@ -484,11 +485,14 @@ void OutputManager::DeleteController(const std::string& controllerName) {
             break;
         }
     }
+    InvalidateControllerChannelIndex();
     UpdateUnmanaged();
 }
 
 void OutputManager::DeleteAllControllers() {
 
+    InvalidateControllerChannelIndex();
+
     while (_controllers.size() > 0) {
         delete _controllers.front();
         _controllers.pop_front();
@@ -545,8 +549,38 @@ Controller* OutputManager::GetControllerIndex(int index) const {
     return *it;
 }
 
+std::shared_ptr<const OutputManager::ControllerChannelIndex> OutputManager::GetControllerChannelIndex() const {
+
+    uint32_t generation = _controllerChannelIndexGeneration;
+    auto index = std::atomic_load(&_controllerChannelIndex);
+    if (index != nullptr && index->generation == generation) return index;
+
+    auto newIndex = std::make_shared<ControllerChannelIndex>();
+    newIndex->generation = generation;
+    for (const auto& it : _controllers) {
+        if (it->GetOutputCount() > 0) {
+            newIndex->Add(it->GetStartChannel(), it->GetEndChannel(), it);
+        }
+    }
+    newIndex->Build();
+    index = newIndex;
+    std::atomic_store(&_controllerChannelIndex, index);
+    return index;
+}
+
 Controller* OutputManager::GetController(int32_t absoluteChannel, int32_t& startChannel) const {
 
+    auto index = GetControllerChannelIndex();
+    auto found = index->FindContaining(absoluteChannel);
+    if (found != nullptr) {
+        Controller* c = found->value;
+        if (absoluteChannel >= c->GetStartChannel() && absoluteChannel <= c->GetEndChannel()) {
+            startChannel = absoluteChannel - c->GetStartChannel() + 1;
+            return c;
+        }
+    }
+
+    // controller channels changed without SomethingChanged being called ... do it the slow way
     for (const auto& it : _controllers) {
         if (absoluteChannel >= it->GetStartChannel() && absoluteChannel <= it->GetEndChannel()) {
             startChannel = absoluteChannel - it->GetStartChannel() + 1;
@@ -669,6 +703,17 @@ Output* OutputManager::GetOutput_CONVERT(int outputNumber) const {
 // get an output based on an absolute channel number
 Output* OutputManager::GetOutput(int32_t absoluteChannel, int32_t& startChannel) const {
 
+    int32_t sc;
+    auto c = GetController(absoluteChannel, sc);
+    if (c != nullptr) {
+        for (const auto& it : c->GetOutputs()) {
+            if (absoluteChannel >= it->GetStartChannel() && absoluteChannel <= it->GetEndChannel()) {
+                startChannel = absoluteChannel - it->GetStartChannel() + 1;
+                return it;
+            }
+        }
+    }
+
     auto outputs = GetAllOutputs();
     for (const auto& it : outputs) {
         if (absoluteChannel >= it->GetStartChannel() && absoluteChannel <= it->GetEndChannel()) {
@@ -968,6 +1013,7 @@ int OutputManager::UniqueId() {
 
 // Need to call this whenever something may have changed in an output to ensure all the transient data it updated
 void OutputManager::SomethingChanged() const {
+    InvalidateControllerChannelIndex();
     int nullcnt = 0;
     int start = 1;
     for (auto& it : _controllers) {
@@ -12,11 +12,15 @@
 
 #include <wx/thread.h>
 
+#include <atomic>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "ChannelIntervalIndex.h"
+
 class wxWindow;
 class wxXmlNode;
 
@@ -45,6 +49,14 @@ class OutputManager
     std::string _globalFPPProxy;
     std::string _globalForceLocalIP;
     wxCriticalSection _outputCriticalSection; // used to protect areas that must be single threaded
+
+    // controller channel ranges for absolute channel lookups ... rebuilt when the generation changes
+    struct ControllerChannelIndex : public ChannelIntervalIndex<Controller*>
+    {
+        uint32_t generation = 0;
+    };
+    mutable std::shared_ptr<const ControllerChannelIndex> _controllerChannelIndex;
+    mutable std::atomic_uint32_t _controllerChannelIndexGeneration{ 1 };
     #pragma endregion 
 
     #pragma region Static Variables
@@ -61,6 +73,8 @@ class OutputManager
     bool SetGlobalOutputtingFlag(bool state, bool force = false);
     bool ConvertStartChannel(const std::string sc, std::string& newsc) const;
     void AsyncPingAll();
+    std::shared_ptr<const ControllerChannelIndex> GetControllerChannelIndex() const;
+    void InvalidateControllerChannelIndex() const { ++_controllerChannelIndexGeneration; }
     #pragma endregion 
 
 public:
@@ -18,6 +18,7 @@
 #include "../ValueCurve.h"
 #include "../UtilClasses.h"
 #include "../RenderCache.h"
+#include "../RenderBuffer.h"
 #include "../models/Model.h"
 #include "../xLightsMain.h"
 #include "../xLightsApp.h"
@@ -172,8 +173,21 @@ void Effect::ParseColorMap(const SettingsMap &mPaletteMap, xlColorVector &mColor
 
 #pragma region Constructors and Destructors
 
+static SharedSettingsMap ParseSettingsString(const std::string& settings)
+{
+    SettingsMap map;
+    map.Parse(settings);
+    return SharedSettingsMap(std::move(map));
+}
+
 Effect::Effect(EffectLayer* parent,int id, const std::string & name, const std::string &settings, const std::string &palette,
                int startTimeMS, int endTimeMS, int Selected, bool Protected)
+    : Effect(parent, id, name, ParseSettingsString(settings), ParseSettingsString(palette), startTimeMS, endTimeMS, Selected, Protected)
+{
+}
+
+Effect::Effect(EffectLayer* parent, int id, const std::string& name, const SharedSettingsMap& settings, const SharedSettingsMap& palette,
+               int startTimeMS, int endTimeMS, int Selected, bool Protected)
     : mParentLayer(parent), mID(id), mEffectIndex(-1), mName(nullptr),
       mStartTime(startTimeMS), mEndTime(endTimeMS), mSelected(Selected), mTagged(false), mProtected(Protected), mCache(nullptr)
 {
@@ -181,7 +195,7 @@ Effect::Effect(EffectLayer* parent,int id, const std::string & name, const std::
 
     mColorMask = xlColor::NilColor();
     mEffectIndex = (parent->GetParentElement() == nullptr) ? -1 : parent->GetParentElement()->GetSequenceElements()->GetEffectManager().GetEffectIndex(name);
-    mSettings.Parse(settings);
+    mSettings = settings;
 
     Element* parentElement = parent->GetParentElement();
     if (parentElement != nullptr)
@@ -194,17 +208,17 @@ Effect::Effect(EffectLayer* parent,int id, const std::string & name, const std::
     //  settings["key"] == "test val"
     // code which as a side effect creates a blank value under the key
     // an example of this is fix to issue #622
-    if (mSettings.Get("T_CHOICE_Out_Transition_Type", "XXX") == "")
+    if (mSettings->Get("T_CHOICE_Out_Transition_Type", "XXX") == "")
     {
-        mSettings.erase("T_CHOICE_Out_Transition_Type");
+        mSettings.Edit().erase("T_CHOICE_Out_Transition_Type");
     }
-    if (mSettings.Get("Converted", "XXX") == "")
+    if (mSettings->Get("Converted", "XXX") == "")
     {
-        mSettings.erase("Converted");
+        mSettings.Edit().erase("Converted");
     }
 
     // check for any other odd looking blank settings
-    //for (const auto& it : mSettings)
+    //for (const auto& it : *mSettings)
     //{
     //    if (it.second == "")
     //    {
@@ -229,8 +243,8 @@ Effect::Effect(EffectLayer* parent,int id, const std::string & name, const std::
         mName = new std::string(name);
     }
 
-    mPaletteMap.Parse(palette);
-    ParseColorMap(mPaletteMap, mColors, mCC);
+    mPaletteMap = palette;
+    ParseColorMap(*mPaletteMap, mColors, mCC);
 }
 
 Effect::~Effect()
@@ -239,6 +253,7 @@ Effect::~Effect()
         mCache->Delete();
         mCache = nullptr;
     }
+    ClearCheckpoints();
     if (mName != nullptr)
     {
         delete mName;
@@ -328,8 +343,8 @@ void Effect::SetEffectName(const std::string & name)
 std::string Effect::GetSetting(const std::string& id) const
 {
     std::unique_lock<std::recursive_mutex> lock(settingsLock);
-    if (mSettings.Contains(id)) {
-        return mSettings[id];
+    if (mSettings->Contains(id)) {
+        return (*mSettings)[id];
     }
     return "";
 }
@@ -347,6 +362,8 @@ void Effect::SetStartTimeMS(int startTimeMS)
     {
         IncrementChangeCount();
         mStartTime = startTimeMS;
+        // the change count was raised before the move so make sure the layer picks up the new time
+        mParentLayer->InvalidateSnapshot();
     }
     else
     {
@@ -363,6 +380,8 @@ void Effect::SetEndTimeMS(int endTimeMS)
     {
         IncrementChangeCount();
         mEndTime = endTimeMS;
+        // the change count was raised before the move so make sure the layer picks up the new time
+        mParentLayer->InvalidateSnapshot();
     }
     else
     {
@@ -383,14 +402,14 @@ void Effect::ConvertTo(int effectIndex)
         SetEffectIndex(effectIndex);
         SettingsMap newSettings;
         // remove any E_ settings as the effect type has changed
-        for (const auto& it : mSettings)
+        for (const auto& it : *mSettings)
         {
             if (!StartsWith(it.first, "E_"))
             {
                 newSettings[it.first] = it.second;
             }
         }
-        mSettings = newSettings;
+        mSettings = SharedSettingsMap(std::move(newSettings));
 
         std::string palette;
         std::string effectText = xLightsApp::GetFrame()->GetEffectTextFromWindows(palette);
@@ -403,7 +422,7 @@ void Effect::ConvertTo(int effectIndex)
                 auto sv = wxSplit(it, '=');
                 if (sv.size()==2)
                 {
-                    mSettings[sv[0]] = sv[1];
+                    mSettings.Edit()[sv[0]] = sv[1];
                 }
             }
         }
@@ -422,7 +441,7 @@ bool Effect::IsModelRenderDisabled() const
 bool Effect::IsEffectRenderDisabled() const
 {
     std::unique_lock<std::recursive_mutex> lock(settingsLock);
-    return mSettings.Contains("X_Effect_RenderDisabled");
+    return mSettings->Contains("X_Effect_RenderDisabled");
 }
 
 bool Effect::IsRenderDisabled() const
@@ -436,17 +455,17 @@ void Effect::SetEffectRenderDisabled(bool disabled)
 {
     std::unique_lock<std::recursive_mutex> getlock(settingsLock);
     if (disabled) {
-        mSettings["X_Effect_RenderDisabled"] = "True";
+        mSettings.Edit()["X_Effect_RenderDisabled"] = "True";
     }
-    else {
-        mSettings.erase("X_Effect_RenderDisabled");
+    else if (mSettings->Contains("X_Effect_RenderDisabled")) {
+        mSettings.Edit().erase("X_Effect_RenderDisabled");
     }
 }
 
 bool Effect::IsLocked() const
 {
     std::unique_lock<std::recursive_mutex> lock(settingsLock);
-    return mSettings.Contains("X_Effect_Locked");
+    return mSettings->Contains("X_Effect_Locked");
 }
 
 void Effect::SetLocked(bool lock)
@@ -454,11 +473,11 @@ void Effect::SetLocked(bool lock)
     std::unique_lock<std::recursive_mutex> getlock(settingsLock);
     if (lock)
     {
-        mSettings["X_Effect_Locked"] = "True";
+        mSettings.Edit()["X_Effect_Locked"] = "True";
     }
-    else
+    else if (mSettings->Contains("X_Effect_Locked"))
     {
-        mSettings.erase("X_Effect_Locked");
+        mSettings.Edit().erase("X_Effect_Locked");
     }
 }
 
@@ -470,18 +489,19 @@ void Effect::IncrementChangeCount()
         mCache->Delete();
         mCache = nullptr;
     }
+    ClearCheckpoints();
 }
 
 std::string Effect::GetSettingsAsString() const
 {
     std::unique_lock<std::recursive_mutex> lock(settingsLock);
-    return mSettings.AsString();
+    return mSettings->AsString();
 }
 
 std::string Effect::GetSettingsAsJSON() const
 {
     std::unique_lock<std::recursive_mutex> lock(settingsLock);
-    return mSettings.AsJSON();
+    return mSettings->AsJSON();
 }
 
 void Effect::SetSettings(const std::string& settings, bool keepxsettings, bool json) {
@@ -491,34 +511,49 @@ void Effect::SetSettings(const std::string& settings, bool keepxsettings, bool j
 
     SettingsMap x;
     if (keepxsettings) {
-        for (const auto& it : mSettings) {
+        for (const auto& it : *mSettings) {
             if (it.first.size() > 2 && it.first[0] == 'X' && it.first[1] == '_') {
                 x[it.first] = it.second;
             }
         }
     }
-    json ? mSettings.ParseJson(settings) : mSettings.Parse(settings);
+    SettingsMap newSettings;
+    json ? newSettings.ParseJson(settings) : newSettings.Parse(settings);
     if (keepxsettings) {
         for (const auto& it : x) {
-            mSettings[it.first] = it.second;
+            newSettings[it.first] = it.second;
         }
     }
+    mSettings = SharedSettingsMap(std::move(newSettings));
 
     if (old != GetSettingsAsString()) {
         IncrementChangeCount();
     }
 }
 
+// replace the settings with an already parsed map, no x settings are kept
+void Effect::SetSettingsMap(SettingsMap&& settings)
+{
+    std::unique_lock<std::recursive_mutex> lock(settingsLock);
+
+    bool changed = settings != *mSettings;
+    mSettings = SharedSettingsMap(std::move(settings));
+
+    if (changed) {
+        IncrementChangeCount();
+    }
+}
+
 // this is not sensitive to the order of the settings in the string ... it compares the effect settings with the provide settings string and return true if anything has changed
 bool Effect::SettingsChanged(const std::string& settings)
 {
     SettingsMap x;
     x.Parse(settings);
 
-    if (mSettings.size() != x.size())
+    if (mSettings->size() != x.size())
         return true;
 
-    for (const auto& it: mSettings) {
+    for (const auto& it: *mSettings) {
         if (it.second != x[it.first])
             return true;
     }
@@ -531,7 +566,7 @@ void Effect::PressButton(RenderableEffect* re, const std::string& id)
     bool changed = false;
     if (StartsWith(id, "E_"))
     {
-        changed = re->PressButton(id, mPaletteMap, mSettings);
+        changed = re->PressButton(id, mPaletteMap.Edit(), mSettings.Edit());
     }
     else
     {
@@ -549,47 +584,49 @@ void Effect::ApplySetting(const std::string& id, const std::string& value, Value
     {
         if (vc != nullptr && vc->IsActive())
         {
-            mPaletteMap[vcid] = vc->Serialise();
+            mPaletteMap.Edit()[vcid] = vc->Serialise();
         }
         else
         {
-            mPaletteMap.erase(vcid);
-            mPaletteMap[id] = value;
+            SettingsMap& paletteMap = mPaletteMap.Edit();
+            paletteMap.erase(vcid);
+            paletteMap[id] = value;
         }
     }
     else
     {
+        SettingsMap& settings = mSettings.Edit();
         if (vc != nullptr && vc->IsActive())
         {
-            mSettings[vcid] = vc->Serialise();
+            settings[vcid] = vc->Serialise();
         }
         else
         {
-            mSettings.erase(vcid);
+            settings.erase(vcid);
 
             wxString wid = id;
 
             if (wid.Contains("FILEPICKER")) {
                 wxString realid = wid.substr(0, wid.Length() - 3);
                 if (wid.EndsWith("_FN")) {
-                    mSettings[realid] = value;
+                    settings[realid] = value;
                 } else if (wid.EndsWith("_PN")) {
-                    if (mSettings.Contains(realid) && mSettings.Get(realid, "") != "") {
-                        wxString origName = mSettings[realid];
+                    if (settings.Contains(realid) && settings.Get(realid, "") != "") {
+                        wxString origName = settings[realid];
                         wxFileName fn(origName, origName[1] == ':' ? wxPATH_WIN : wxPATH_UNIX);
                         fn.SetPath(value);
                         wxString newName = fn.GetFullPath();
-                        mSettings[realid] = newName;
+                        settings[realid] = newName;
                     }
                 }
                 else if (wid.EndsWith("_SF")) {
-                    if (mSettings.Contains(realid) && mSettings.Get(realid, "") != "") {
+                    if (settings.Contains(realid) && settings.Get(realid, "") != "") {
 
                         // This moves through all possible options to locate the file relative to the provided show folder.
                         // This will be the deepest path possible ... so if the file exists in multiple locations it will find the 
                         // deepest valid path
                         // This only updates the path if we find the file ... if not found there will be no errors but it will log the issue
-                        wxString origName = mSettings[realid];
+                        wxString origName = settings[realid];
 
                         wxFileName fn(origName, origName[1] == ':' ? wxPATH_WIN : wxPATH_UNIX);
 
@@ -604,17 +641,17 @@ void Effect::ApplySetting(const std::string& id, const std::string& value, Value
                             pth += file;
                             if (FileExists(pth)) {
                                 // found it
-                                mSettings[realid] = pth;
+                                settings[realid] = pth;
                                 break;
                             }
                         }
-                        if (origName == mSettings[realid] && !FileExists(origName)) {
+                        if (origName == settings[realid] && !FileExists(origName)) {
                             logger_base.warn("Unable to correct show folder '%s' : '%s' to '%s'", (const char*)realid.c_str(), (const char*)origName.c_str(), (const char*)value.c_str());
                         }
                     }
                 }
             } else {
-                mSettings[id] = value;
+                settings[id] = value;
             }
         }
     }
@@ -623,11 +660,11 @@ void Effect::ApplySetting(const std::string& id, const std::string& value, Value
 
 bool Effect::UsesColour(const std::string& from)
 {
-    for (auto it : mPaletteMap) {
+    for (const auto& it : *mPaletteMap) {
         if (StartsWith(it.first, "C_BUTTON")) { // only check the colours
             if (Lower(it.second) == Lower(from)) { // check the colours match
                 std::string setting = "C_CHECKBOX" + it.first.substr(8);
-                if (mPaletteMap.Get(setting, "0") == "1") { // check the colours checkbox is checked
+                if (mPaletteMap->Get(setting, "0") == "1") { // check the colours checkbox is checked
                     return true;
                 }
             }
@@ -639,12 +676,13 @@ bool Effect::UsesColour(const std::string& from)
 int Effect::ReplaceColours(xLightsFrame* frame, const std::string& from, const std::string& to)
 {
     int res = 0;
-    for (auto it : mPaletteMap) {
+    SettingsMap paletteMap = *mPaletteMap;
+    for (const auto& it : *mPaletteMap) {
         if (StartsWith(it.first, "C_BUTTON")) {
             if (Lower(it.second) == Lower(from)) {
                 std::string setting = "C_CHECKBOX" + it.first.substr(8);
-                if (mPaletteMap.Get(setting, "0") == "1") {
-                    mPaletteMap[it.first] = to;
+                if (mPaletteMap->Get(setting, "0") == "1") {
+                    paletteMap[it.first] = to;
                     res++;
                 }
             }
@@ -652,7 +690,8 @@ int Effect::ReplaceColours(xLightsFrame* frame, const std::string& from, const s
     }
 
     if (res > 0) {
-        ParseColorMap(mPaletteMap, mColors, mCC);
+        mPaletteMap = SharedSettingsMap(std::move(paletteMap));
+        ParseColorMap(*mPaletteMap, mColors, mCC);
 
         // we changed so this effect needs to re-render
         frame->RenderEffectForModel(GetParentEffectLayer()->GetParentElement()->GetModelName(),
@@ -667,7 +706,7 @@ void Effect::CopySettingsMap(SettingsMap &target, bool stripPfx) const
 {
     std::unique_lock<std::recursive_mutex> lock(settingsLock);
 
-    for (std::map<std::string,std::string>::const_iterator it=mSettings.begin(); it!=mSettings.end(); ++it)
+    for (std::map<std::string,std::string>::const_iterator it=mSettings->begin(); it!=mSettings->end(); ++it)
     {
         std::string name = it->first;
         if (stripPfx && name[1] == '_')
@@ -676,7 +715,7 @@ void Effect::CopySettingsMap(SettingsMap &target, bool stripPfx) const
         }
         target[name] = it->second;
     }
-    for (std::map<std::string,std::string>::const_iterator it=mPaletteMap.begin(); it!=mPaletteMap.end(); ++it)
+    for (std::map<std::string,std::string>::const_iterator it=mPaletteMap->begin(); it!=mPaletteMap->end(); ++it)
     {
         std::string name = it->first;
         if (stripPfx && name[1] == '_'  && (name[2] == 'S' || name[2] == 'C' || name[2] == 'V')) //only need the slider, checkbox and value curve entries
@@ -693,36 +732,36 @@ void Effect::FixBuffer(const Model* m)
     if (m == nullptr) return;
 
     auto styles = m->GetBufferStyles();
-    auto style = mSettings.Get("B_CHOICE_BufferStyle", "Default");
+    auto style = mSettings->Get("B_CHOICE_BufferStyle", "Default");
 
     if (std::find(styles.begin(), styles.end(), style) == styles.end())
     {
         if (style.substr(0, 9) == "Per Model")
         {
-            mSettings["B_CHOICE_BufferStyle"] = style.substr(10);
+            mSettings.Edit()["B_CHOICE_BufferStyle"] = style.substr(10);
         }
         else
         {
-            mSettings["B_CHOICE_BufferStyle"] = "Default";
+            mSettings.Edit()["B_CHOICE_BufferStyle"] = "Default";
         }
     }
 }
 
 bool Effect::IsPersistent() const
 {
-    return mSettings.GetBool("B_CHECKBOX_OverlayBkg", false);
+    return mSettings->GetBool("B_CHECKBOX_OverlayBkg", false);
 }
 
 std::string Effect::GetPaletteAsString() const
 {
     std::unique_lock<std::recursive_mutex> lock(settingsLock);
-    return mPaletteMap.AsString();
+    return mPaletteMap->AsString();
 }
 
 std::string Effect::GetPaletteAsJSON() const
 {
     std::unique_lock<std::recursive_mutex> lock(settingsLock);
-    return mPaletteMap.AsJSON();
+    return mPaletteMap->AsJSON();
 }
 
 void Effect::SetPalette(const std::string& i)
@@ -731,17 +770,33 @@ void Effect::SetPalette(const std::string& i)
 
     auto old = GetPaletteAsString();
 
-    mPaletteMap.Parse(i);
+    mPaletteMap = ParseSettingsString(i);
     mColors.clear();
     mCC.clear();
-    if (!mPaletteMap.empty()) {
-        ParseColorMap(mPaletteMap, mColors, mCC);
+    if (!mPaletteMap->empty()) {
+        ParseColorMap(*mPaletteMap, mColors, mCC);
     }
     if (old != GetPaletteAsString()) {
         IncrementChangeCount();
     }
 }
 
+void Effect::SetPaletteMap(SettingsMap&& palette)
+{
+    std::unique_lock<std::recursive_mutex> lock(settingsLock);
+
+    bool changed = palette != *mPaletteMap;
+    mPaletteMap = SharedSettingsMap(std::move(palette));
+    mColors.clear();
+    mCC.clear();
+    if (!mPaletteMap->empty()) {
+        ParseColorMap(*mPaletteMap, mColors, mCC);
+    }
+    if (changed) {
+        IncrementChangeCount();
+    }
+}
+
 // This only updates the colour palette ... preserving all the other colour settings
 void Effect::SetColourOnlyPalette(const std::string& i, bool json)
 {
@@ -751,26 +806,28 @@ void Effect::SetColourOnlyPalette(const std::string& i, bool json)
     auto oldPalette = mPaletteMap;
 
     // parse in the new one
-    json ? mPaletteMap.ParseJson(i) : mPaletteMap.Parse(i);
+    SettingsMap paletteMap;
+    json ? paletteMap.ParseJson(i) : paletteMap.Parse(i);
 
     // copy over all the non colour entries
-    for (auto it = oldPalette.begin(); it != oldPalette.end(); ++it)
+    for (auto it = oldPalette->begin(); it != oldPalette->end(); ++it)
     {
         wxString key(it->first);
         if (!key.StartsWith("C_BUTTON_Palette") && !key.StartsWith("C_CHECKBOX_Palette"))
         {
-            mPaletteMap[it->first] = it->second;
+            paletteMap[it->first] = it->second;
         }
     }
+    mPaletteMap = SharedSettingsMap(std::move(paletteMap));
 
     mColors.clear();
     mCC.clear();
     IncrementChangeCount();
-    if (mPaletteMap.empty())
+    if (mPaletteMap->empty())
     {
         return;
     }
-    ParseColorMap(mPaletteMap, mColors, mCC);
+    ParseColorMap(*mPaletteMap, mColors, mCC);
 }
 
 void Effect::CopyPalette(xlColorVector &target, xlColorCurveVector& newcc) const
@@ -785,11 +842,11 @@ void Effect::PaletteMapUpdated() {
     mColors.clear();
     mCC.clear();
     IncrementChangeCount();
-    if (mPaletteMap.empty())
+    if (mPaletteMap->empty())
     {
         return;
     }
-    ParseColorMap(mPaletteMap, mColors, mCC);
+    ParseColorMap(*mPaletteMap, mColors, mCC);
 }
 
 bool operator<(const Effect &e1, const Effect &e2)
@@ -827,3 +884,75 @@ void Effect::PurgeCache(bool deleteCache) {
         mCache = nullptr;
     }
 }
+
+// Keeps memory bounded on long effects ... once exceeded every second checkpoint is dropped
+#define MAX_CHECKPOINTS_PER_BUFFER 32
+
+void Effect::AddCheckpoint(const std::string& bufferKey, EffectStateCheckpoint* checkpoint)
+{
+    std::unique_lock<std::recursive_mutex> lock(settingsLock);
+    auto& checkpoints = mCheckpoints[bufferKey];
+    auto it = checkpoints.find(checkpoint->period);
+    if (it != checkpoints.end()) {
+        delete it->second;
+        it->second = checkpoint;
+        return;
+    }
+    checkpoints[checkpoint->period] = checkpoint;
+
+    if (checkpoints.size() > MAX_CHECKPOINTS_PER_BUFFER) {
+        bool drop = false;
+        for (auto cit = checkpoints.begin(); cit != checkpoints.end();) {
+            if (drop) {
+                delete cit->second;
+                cit = checkpoints.erase(cit);
+            } else {
+                ++cit;
+            }
+            drop = !drop;
+        }
+    }
+}
+
+bool Effect::HasCheckpoint(const std::string& bufferKey, int period) const
+{
+    std::unique_lock<std::recursive_mutex> lock(settingsLock);
+    auto it = mCheckpoints.find(bufferKey);
+    return it != mCheckpoints.end() && it->second.find(period) != it->second.end();
+}
+
+int Effect::GetCheckpointBufferCount(const std::string& bufferKey, int period) const
+{
+    std::unique_lock<std::recursive_mutex> lock(settingsLock);
+    auto it = mCheckpoints.find(bufferKey);
+    if (it == mCheckpoints.end()) {
+        return 0;
+    }
+    auto cit = it->second.find(period);
+    return cit == it->second.end() ? 0 : cit->second->bufferCount;
+}
+
+bool Effect::RestoreCheckpoint(const std::string& bufferKey, int period, RenderBuffer& buffer) const
+{
+    std::unique_lock<std::recursive_mutex> lock(settingsLock);
+    auto it = mCheckpoints.find(bufferKey);
+    if (it == mCheckpoints.end()) {
+        return false;
+    }
+    auto cit = it->second.find(period);
+    if (cit == it->second.end()) {
+        return false;
+    }
+    return buffer.RestoreCheckpoint(*cit->second);
+}
+
+void Effect::ClearCheckpoints()
+{
+    std::unique_lock<std::recursive_mutex> lock(settingsLock);
+    for (auto& it : mCheckpoints) {
+        for (auto& cit : it.second) {
+            delete cit.second;
+        }
+    }
+    mCheckpoints.clear();
+}
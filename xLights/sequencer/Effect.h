@@ -15,6 +15,7 @@
 #include <vector>
 #include <string>
 #include <mutex>
+#include <map>
 
 #include "../ColorCurve.h" // This needs to be here
 #include "../UtilClasses.h"
@@ -26,6 +27,7 @@ class ValueCurve;
 class RenderCacheItem;
 class RenderBuffer;
 class RenderCache;
+class EffectStateCheckpoint;
 class Model;
 class RenderableEffect;
 class xLightsFrame;
@@ -51,12 +53,13 @@ class Effect
     EffectLayer* mParentLayer = nullptr;
     xlColor mColorMask = xlBLACK;
     mutable std::recursive_mutex settingsLock;
-    SettingsMap mSettings;
-    SettingsMap mPaletteMap;
+    SharedSettingsMap mSettings;
+    SharedSettingsMap mPaletteMap;
     xlColorVector mColors;
     xlColorCurveVector mCC;
     xlDisplayList background;
     RenderCacheItem *mCache = nullptr;
+    std::map<std::string, std::map<int, EffectStateCheckpoint*>> mCheckpoints;
     wxLongLong _timeToDelete = 0;
 
     Effect() {}  //don't allow default or copy constructor
@@ -66,6 +69,9 @@ class Effect
 public:
     Effect(EffectLayer* parent, int id, const std::string & name, const std::string &settings, const std::string &palette,
         int startTimeMS, int endTimeMS, int Selected, bool Protected);
+    // settings/palette already parsed ... effects loaded from the same EffectDB entry share them until edited
+    Effect(EffectLayer* parent, int id, const std::string & name, const SharedSettingsMap &settings, const SharedSettingsMap &palette,
+        int startTimeMS, int endTimeMS, int Selected, bool Protected);
     virtual ~Effect();
 
     int GetID() const { return mID; }
@@ -118,12 +124,13 @@ public:
     std::string GetSettingsAsString() const;
     std::string GetSettingsAsJSON() const;
     void SetSettings(const std::string &settings, bool keepxsettings, bool json = false);
+    void SetSettingsMap(SettingsMap&& settings);
     bool SettingsChanged(const std::string& settings);
     void ApplySetting(const std::string& id, const std::string& value, ValueCurve* vc, const std::string& vcid);
     bool UsesColour(const std::string& from);
     int ReplaceColours(xLightsFrame* frame, const std::string& from, const std::string& to);
     void PressButton(RenderableEffect* re, const std::string& id);
-    const SettingsMap &GetSettings() const { return mSettings; }
+    const SettingsMap &GetSettings() const { return *mSettings; }
     void CopySettingsMap(SettingsMap &target, bool stripPfx = false) const;
     void FixBuffer(const Model* m);
     bool IsPersistent() const;
@@ -132,17 +139,18 @@ public:
 
     const xlColorVector &GetPalette() const { return mColors; }
     int GetPaletteSize() const { return mColors.size(); }
-    const SettingsMap &GetPaletteMap() const { return mPaletteMap; }
+    const SettingsMap &GetPaletteMap() const { return *mPaletteMap; }
     std::string GetPaletteAsString() const;
     std::string GetPaletteAsJSON() const;
     void SetPalette(const std::string& i);
+    void SetPaletteMap(SettingsMap&& palette);
     void SetColourOnlyPalette(const std::string& i, bool json = false);
     void CopyPalette(xlColorVector &target, xlColorCurveVector& newcc) const;
 
-    /* Do NOT call these on any thread other than the main thread */
-    SettingsMap &GetSettings() { return mSettings; }
+    /* Do NOT call these on any thread other than the main thread ... they take a private copy of shared settings */
+    SettingsMap &GetSettings() { return mSettings.Edit(); }
     xlColorVector &GetPalette() { return mColors; }
-    SettingsMap &GetPaletteMap() { return mPaletteMap; }
+    SettingsMap &GetPaletteMap() { return mPaletteMap.Edit(); }
     void PaletteMapUpdated();
 
     xlDisplayList &GetBackgroundDisplayList() { return background; }
@@ -165,6 +173,14 @@ public:
     bool GetFrame(RenderBuffer &buffer, RenderCache &renderCache);
     void AddFrame(RenderBuffer &buffer, RenderCache &renderCache);
     void PurgeCache(bool deleteCachefile = false);
+
+    // Simulation state captured while rendering stateful effects, keyed by buffer then frame
+    void AddCheckpoint(const std::string& bufferKey, EffectStateCheckpoint* checkpoint);
+    bool HasCheckpoint(const std::string& bufferKey, int period) const;
+    // buffer count the layer had when the checkpoint was taken, 0 if there isn't one
+    int GetCheckpointBufferCount(const std::string& bufferKey, int period) const;
+    bool RestoreCheckpoint(const std::string& bufferKey, int period, RenderBuffer& buffer) const;
+    void ClearCheckpoints();
 };
 
 bool operator<(const Effect &e1, const Effect &e2);
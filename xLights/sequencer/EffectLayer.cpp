@@ -9,6 +9,7 @@
  **************************************************************/
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 
 #include "EffectLayer.h"
@@ -27,6 +28,80 @@
 std::atomic_int EffectLayer::exclusive_index(0);
 const std::string NamedLayer::NO_NAME("");
 
+EffectLayerSnapshot::EffectLayerSnapshot(const std::vector<Effect*>& effects, uint32_t version) :
+    _version(version), _effects(effects)
+{
+    // effects are normally already in order but loading can add them unsorted
+    std::stable_sort(_effects.begin(), _effects.end(), EffectLayer::SortEffectByStartTime);
+
+    _starts.reserve(_effects.size());
+    _ends.reserve(_effects.size());
+    _maxEnds.reserve(_effects.size());
+    int maxEnd = std::numeric_limits<int>::min();
+    for (const auto& it : _effects) {
+        _starts.push_back(it->GetStartTimeMS());
+        _ends.push_back(it->GetEndTimeMS());
+        maxEnd = std::max(maxEnd, _ends.back());
+        _maxEnds.push_back(maxEnd);
+    }
+}
+
+Effect* EffectLayerSnapshot::GetEffectForTime(int ms, int& hint) const
+{
+    // consecutive frames almost always land in the same effect
+    if (hint >= 0 && hint < (int)_effects.size() && _starts[hint] <= ms && _ends[hint] > ms && (hint == 0 || _maxEnds[hint - 1] <= ms)) {
+        return _effects[hint];
+    }
+
+    // no effect before the first one whose running end passes ms can cover it
+    int last = std::upper_bound(_starts.begin(), _starts.end(), ms) - _starts.begin();
+    for (int i = std::upper_bound(_maxEnds.begin(), _maxEnds.end(), ms) - _maxEnds.begin(); i < last; ++i) {
+        if (_ends[i] > ms) {
+            hint = i;
+            return _effects[i];
+        }
+    }
+    return nullptr;
+}
+
+int EffectLayerSnapshot::FirstEndingAtOrAfter(int ms) const
+{
+    return std::lower_bound(_maxEnds.begin(), _maxEnds.end(), ms) - _maxEnds.begin();
+}
+
+Effect* EffectLayerSnapshot::GetEffectByTime(int ms) const
+{
+    int last = std::upper_bound(_starts.begin(), _starts.end(), ms) - _starts.begin();
+    for (int i = FirstEndingAtOrAfter(ms); i < last; ++i) {
+        if (_ends[i] >= ms) {
+            return _effects[i];
+        }
+    }
+    return nullptr;
+}
+
+Effect* EffectLayerSnapshot::GetEffectBeforeTime(int ms) const
+{
+    int i = std::lower_bound(_starts.begin(), _starts.end(), ms) - _starts.begin();
+    return i == 0 ? nullptr : _effects[i - 1];
+}
+
+std::vector<Effect*> EffectLayerSnapshot::GetAllEffectsByTime(int startTimeMS, int endTimeMS) const
+{
+    std::vector<Effect*> effs;
+    int last = std::upper_bound(_starts.begin(), _starts.end(), endTimeMS) - _starts.begin();
+    for (int i = FirstEndingAtOrAfter(startTimeMS); i < last; ++i) {
+        int st = _starts[i];
+        int et = _ends[i];
+        if ((st >= startTimeMS && st < endTimeMS) ||
+            (et <= endTimeMS && et > startTimeMS) ||
+            (et > endTimeMS && st < startTimeMS)) {
+            effs.push_back(_effects[i]);
+        }
+    }
+    return effs;
+}
+
 EffectLayer::EffectLayer(Element* parent)
 {
     mParentElement = parent;
@@ -79,14 +154,24 @@ Effect* EffectLayer::GetEffect(int index) const
     }
 }
 Effect* EffectLayer::GetEffectByTime(int timeMS) {
+    return GetSnapshot()->GetEffectByTime(timeMS);
+}
+
+std::shared_ptr<const EffectLayerSnapshot> EffectLayer::GetSnapshot() const
+{
+    auto snapshot = std::atomic_load(&mSnapshot);
+    if (snapshot != nullptr && snapshot->GetVersion() == mSnapshotVersion) {
+        return snapshot;
+    }
+
     std::unique_lock<std::recursive_mutex> locker(lock);
-    for(std::vector<Effect*>::iterator i = mEffects.begin(); i != mEffects.end(); i++) {
-        if (timeMS >= (*i)->GetStartTimeMS() &&
-            timeMS <= (*i)->GetEndTimeMS()) {
-            return (*i);
-        }
+    snapshot = std::atomic_load(&mSnapshot);
+    uint32_t version = mSnapshotVersion;
+    if (snapshot == nullptr || snapshot->GetVersion() != version) {
+        snapshot = std::make_shared<const EffectLayerSnapshot>(mEffects, version);
+        std::atomic_store(&mSnapshot, snapshot);
     }
-    return nullptr;
+    return snapshot;
 }
 
 
@@ -189,6 +274,17 @@ void EffectLayer::RemoveAllEffects(UndoManager *undo_mgr)
 
 Effect* EffectLayer::AddEffect(int id, const std::string &n, const std::string &settings, const std::string &palette,
                                int startTimeMS, int endTimeMS, int Selected, bool Protected, bool suppress_sort)
+{
+    SettingsMap settingsMap;
+    settingsMap.Parse(settings);
+    SettingsMap paletteMap;
+    paletteMap.Parse(palette);
+    return AddEffect(id, n, SharedSettingsMap(std::move(settingsMap)), SharedSettingsMap(std::move(paletteMap)),
+                     startTimeMS, endTimeMS, Selected, Protected, suppress_sort);
+}
+
+Effect* EffectLayer::AddEffect(int id, const std::string &n, const SharedSettingsMap &settings, const SharedSettingsMap &palette,
+                               int startTimeMS, int endTimeMS, int Selected, bool Protected, bool suppress_sort)
 {
     std::unique_lock<std::recursive_mutex> locker(lock);
     std::string name(n);
@@ -244,6 +340,7 @@ void EffectLayer::SortEffects()
 {
     std::sort(mEffects.begin(), mEffects.end(), SortEffectByStartTime);
     NumberEffects();
+    InvalidateSnapshot();
 }
 
 bool EffectLayer::IsStartTimeLinked(int index) const
@@ -349,22 +446,7 @@ bool EffectLayer::HitTestEffectBetweenTime(int t1MS, int t2MS) const
 
 Effect* EffectLayer::GetEffectBeforeTime(int ms) const
 {
-    int i;
-    for (i = 0; i < mEffects.size(); i++)
-    {
-        if (mEffects[i]->GetStartTimeMS() >= ms)
-        {
-            break;
-        }
-    }
-    if (i == 0)
-    {
-        return nullptr;
-    }
-    else
-    {
-        return mEffects[i - 1];
-    }
+    return GetSnapshot()->GetEffectBeforeTime(ms);
 }
 
 Effect* EffectLayer::GetEffectAfterTime(int ms) const
@@ -580,23 +662,7 @@ std::vector<Effect*> EffectLayer::GetEffectsByTypeAndTime(const std::string &typ
 
 std::vector<Effect*> EffectLayer::GetAllEffectsByTime(int startTimeMS, int endTimeMS)
 {
-    std::vector<Effect*> effs = std::vector<Effect*>();
-    for (int i = 0; i < mEffects.size(); i++)
-    {
-        if (mEffects[i]->GetStartTimeMS() >= startTimeMS && mEffects[i]->GetStartTimeMS() < endTimeMS)
-        {
-            effs.push_back(mEffects[i]);
-        }
-        else if (mEffects[i]->GetEndTimeMS() <= endTimeMS && mEffects[i]->GetEndTimeMS() > startTimeMS)
-        {
-            effs.push_back(mEffects[i]);
-        }
-        else if (mEffects[i]->GetEndTimeMS() > endTimeMS &&  mEffects[i]->GetStartTimeMS() < startTimeMS)
-        {
-            effs.push_back(mEffects[i]);
-        }
-    }
-    return effs;
+    return GetSnapshot()->GetAllEffectsByTime(startTimeMS, endTimeMS);
 }
 
 void EffectLayer::PlayEffect(Effect* effect)
@@ -1375,6 +1441,7 @@ bool EffectLayer::SortEffectByStartTime(Effect *e1,Effect *e2)
 
 void EffectLayer::IncrementChangeCount(int startMS, int endMS)
 {
+    InvalidateSnapshot();
     if (mParentElement) {
         mParentElement->IncrementChangeCount(startMS, endMS);
     }
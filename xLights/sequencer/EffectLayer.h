@@ -14,7 +14,9 @@
 #include <atomic>
 #include <string>
 #include <list>
+#include <memory>
 #include <mutex>
+#include <vector>
 #include "Effect.h"
 #include "UndoManager.h"
 #include "../effects/EffectManager.h"
@@ -29,6 +31,36 @@ class ValueCurve;
 class EffectsGrid;
 class xLightsFrame;
 
+// Immutable time ordered copy of a layer's effects. Rendering looks effects up in this rather than walking the
+// layer under its lock every frame. A new one is built the first time it is asked for after the layer changes.
+// Removed effects are not deleted until CleanupAfterRender so the Effect pointers stay valid while in use.
+class EffectLayerSnapshot
+{
+public:
+    EffectLayerSnapshot(const std::vector<Effect*>& effects, uint32_t version);
+
+    uint32_t GetVersion() const { return _version; }
+    int GetEffectCount() const { return (int)_effects.size(); }
+    Effect* GetEffect(int index) const { return _effects[index]; }
+
+    // effect where start <= ms < end ... hint is the index last returned and is checked first
+    Effect* GetEffectForTime(int ms, int& hint) const;
+    // effect where start <= ms <= end
+    Effect* GetEffectByTime(int ms) const;
+    // last effect starting before ms
+    Effect* GetEffectBeforeTime(int ms) const;
+    std::vector<Effect*> GetAllEffectsByTime(int startTimeMS, int endTimeMS) const;
+
+private:
+    int FirstEndingAtOrAfter(int ms) const;
+
+    uint32_t _version;
+    std::vector<Effect*> _effects;
+    std::vector<int> _starts;
+    std::vector<int> _ends;
+    std::vector<int> _maxEnds; // running maximum of _ends so overlapping effects are still found
+};
+
 class EffectLayer
 {
     public:
@@ -37,6 +69,8 @@ class EffectLayer
 
         Effect *AddEffect(int id, const std::string &name, const std::string &settings, const std::string &palette,
                           int startTimeMS, int endTimeMS, int Selected, bool Protected, bool suppress_sort = false);
+        Effect *AddEffect(int id, const std::string &name, const SharedSettingsMap &settings, const SharedSettingsMap &palette,
+                          int startTimeMS, int endTimeMS, int Selected, bool Protected, bool suppress_sort = false);
         Effect* GetEffect(int index) const;
         const std::vector<Effect*>& GetEffects() const { return mEffects; }
         Effect* GetEffectByTime(int ms);
@@ -117,6 +151,8 @@ class EffectLayer
         void UpdateAllSelectedEffects(const std::string& palette);
 
         void IncrementChangeCount(int startMS, int endMS);
+        void InvalidateSnapshot() { ++mSnapshotVersion; }
+        std::shared_ptr<const EffectLayerSnapshot> GetSnapshot() const;
 
         std::recursive_mutex &GetLock() {return lock;}
     
@@ -124,9 +160,9 @@ class EffectLayer
 
         void CleanupAfterRender();
         void NumberEffects();
+        void SortEffects();
     protected:
     private:
-        void SortEffects();
         void PlayEffect(Effect* effect);
 
         static std::atomic_int exclusive_index;
@@ -140,7 +176,9 @@ class EffectLayer
         std::list<Effect*> mEffectsToDelete;
         int mIndex = 0;
         Element* mParentElement = nullptr;
-        std::recursive_mutex lock;
+        mutable std::recursive_mutex lock;
+        std::atomic_uint32_t mSnapshotVersion{ 0 };
+        mutable std::shared_ptr<const EffectLayerSnapshot> mSnapshot;
 };
 
 class NamedLayer: public EffectLayer {
@@ -73,6 +73,15 @@ void Element::CleanupAfterRender() {
     }
 }
 
+void Element::ClearEffectCheckpoints() {
+    for (auto &a : mEffectLayers) {
+        std::unique_lock<std::recursive_mutex> lock(a->GetLock());
+        for (int i = 0; i < a->GetEffectCount(); ++i) {
+            a->GetEffect(i)->ClearCheckpoints();
+        }
+    }
+}
+
 std::string Element::GetFullName() const {
     return mName;
 }
@@ -483,6 +492,16 @@ void ModelElement::CleanupAfterRender() {
     Element::CleanupAfterRender();
 }
 
+void ModelElement::ClearEffectCheckpoints() {
+    for (auto &a : mStrands) {
+        a->ClearEffectCheckpoints();
+    }
+    for (auto &a : mSubModels) {
+        a->ClearEffectCheckpoints();
+    }
+    Element::ClearEffectCheckpoints();
+}
+
 NodeLayer* ModelElement::GetNodeEffectLayer(int index) const
 {
     int startStrand = 0;
@@ -127,6 +127,7 @@ public:
         dirtyStart = dirtyEnd = -1;
     }
     virtual void CleanupAfterRender();
+    virtual void ClearEffectCheckpoints();
     
 protected:
     EffectLayer* AddEffectLayerInternal();
@@ -281,6 +282,7 @@ class ModelElement : public Element
         int GetStrandCount() const { return mStrands.size(); }
     
         virtual void CleanupAfterRender() override;
+        virtual void ClearEffectCheckpoints() override;
 
     protected:
     private:
@@ -11,6 +11,7 @@
 #include <wx/wx.h>
 #include <wx/utils.h>
 #include <wx/tokenzr.h>
+#include <wx/stopwatch.h>
 #include <wx/filename.h>
 
 #include <algorithm>
@@ -27,6 +28,7 @@
 #include "../SequenceViewManager.h"
 #include "../JukeboxPanel.h"
 #include "../TraceLog.h"
+#include "../Parallel.h"
 #include "../UtilFunctions.h"
 
 #include <log4cpp/Category.hh>
@@ -644,16 +646,20 @@ void SequenceElements::MoveElement(int index,int destinationIndex)
 int SequenceElements::LoadEffects(EffectLayer* effectLayer,
     const std::string& type,
     wxXmlNode* effectLayerNode,
-    const std::vector<std::string>& effectStrings,
-    const std::vector<std::string>& colorPalettes)
+    const std::vector<SharedSettingsMap>& effectSettings,
+    const std::vector<SharedSettingsMap>& colorPalettes)
 {
     static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+    // FixFile keeps a static cache so calls from the loading threads must be serialised
+    static std::mutex fixFileLock;
+    static const SharedSettingsMap EMPTY_SETTINGS;
 
     int loaded = 0;
     for (wxXmlNode* effect = effectLayerNode->GetChildren(); effect != nullptr; effect = effect->GetNext()) {
         if (effect->GetName() == STR_EFFECT) {
             std::string effectName;
-            std::string settings;
+            SharedSettingsMap inlineSettings;
+            const SharedSettingsMap* settings = &EMPTY_SETTINGS;
             int id = 0;
             long palette = -1;
 
@@ -674,23 +680,27 @@ int SequenceElements::LoadEffects(EffectLayer* effectLayer,
                 id = wxAtoi(effect->GetAttribute(STR_ID, STR_ZERO));
                 if (effect->GetAttribute(STR_REF) != STR_EMPTY) {
                     int ref = wxAtoi(effect->GetAttribute(STR_REF));
-                    if (ref >= effectStrings.size()) {
+                    if (ref >= effectSettings.size()) {
                         logger_base.warn("Effect string not found for effect %s between %d and %d. Settings ignored.", (const char*)effectName.c_str(), (int)startTime, (int)endTime);
-                        settings = "";
                     }
                     else {
-                        settings = effectStrings[ref];
+                        settings = &effectSettings[ref];
                     }
                 }
                 else {
-                    settings = ToStdString(effect->GetNodeContent());
-                }
-
-                if (settings.find("E_FILEPICKER_Pictures_Filename") != std::string::npos) {
-                    settings = FixEffectFileParameter("E_FILEPICKER_Pictures_Filename", settings, "");
-                }
-                else if (settings.find("E_FILEPICKER_Glediator_Filename") != std::string::npos) {
-                    settings = FixEffectFileParameter("E_FILEPICKER_Glediator_Filename", settings, "");
+                    std::string settingsString = ToStdString(effect->GetNodeContent());
+                    if (settingsString.find("E_FILEPICKER_Pictures_Filename") != std::string::npos) {
+                        std::unique_lock<std::mutex> lock(fixFileLock);
+                        settingsString = FixEffectFileParameter("E_FILEPICKER_Pictures_Filename", settingsString, "");
+                    }
+                    else if (settingsString.find("E_FILEPICKER_Glediator_Filename") != std::string::npos) {
+                        std::unique_lock<std::mutex> lock(fixFileLock);
+                        settingsString = FixEffectFileParameter("E_FILEPICKER_Glediator_Filename", settingsString, "");
+                    }
+                    SettingsMap parsed;
+                    parsed.Parse(settingsString);
+                    inlineSettings = SharedSettingsMap(std::move(parsed));
+                    settings = &inlineSettings;
                 }
 
                 wxString tmp;
@@ -702,12 +712,13 @@ int SequenceElements::LoadEffects(EffectLayer* effectLayer,
                 // store timing labels in name attribute
                 effectName = UnXmlSafe(effect->GetAttribute(STR_LABEL));
             }
-            std::string pal = STR_EMPTY;
-            if (palette != -1) {
-                pal = colorPalettes[palette];
+            const SharedSettingsMap* pal = &EMPTY_SETTINGS;
+            if (palette >= 0 && palette < (long)colorPalettes.size()) {
+                pal = &colorPalettes[palette];
             }
-            effectLayer->AddEffect(id, effectName, settings, pal,
-                startTime, endTime, EFFECT_NOT_SELECTED, bProtected);
+            // effects are saved in time order so we only sort once the layer is loaded
+            effectLayer->AddEffect(id, effectName, *settings, *pal,
+                startTime, endTime, EFFECT_NOT_SELECTED, bProtected, true);
         }
         else if (effect->GetName() == STR_NODE && effectLayerNode->GetName() == STR_STRAND) {
             StrandElement* se = (StrandElement*)effectLayer->GetParentElement();
@@ -716,10 +727,11 @@ int SequenceElements::LoadEffects(EffectLayer* effectLayer,
                 ((NodeLayer*)neffectLayer)->SetName(effect->GetAttribute(STR_NAME).ToStdString());
             }
 
-            LoadEffects(neffectLayer, type, effect, effectStrings, colorPalettes);
+            LoadEffects(neffectLayer, type, effect, effectSettings, colorPalettes);
         }
         loaded++;
     }
+    effectLayer->SortEffects();
     return loaded;
 }
 
@@ -733,8 +745,10 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
     wxXmlDocument& seqDocument = xml_file.GetXmlDocument();
 
     wxXmlNode* root = seqDocument.GetRoot();
-    std::vector<std::string> effectStrings;
-    std::vector<std::string> colorPalettes;
+    // EffectDB and ColorPalettes entries are parsed once here and shared (copy on write) by every effect that references them
+    std::vector<SharedSettingsMap> effectSettings;
+    std::vector<SharedSettingsMap> colorPalettes;
+    wxStopWatch sw;
     TraceLog::AddTraceMessage("About to clear sequence");
     Clear();
     TraceLog::AddTraceMessage("   Cleared");
@@ -808,7 +822,7 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
         }
         else if (e->GetName() == "EffectDB")
         {
-            effectStrings.clear();
+            effectSettings.clear();
             for (wxXmlNode* elementNode = e->GetChildren(); elementNode != nullptr; elementNode = elementNode->GetNext())
             {
                 if (elementNode->GetName() == STR_EFFECT)
@@ -822,9 +836,19 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
                         elementNode->SetContent(FixEffectFileParameter("E_TEXTCTRL_Glediator_Filename", elementNode->GetNodeContent(), ShowDir));
                     }
 
-                    effectStrings.push_back(ToStdString(elementNode->GetNodeContent()));
+                    std::string settings = ToStdString(elementNode->GetNodeContent());
+                    if (settings.find("E_FILEPICKER_Pictures_Filename") != std::string::npos) {
+                        settings = FixEffectFileParameter("E_FILEPICKER_Pictures_Filename", settings, "");
+                    }
+                    else if (settings.find("E_FILEPICKER_Glediator_Filename") != std::string::npos) {
+                        settings = FixEffectFileParameter("E_FILEPICKER_Glediator_Filename", settings, "");
+                    }
+                    SettingsMap parsed;
+                    parsed.Parse(settings);
+                    effectSettings.emplace_back(std::move(parsed));
                 }
             }
+            logger_base.debug("Sequencer file: %d EffectDB entries parsed in %ldms.", (int)effectSettings.size(), sw.Time());
         }
         else if (e->GetName() == "ColorPalettes")
         {
@@ -833,9 +857,12 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
             {
                 if (elementNode->GetName() == STR_COLORPALETTE)
                 {
-                    colorPalettes.push_back(ToStdString(elementNode->GetNodeContent()));
+                    SettingsMap parsed;
+                    parsed.Parse(ToStdString(elementNode->GetNodeContent()));
+                    colorPalettes.emplace_back(std::move(parsed));
                 }
             }
+            logger_base.debug("Sequencer file: %d ColorPalettes parsed in %ldms.", (int)colorPalettes.size(), sw.Time());
         }
         else if (e->GetName() == "Jukebox")
         {
@@ -843,22 +870,22 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
         }
         else if (e->GetName() == "ElementEffects")
         {
-            int count = 0;
-            for (wxXmlNode* elementNode = e->GetChildren(); elementNode != NULL; elementNode = elementNode->GetNext())
+            // The layers are created here on this thread but the effects themselves are loaded in parallel, one job per
+            // element. Strands, node layers and submodels all belong to their model element so they stay on the same job.
+            struct LayerToLoad
             {
-                if (elementNode->GetName() == STR_ELEMENT)
-                {
-                    for (wxXmlNode* effectLayerNode = elementNode->GetChildren(); effectLayerNode != nullptr; effectLayerNode = effectLayerNode->GetNext())
-                    {
-                        for (wxXmlNode* effect = effectLayerNode->GetChildren(); effect != nullptr; effect = effect->GetNext())
-                        {
-                            count++;
-                        }
-                    }
-                }
-            }
+                EffectLayer* layer;
+                wxXmlNode* node;
+            };
+            struct ElementToLoad
+            {
+                std::string type;
+                std::vector<LayerToLoad> layers;
+            };
+            std::vector<ElementToLoad> elementsToLoad;
+            std::map<Element*, int> elementJob;
+            long layersStart = sw.Time();
 
-            int loaded = 0;
             for (wxXmlNode* elementNode = e->GetChildren(); elementNode != NULL; elementNode = elementNode->GetNext())
             {
                 if (elementNode->GetName() == STR_ELEMENT)
@@ -938,10 +965,12 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
                                     }
                                 }
                                 if (effectLayer != nullptr) {
-                                    loaded += LoadEffects(effectLayer, elementNode->GetAttribute(STR_TYPE).ToStdString(), effectLayerNode, effectStrings, colorPalettes);
-                                    if (count) {
-                                        GetXLightsFrame()->SetStatusText(wxString::Format("Effects Loaded: %i%%.", loaded * 100 / count));
+                                    auto job = elementJob.find(element);
+                                    if (job == elementJob.end()) {
+                                        job = elementJob.emplace(element, (int)elementsToLoad.size()).first;
+                                        elementsToLoad.push_back({ elementNode->GetAttribute(STR_TYPE).ToStdString(), {} });
                                     }
+                                    elementsToLoad[job->second].layers.push_back({ effectLayer, effectLayerNode });
                                 }
                                 else
                                 {
@@ -956,6 +985,18 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
                     }
                 }
             }
+
+            long effectsStart = sw.Time();
+            std::atomic_int loaded(0);
+            parallel_for(0, elementsToLoad.size(), [this, &elementsToLoad, &loaded, &effectSettings, &colorPalettes](int idx) {
+                const ElementToLoad& el = elementsToLoad[idx];
+                for (const auto& it : el.layers) {
+                    loaded += LoadEffects(it.layer, el.type, it.node, effectSettings, colorPalettes);
+                }
+            });
+            GetXLightsFrame()->SetStatusText(wxString::Format("Effects Loaded: %d.", (int)loaded));
+            logger_base.debug("Sequencer file: layers for %d elements created in %ldms, %d effects loaded in %ldms.",
+                              (int)elementsToLoad.size(), effectsStart - layersStart, (int)loaded, sw.Time() - effectsStart);
         }
         TraceLog::PopTraceContext();
     }
@@ -966,7 +1007,7 @@ bool SequenceElements::LoadSequencerFile(xLightsXmlFile& xml_file, const wxStrin
         }
     }
 
-    logger_base.debug("Sequencer file loaded.");
+    logger_base.debug("Sequencer file loaded in %ldms.", sw.Time());
 
     return true;
 }
@@ -2334,6 +2375,8 @@ void SequenceElements::IncrementChangeCount(Element *el) {
             for (std::set<std::string>::iterator sit = it->second.begin(); sit != it->second.end(); ++sit) {
                 Element *el2 = this->GetElement(*sit);
                 if (el2 != nullptr) {
+                    // saved simulation state of effects driven by the timing track is no longer valid
+                    el2->ClearEffectCheckpoints();
                     el2->IncrementChangeCount(ss, es);
                     modelsToRender.insert(*sit);
                     xframe->StartOutputTimer(); // start the timer so the render will trigger
@@ -17,6 +17,7 @@
 #include <set>
 #include <string>
 #include <mutex>
+#include <atomic>
 #include "wx/xml/xml.h"
 #include "wx/filename.h"
 #include "UndoManager.h"
@@ -212,8 +213,8 @@ private:
     int LoadEffects(EffectLayer *layer,
         const std::string &type,
         wxXmlNode *effectLayerNode,
-        const std::vector<std::string> & effectStrings,
-        const std::vector<std::string> & colorPalettes);
+        const std::vector<SharedSettingsMap> & effectSettings,
+        const std::vector<SharedSettingsMap> & colorPalettes);
     static bool SortElementsByIndex(const Element *element1, const Element *element2)
     {
         return (element1->GetIndex() < element2->GetIndex());
@@ -252,7 +253,7 @@ private:
 
     // mFirstVisibleModelRow=0 is first model row not the row in Row_Information struct.
     int mFirstVisibleModelRow;
-    unsigned int mChangeCount;
+    std::atomic_uint mChangeCount;
     unsigned int mMasterViewChangeCount;
     UndoManager undo_mgr;
 
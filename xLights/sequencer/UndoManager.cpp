@@ -13,75 +13,162 @@
 #include "SequenceElements.h"
 #include <log4cpp/Category.hh>
 
-DeletedEffectInfo::DeletedEffectInfo( const std::string &element_name_, int layer_index_, const std::string &name_, const std::string &settings_,
-                                      const std::string &palette_, int startTimeMS_, int endTimeMS_, int Selected_, bool Protected_ )
-: element_name(element_name_), layer_index(layer_index_), name(name_), settings(settings_),
-  palette(palette_), startTimeMS(startTimeMS_), endTimeMS(endTimeMS_), Selected(Selected_), Protected(Protected_)
+#include <map>
+#include <set>
+#include <tuple>
+
+// default cap on the memory held by each undo manager
+static size_t __undoMemoryLimit = 256 * 1024 * 1024;
+
+#pragma region UndoSettingsDelta
+
+size_t UndoSettingsDelta::GetMemoryUsage() const
 {
+    size_t size = set.capacity() * sizeof(std::pair<std::string, std::string>) + remove.capacity() * sizeof(std::string);
+    for (const auto& it : set) {
+        size += it.first.capacity() + it.second.capacity();
+    }
+    for (const auto& it : remove) {
+        size += it.capacity();
+    }
+    return size;
 }
 
-AddedEffectInfo::AddedEffectInfo( const std::string &element_name_, int layer_index_, int id_ )
-: element_name(element_name_), layer_index(layer_index_), id(id_)
+UndoSettingsDelta UndoSettingsDelta::Diff(const SettingsMap& before, const SettingsMap& after)
 {
+    UndoSettingsDelta delta;
+
+    // both maps are sorted so walk them together
+    auto b = before.begin();
+    auto a = after.begin();
+    while (b != before.end() || a != after.end()) {
+        if (a == after.end() || (b != before.end() && b->first < a->first)) {
+            delta.set.emplace_back(b->first, b->second);
+            ++b;
+        } else if (b == before.end() || a->first < b->first) {
+            delta.remove.push_back(a->first);
+            ++a;
+        } else {
+            if (a->second != b->second) {
+                delta.set.emplace_back(b->first, b->second);
+            }
+            ++a;
+            ++b;
+        }
+    }
+    delta.set.shrink_to_fit();
+    delta.remove.shrink_to_fit();
+    return delta;
 }
 
-MovedEffectInfo::MovedEffectInfo( const std::string &element_name_, int layer_index_, int id_, int startTimeMS_, int endTimeMS_ )
-: element_name(element_name_), layer_index(layer_index_), id(id_), startTimeMS(startTimeMS_), endTimeMS(endTimeMS_)
+UndoSettingsDelta UndoSettingsDelta::Apply(SettingsMap& map) const
 {
+    UndoSettingsDelta reverse;
+    for (const auto& it : set) {
+        auto current = map.find(it.first);
+        if (current == map.end()) {
+            reverse.remove.push_back(it.first);
+            map[it.first] = it.second;
+        } else {
+            reverse.set.emplace_back(it.first, current->second);
+            current->second = it.second;
+        }
+    }
+    for (const auto& it : remove) {
+        auto current = map.find(it);
+        if (current != map.end()) {
+            reverse.set.emplace_back(it, current->second);
+            map.erase(current);
+        }
+    }
+    return reverse;
 }
 
-ModifiedEffectInfo::ModifiedEffectInfo( const std::string &element_name_, int layer_index_, int id_, const std::string &settings_, const std::string &palette_ )
-: element_name(element_name_), layer_index(layer_index_), id(id_), settings(settings_), palette(palette_), effectName(""), effectType(-1)
+#pragma endregion
+
+#pragma region UndoRecord and UndoGroup
+
+size_t UndoRecord::GetMemoryUsage() const
 {
+    return sizeof(UndoRecord) + name.capacity() + settings.capacity() + palette.capacity() +
+           settingsDelta.GetMemoryUsage() + paletteDelta.GetMemoryUsage();
 }
 
+uint32_t UndoGroup::InternElement(const std::string& element_name)
+{
+    // bulk changes tend to capture runs of effects on the same element
+    if (!elementNames.empty() && elementNames.back() == element_name) {
+        return (uint32_t)elementNames.size() - 1;
+    }
+    auto it = _elementIndex.find(element_name);
+    if (it != _elementIndex.end()) {
+        return it->second;
+    }
+    uint32_t index = (uint32_t)elementNames.size();
+    elementNames.push_back(element_name);
+    _elementIndex[element_name] = index;
+    memoryUsage += sizeof(std::string) + element_name.capacity();
+    return index;
+}
 
-ModifiedEffectInfo::ModifiedEffectInfo( const std::string &element_name_, int layer_index_, Effect *ef)
-: element_name(element_name_), layer_index(layer_index_), id(ef->GetID()),
-    settings(ef->GetSettingsAsString()), palette(ef->GetPaletteAsString()), effectName(ef->GetEffectName()), effectType(ef->GetEffectIndex())
+UndoRecord& UndoGroup::Add(UNDO_ACTIONS action, uint32_t element, int layer_index)
 {
+    sealed = false;
+    records.emplace_back();
+    UndoRecord& record = records.back();
+    record.action = action;
+    record.element = element;
+    record.layer_index = layer_index;
+    return record;
 }
 
-UndoStep::UndoStep( UNDO_ACTIONS action )
-: undo_action(action)
+UndoRecord& UndoGroup::Add(UNDO_ACTIONS action, const std::string& element_name, int layer_index)
 {
+    return Add(action, InternElement(element_name), layer_index);
 }
 
-UndoStep::UndoStep( UNDO_ACTIONS action, DeletedEffectInfo* effect_info )
-: undo_action(action)
+void UndoGroup::UpdateMemoryUsage()
 {
-    deleted_effect_info.push_back(effect_info);
+    memoryUsage = elementNames.capacity() * sizeof(std::string);
+    for (const auto& it : elementNames) {
+        memoryUsage += it.capacity();
+    }
+    for (const auto& it : records) {
+        memoryUsage += it.GetMemoryUsage();
+    }
 }
 
-UndoStep::UndoStep( UNDO_ACTIONS action, AddedEffectInfo* effect_info )
-: undo_action(action)
+#pragma endregion
+
+UndoManager::UndoManager(SequenceElements* parent)
+: mParentSequence(parent), mCaptureUndo(false)
 {
-    added_effect_info.push_back(effect_info);
 }
 
-UndoStep::UndoStep( UNDO_ACTIONS action, MovedEffectInfo* effect_info )
-: undo_action(action)
+UndoManager::~UndoManager()
 {
-    moved_effect_info.push_back(effect_info);
 }
 
-UndoStep::UndoStep( UNDO_ACTIONS action, ModifiedEffectInfo* effect_info )
-: undo_action(action)
+void UndoManager::SetMemoryLimit(size_t bytes)
 {
-    modified_effect_info.push_back(effect_info);
+    __undoMemoryLimit = bytes;
 }
 
-UndoManager::UndoManager(SequenceElements* parent)
-: mParentSequence(parent), mCaptureUndo(false)
+size_t UndoManager::GetMemoryLimit()
 {
+    return __undoMemoryLimit;
 }
 
-UndoManager::~UndoManager()
+size_t UndoManager::GetMemoryUsage() const
 {
-    for( size_t i = 0; i < mUndoSteps.size(); i++ )
-    {
-        delete mUndoSteps[i];
+    size_t usage = 0;
+    for (const auto& it : mUndoSteps) {
+        usage += it.memoryUsage;
+    }
+    for (const auto& it : mRedoSteps) {
+        usage += it.memoryUsage;
     }
+    return usage;
 }
 
 void UndoManager::SetCaptureUndo( bool value )
@@ -91,45 +178,24 @@ void UndoManager::SetCaptureUndo( bool value )
 
 void UndoManager::RemoveUnusedMarkers()
 {
-    if( mUndoSteps.size() > 0 )
+    // delete any marker stragglers
+    if (mUndoSteps.size() > 0 && mUndoSteps.back().records.empty())
     {
-        UndoStep* last_action = mUndoSteps.back();
-        // delete any marker stragglers
-        if( last_action->undo_action == UNDO_MARKER )
-        {
-            mUndoSteps.pop_back();
-        }
+        mUndoSteps.pop_back();
     }
 }
 
 bool UndoManager::ChangeCaptured()
 {
-    if( mUndoSteps.size() > 0 )
-    {
-        UndoStep* last_action = mUndoSteps.back();
-        if( last_action->undo_action != UNDO_MARKER )
-        {
-            return true;
-        }
-    }
-    return false;
+    return mUndoSteps.size() > 0 && !mUndoSteps.back().records.empty();
 }
 
 void UndoManager::Clear() {
-    RemoveUnusedMarkers();
-    for (size_t i = 0; i < mUndoSteps.size(); i++)
-    {
-        delete mUndoSteps[i];
-    }
     mUndoSteps.clear();
     ClearRedo();
 }
 
 void UndoManager::ClearRedo() {
-    for (size_t i = 0; i < mRedoSteps.size(); i++)
-    {
-        delete mRedoSteps[i];
-    }
     mRedoSteps.clear();
 }
 
@@ -148,246 +214,387 @@ void UndoManager::CreateUndoStep()
 {
     ClearRedo();
     RemoveUnusedMarkers();
-    UndoStep* action = new UndoStep(UNDO_MARKER);
-    mUndoSteps.push_back(action);
+    if (mUndoSteps.size() > 0)
+    {
+        SealGroup(mUndoSteps.back());
+        EnforceMemoryLimit();
+    }
+    mUndoSteps.emplace_back();
+}
+
+UndoGroup& UndoManager::CurrentGroup()
+{
+    if (mUndoSteps.empty())
+    {
+        mUndoSteps.emplace_back();
+    }
+    return mUndoSteps.back();
 }
 
 void UndoManager::CaptureEffectToBeDeleted( const std::string &element_name, int layer_index, const std::string &name, const std::string &settings,
                                             const std::string &palette, int startTimeMS, int endTimeMS, int Selected, bool Protected )
 {
-    DeletedEffectInfo* effect_undo_action = new DeletedEffectInfo( element_name, layer_index, name, settings, palette, startTimeMS, endTimeMS, Selected, Protected );
-    UndoStep* action = new UndoStep(UNDO_EFFECT_DELETED, effect_undo_action);
-    mUndoSteps.push_back(action);
+    UndoGroup& group = CurrentGroup();
+    UndoRecord& record = group.Add(UNDO_EFFECT_DELETED, element_name, layer_index);
+    record.name = name;
+    record.settings = settings;
+    record.palette = palette;
+    record.startTimeMS = startTimeMS;
+    record.endTimeMS = endTimeMS;
+    record.selected = Selected;
+    record.isProtected = Protected;
+    group.memoryUsage += record.GetMemoryUsage();
 }
 
 void UndoManager::CaptureAddedEffect( const std::string &element_name, int layer_index, int id )
 {
-    AddedEffectInfo* effect_undo_action = new AddedEffectInfo( element_name, layer_index, id );
-    UndoStep* action = new UndoStep(UNDO_EFFECT_ADDED, effect_undo_action);
-    mUndoSteps.push_back(action);
+    UndoGroup& group = CurrentGroup();
+    UndoRecord& record = group.Add(UNDO_EFFECT_ADDED, element_name, layer_index);
+    record.id = id;
+    group.memoryUsage += record.GetMemoryUsage();
 }
 
 void UndoManager::CaptureEffectToBeMoved( const std::string &element_name, int layer_index, int id, int startTimeMS, int endTimeMS )
 {
-    MovedEffectInfo* effect_undo_action = new MovedEffectInfo( element_name, layer_index, id, startTimeMS, endTimeMS );
-    UndoStep* action = new UndoStep(UNDO_EFFECT_MOVED, effect_undo_action);
-    mUndoSteps.push_back(action);
+    UndoGroup& group = CurrentGroup();
+    UndoRecord& record = group.Add(UNDO_EFFECT_MOVED, element_name, layer_index);
+    record.id = id;
+    record.startTimeMS = startTimeMS;
+    record.endTimeMS = endTimeMS;
+    group.memoryUsage += record.GetMemoryUsage();
 }
 
 void UndoManager::CaptureModifiedEffect( const std::string &element_name, int layer_index, int id, const std::string &settings, const std::string &palette )
 {
-    ModifiedEffectInfo* effect_undo_action = new ModifiedEffectInfo( element_name, layer_index, id, settings, palette );
-    UndoStep* action = new UndoStep(UNDO_EFFECT_MODIFIED, effect_undo_action);
-    mUndoSteps.push_back(action);
+    UndoGroup& group = CurrentGroup();
+    UndoRecord& record = group.Add(UNDO_EFFECT_MODIFIED, element_name, layer_index);
+    record.id = id;
+    record.settings = settings;
+    record.palette = palette;
+    group.memoryUsage += record.GetMemoryUsage();
 }
 
 void UndoManager::CaptureModifiedEffect( const std::string &element_name, int layer_index, Effect *ef )
 {
-    ModifiedEffectInfo* effect_undo_action = new ModifiedEffectInfo( element_name, layer_index, ef );
-    UndoStep* action = new UndoStep(UNDO_EFFECT_MODIFIED, effect_undo_action);
-    mUndoSteps.push_back(action);
+    UndoGroup& group = CurrentGroup();
+    UndoRecord& record = group.Add(UNDO_EFFECT_MODIFIED, element_name, layer_index);
+    record.id = ef->GetID();
+    record.name = ef->GetEffectName();
+    record.effectType = ef->GetEffectIndex();
+    record.settings = ef->GetSettingsAsString();
+    record.palette = ef->GetPaletteAsString();
+    group.memoryUsage += record.GetMemoryUsage();
+}
+
+Element* UndoManager::GetElement(UndoGroup& group, std::vector<Element*>& cache, uint32_t element)
+{
+    if (cache.size() < group.elementNames.size())
+    {
+        cache.resize(group.elementNames.size(), nullptr);
+    }
+    if (cache[element] == nullptr)
+    {
+        cache[element] = mParentSequence->GetElement(group.elementNames[element]);
+    }
+    return cache[element];
+}
+
+Effect* UndoManager::FindEffect(EffectLayer* el, int id)
+{
+    // effects are numbered by their position so look there before searching
+    Effect* eff = el->GetEffect(id);
+    if (eff != nullptr && eff->GetID() == id)
+    {
+        return eff;
+    }
+    return el->GetEffectFromID(id);
+}
+
+// Once a user action is complete the settings captured for modified effects are replaced by just the
+// keys that changed. Records are walked newest first so an effect modified more than once is compared
+// with the state the following record found it in, the newest with the effect as it is now. Once an
+// effect has been added, deleted or moved on a layer the ids captured before that may no longer match
+// the layer so those records keep their full settings.
+void UndoManager::SealGroup(UndoGroup& group)
+{
+    if (group.sealed) return;
+
+    std::vector<Element*> elements;
+    std::set<std::pair<uint32_t, int>> restructured;
+    std::map<std::tuple<uint32_t, int, int>, std::pair<SettingsMap, SettingsMap>> after;
+
+    for (auto it = group.records.rbegin(); it != group.records.rend(); ++it)
+    {
+        UndoRecord& record = *it;
+        auto layer = std::make_pair(record.element, record.layer_index);
+
+        if (record.action != UNDO_EFFECT_MODIFIED || record.isDelta)
+        {
+            restructured.insert(layer);
+            continue;
+        }
+        if (restructured.find(layer) != restructured.end()) continue;
+
+        SettingsMap settings;
+        settings.Parse(record.settings);
+        SettingsMap palette;
+        palette.Parse(record.palette);
+
+        auto key = std::make_tuple(record.element, record.layer_index, record.id);
+        auto later = after.find(key);
+        if (later != after.end())
+        {
+            record.settingsDelta = UndoSettingsDelta::Diff(settings, later->second.first);
+            record.paletteDelta = UndoSettingsDelta::Diff(palette, later->second.second);
+            later->second = std::make_pair(std::move(settings), std::move(palette));
+        }
+        else
+        {
+            Element* element = GetElement(group, elements, record.element);
+            if (element == nullptr) continue;
+            EffectLayer* el = element->GetEffectLayerFromExclusiveIndex(record.layer_index);
+            if (el == nullptr) continue;
+            // const so reading the settings doesn't take a private copy of them
+            const Effect* eff = FindEffect(el, record.id);
+            if (eff == nullptr) continue;
+
+            record.settingsDelta = UndoSettingsDelta::Diff(settings, eff->GetSettings());
+            record.paletteDelta = UndoSettingsDelta::Diff(palette, eff->GetPaletteMap());
+            after.emplace(key, std::make_pair(std::move(settings), std::move(palette)));
+        }
+        record.isDelta = true;
+        std::string().swap(record.settings);
+        std::string().swap(record.palette);
+    }
+
+    group.records.shrink_to_fit();
+    group.ReleaseIndex();
+    group.UpdateMemoryUsage();
+    group.sealed = true;
+}
+
+void UndoManager::EnforceMemoryLimit()
+{
+    static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    size_t usage = GetMemoryUsage();
+    size_t dropped = 0;
+    while (usage > __undoMemoryLimit && mUndoSteps.size() > 1)
+    {
+        usage -= mUndoSteps.front().memoryUsage;
+        mUndoSteps.pop_front();
+        ++dropped;
+    }
+    if (dropped > 0)
+    {
+        logger_base.debug("UndoManager discarded the oldest %d undo steps to stay under %dMB, %d steps holding %dKB remain.",
+                          (int)dropped, (int)(__undoMemoryLimit / (1024 * 1024)), (int)mUndoSteps.size(), (int)(usage / 1024));
+    }
 }
 
 void UndoManager::UndoLastStep()
 {
-    UndoStep* action = new UndoStep(UNDO_MARKER);
-    mRedoSteps.push_back(action);
     ProcessUndoStep(mUndoSteps, mRedoSteps);
 }
 
 void UndoManager::RedoLastStep()
 {
-    UndoStep* action = new UndoStep(UNDO_MARKER);
-    mUndoSteps.push_back(action);
     ProcessUndoStep(mRedoSteps, mUndoSteps);
+    EnforceMemoryLimit();
 }
 
-void UndoManager::ProcessUndoStep(std::vector<UndoStep*> &fromList, std::vector<UndoStep*> &toList)
+// Each record is reversed newest first and its opposite is captured into a group on the other list.
+// Deleted effects are put back without sorting their layer each time, the layer is only sorted when a
+// later record needs to find an effect on it by id, or at the end.
+void UndoManager::ProcessUndoStep(std::deque<UndoGroup> &fromList, std::deque<UndoGroup> &toList)
 {
     static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
-    bool done = false;
-    while (fromList.size() > 0 && !done)
+
+    if (fromList.empty()) return;
+
+    UndoGroup& from = fromList.back();
+    SealGroup(from);
+
+    toList.emplace_back();
+    UndoGroup& to = toList.back();
+    to.elementNames = from.elementNames;
+
+    std::vector<Element*> elements;
+
+    // layers with effects added back but not sorted yet, and the records of those effects in the order they were added
+    std::map<EffectLayer*, std::vector<std::pair<size_t, Effect*>>> unsorted;
+    auto sortLayer = [&unsorted, &to](EffectLayer* el) {
+        auto it = unsorted.find(el);
+        if (it == unsorted.end()) return;
+        el->SortEffects();
+
+        // Each effect's id needs to be the one it would have had if the layer had been sorted as it
+        // was added, ie its position less any effects added after it that sorted in front of it.
+        // Going backwards through them with a fenwick tree of positions taken counts those.
+        std::vector<int> tree(el->GetEffectCount() + 1, 0);
+        for (auto added = it->second.rbegin(); added != it->second.rend(); ++added) {
+            int pos = added->second->GetID();
+            int before = 0;
+            for (int i = pos; i > 0; i -= i & -i) {
+                before += tree[i];
+            }
+            to.records[added->first].id = pos - before;
+            for (int i = pos + 1; i < (int)tree.size(); i += i & -i) {
+                tree[i]++;
+            }
+        }
+        unsorted.erase(it);
+    };
+
+    for (auto it = from.records.rbegin(); it != from.records.rend(); ++it)
     {
-        UndoStep* next_action = fromList.back();
-        switch (next_action->undo_action)
+        const UndoRecord& record = *it;
+
+        Element* element = GetElement(from, elements, record.element);
+        if (element == nullptr)
+        {
+            logger_base.warn("UndoManager::ProcessUndoStep element not found %s.", (const char*)from.elementNames[record.element].c_str());
+            continue;
+        }
+        EffectLayer* el = element->GetEffectLayerFromExclusiveIndex(record.layer_index);
+        if (el == nullptr)
+        {
+            logger_base.warn("UndoManager::ProcessUndoStep layer not found %d.", record.layer_index);
+            continue;
+        }
+
+        switch (record.action)
         {
         case UNDO_MARKER:
-            done = true;
             break;
         case UNDO_EFFECT_DELETED:
         {
-            if (next_action->deleted_effect_info.size() == 0) {
-                logger_base.crit("UndoManager::ProcessUndoStep about to access past end of array. This wont end well. XXX");
-            }
-            Element* element = mParentSequence->GetElement(next_action->deleted_effect_info[0]->element_name);
-            if (element != nullptr)
+            Effect* eff = el->AddEffect(0, record.name, record.settings, record.palette,
+                                        record.startTimeMS, record.endTimeMS, record.selected, record.isProtected, true);
+            if (eff != nullptr)
             {
-                EffectLayer* el = element->GetEffectLayerFromExclusiveIndex(next_action->deleted_effect_info[0]->layer_index);
-                if (el != nullptr)
-                {
-                    Effect* eff = el->AddEffect(0,
-                        next_action->deleted_effect_info[0]->name,
-                        next_action->deleted_effect_info[0]->settings,
-                        next_action->deleted_effect_info[0]->palette,
-                        next_action->deleted_effect_info[0]->startTimeMS,
-                        next_action->deleted_effect_info[0]->endTimeMS,
-                        next_action->deleted_effect_info[0]->Selected,
-                        next_action->deleted_effect_info[0]->Protected);
-
-                    // Move effect to other list
-                    AddedEffectInfo* effect_undo_action = new AddedEffectInfo(el->GetParentElement()->GetModelName(), el->GetIndex(), eff->GetID());
-                    UndoStep* action = new UndoStep(UNDO_EFFECT_ADDED, effect_undo_action);
-                    toList.push_back(action);
-                }
+                to.Add(UNDO_EFFECT_ADDED, record.element, el->GetIndex());
+                unsorted[el].emplace_back(to.records.size() - 1, eff);
             }
         }
         break;
         case UNDO_EFFECT_ADDED:
         {
-            if (next_action->added_effect_info.size() == 0) {
-                logger_base.crit("UndoManager::ProcessUndoStep about to access past end of array. This wont end well. AAA");
-            }
-            Element* element = mParentSequence->GetElement(next_action->added_effect_info[0]->element_name);
-            if (element != nullptr)
+            sortLayer(el);
+            Effect* eff = FindEffect(el, record.id);
+            if (eff == nullptr)
             {
-                EffectLayer* el = element->GetEffectLayerFromExclusiveIndex(next_action->added_effect_info[0]->layer_index);
-                if (el != nullptr)
-                {
-                    // Move effect to other list
-                    Effect* eff = el->GetEffectFromID(next_action->added_effect_info[0]->id);
-                    DeletedEffectInfo* effect_undo_action = new DeletedEffectInfo(el->GetParentElement()->GetModelName(), el->GetIndex(), eff->GetEffectName(), eff->GetSettingsAsString(), eff->GetPaletteAsString(), eff->GetStartTimeMS(), eff->GetEndTimeMS(), EFFECT_NOT_SELECTED, false);
-                    UndoStep* action = new UndoStep(UNDO_EFFECT_DELETED, effect_undo_action);
-                    toList.push_back(action);
-
-                    // Delete the effect
-                    el->DeleteEffect(next_action->added_effect_info[0]->id);
-                }
+                logger_base.warn("UndoManager::ProcessUndoStep added effect not found %d.", record.id);
+                break;
             }
+            UndoRecord& deleted = to.Add(UNDO_EFFECT_DELETED, record.element, el->GetIndex());
+            deleted.name = eff->GetEffectName();
+            deleted.settings = eff->GetSettingsAsString();
+            deleted.palette = eff->GetPaletteAsString();
+            deleted.startTimeMS = eff->GetStartTimeMS();
+            deleted.endTimeMS = eff->GetEndTimeMS();
+            deleted.selected = EFFECT_NOT_SELECTED;
+            deleted.isProtected = false;
+
+            el->DeleteEffect(eff->GetID());
         }
         break;
         case UNDO_EFFECT_MOVED:
         {
-            if (next_action->moved_effect_info.size() == 0) {
-                logger_base.crit("UndoManager::ProcessUndoStep about to access past end of array. This wont end well. BBB");
-            }
-            Element* element = mParentSequence->GetElement(next_action->moved_effect_info[0]->element_name);
-            if (element != nullptr)
-            {
-                EffectLayer* el = element->GetEffectLayerFromExclusiveIndex(next_action->moved_effect_info[0]->layer_index);
-                if (el == nullptr)
-                {
-                    logger_base.warn("UndoLastStep:UNDO_EFFECT_MOVED Element not found %d.", next_action->moved_effect_info[0]->layer_index);
-                }
-                else
-                {
-                    Effect* eff = el->GetEffectFromID(next_action->moved_effect_info[0]->id);
-                    if (eff != nullptr)
-                    {
-                        // Capture for other list
-                        MovedEffectInfo* effect_undo_action = new MovedEffectInfo(el->GetParentElement()->GetModelName(), el->GetIndex(), eff->GetID(), eff->GetStartTimeMS(), eff->GetEndTimeMS());
-                        UndoStep* action = new UndoStep(UNDO_EFFECT_MOVED, effect_undo_action);
-                        toList.push_back(action);
-
-                        // Move the effect
-                        eff->SetStartTimeMS(next_action->moved_effect_info[0]->startTimeMS);
-                        eff->SetEndTimeMS(next_action->moved_effect_info[0]->endTimeMS);
-                    }
-                }
-            }
+            sortLayer(el);
+            Effect* eff = FindEffect(el, record.id);
+            if (eff == nullptr) break;
+
+            UndoRecord& moved = to.Add(UNDO_EFFECT_MOVED, record.element, el->GetIndex());
+            moved.id = eff->GetID();
+            moved.startTimeMS = eff->GetStartTimeMS();
+            moved.endTimeMS = eff->GetEndTimeMS();
+
+            eff->SetStartTimeMS(record.startTimeMS);
+            eff->SetEndTimeMS(record.endTimeMS);
         }
         break;
         case UNDO_EFFECT_MODIFIED:
         {
-            if (next_action->modified_effect_info.size() == 0) {
-                logger_base.crit("UndoManager::ProcessUndoStep about to access past end of array. This wont end well. CCC");
+            sortLayer(el);
+            Effect* eff = FindEffect(el, record.id);
+            if (eff == nullptr) break;
+
+            UndoRecord& modified = to.Add(UNDO_EFFECT_MODIFIED, record.element, el->GetIndex());
+            modified.id = eff->GetID();
+            modified.name = eff->GetEffectName();
+            modified.effectType = eff->GetEffectIndex();
+
+            if (record.effectType >= 0) {
+                eff->SetEffectName(record.name);
+                eff->SetEffectIndex(record.effectType);
             }
-            Element* element = mParentSequence->GetElement(next_action->modified_effect_info[0]->element_name);
-            if (element != nullptr)
+            if (record.isDelta)
             {
-                EffectLayer* el = element->GetEffectLayerFromExclusiveIndex(next_action->modified_effect_info[0]->layer_index);
-                if (el == nullptr)
+                // the reverse of a delta is the delta of the keys it touches
+                const Effect* ceff = eff;
+                modified.isDelta = true;
+                if (!record.settingsDelta.empty())
                 {
-                    logger_base.warn("UndoLastStep:UNDO_EFFECT_MODIFIED Element not found %d.", next_action->modified_effect_info[0]->layer_index);
+                    SettingsMap settings = ceff->GetSettings();
+                    modified.settingsDelta = record.settingsDelta.Apply(settings);
+                    eff->SetSettingsMap(std::move(settings));
                 }
-                else
+                if (!record.paletteDelta.empty())
                 {
-                    Effect* eff = el->GetEffectFromID(next_action->modified_effect_info[0]->id);
-                    if (eff != nullptr)
-                    {
-                        // Capture for other list
-                        ModifiedEffectInfo* effect_undo_action = new ModifiedEffectInfo(el->GetParentElement()->GetModelName(), el->GetIndex(), eff);
-                        UndoStep* action = new UndoStep(UNDO_EFFECT_MODIFIED, effect_undo_action);
-                        toList.push_back(action);
-
-                        // Modify the effect
-                        if (next_action->modified_effect_info[0]->effectType >= 0) {
-                            eff->SetEffectName(next_action->modified_effect_info[0]->effectName);
-                            eff->SetEffectIndex(next_action->modified_effect_info[0]->effectType);
-                        }
-                        eff->SetSettings(next_action->modified_effect_info[0]->settings, false);
-                        eff->SetPalette(next_action->modified_effect_info[0]->palette);
-                    }
+                    SettingsMap palette = ceff->GetPaletteMap();
+                    modified.paletteDelta = record.paletteDelta.Apply(palette);
+                    eff->SetPaletteMap(std::move(palette));
                 }
             }
+            else
+            {
+                modified.settings = eff->GetSettingsAsString();
+                modified.palette = eff->GetPaletteAsString();
+                eff->SetSettings(record.settings, false);
+                eff->SetPalette(record.palette);
+            }
         }
         break;
         }
-        fromList.pop_back();
     }
+    while (!unsorted.empty())
+    {
+        sortLayer(unsorted.begin()->first);
+    }
+
+    to.UpdateMemoryUsage();
+    to.sealed = true;
+    fromList.pop_back();
 }
 
-std::string UndoManager::GetUndoString()
+std::string UndoManager::GetStepString(const std::deque<UndoGroup>& steps, const std::string& prefix)
 {
-    std::string undo_string = "Undo";
-
-    if (mUndoSteps.size() > 0)
+    if (steps.size() > 0 && steps.back().records.size() > 0)
     {
-        UndoStep* next_action = mUndoSteps.back();
-        switch (next_action->undo_action)
+        switch (steps.back().records.back().action)
         {
         case UNDO_EFFECT_DELETED:
-            undo_string = "Undo: Effect(s) Deleted";
-            break;
+            return prefix + ": Effect(s) Deleted";
         case UNDO_EFFECT_ADDED:
-            undo_string = "Undo: Effect(s) Added";
-            break;
+            return prefix + ": Effect(s) Added";
         case UNDO_EFFECT_MOVED:
-            undo_string = "Undo: Effect(s) Moved";
-            break;
+            return prefix + ": Effect(s) Moved";
         case UNDO_EFFECT_MODIFIED:
-            undo_string = "Undo: Effect(s) Modified";
-            break;
+            return prefix + ": Effect(s) Modified";
         case UNDO_MARKER:
             break;
         }
     }
-    return undo_string;
+    return prefix;
 }
 
-std::string UndoManager::GetRedoString()
+std::string UndoManager::GetUndoString()
 {
-    std::string redo_string = "Redo";
+    return GetStepString(mUndoSteps, "Undo");
+}
 
-    if (mRedoSteps.size() > 0)
-    {
-        UndoStep* next_action = mRedoSteps.back();
-        switch (next_action->undo_action)
-        {
-        case UNDO_EFFECT_DELETED:
-            redo_string = "Redo: Effect(s) Deleted";
-            break;
-        case UNDO_EFFECT_ADDED:
-            redo_string = "Redo: Effect(s) Added";
-            break;
-        case UNDO_EFFECT_MOVED:
-            redo_string = "Redo: Effect(s) Moved";
-            break;
-        case UNDO_EFFECT_MODIFIED:
-            redo_string = "Redo: Effect(s) Modified";
-            break;
-        case UNDO_MARKER:
-            break;
-        }
-    }
-    return redo_string;
+std::string UndoManager::GetRedoString()
+{
+    return GetStepString(mRedoSteps, "Redo");
 }
@@ -11,10 +11,17 @@
  **************************************************************/
 
 #include "wx/wx.h"
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 class SequenceElements;
+class SettingsMap;
 class Effect;
+class EffectLayer;
+class Element;
 
 enum UNDO_ACTIONS
 {
@@ -25,71 +32,69 @@ enum UNDO_ACTIONS
     UNDO_EFFECT_MOVED
 };
 
-class DeletedEffectInfo
+// The keys of a settings map to put back ... the old values of changed or removed keys and the
+// names of keys that were added
+class UndoSettingsDelta
 {
 public:
-    std::string element_name;
-    int layer_index;
-    std::string name;
-    std::string settings;
-    std::string palette;
-    int startTimeMS;
-    int endTimeMS;
-    int Selected;
-    bool Protected;
-    DeletedEffectInfo( const std::string &element_name_, int layer_index_, const std::string &name_, const std::string &settings_,
-                       const std::string &palette_, int startTimeMS_, int endTimeMS_, int Selected_, bool Protected_ );
-};
+    std::vector<std::pair<std::string, std::string>> set;
+    std::vector<std::string> remove;
 
-class AddedEffectInfo
-{
-public:
-    std::string element_name;
-    int layer_index;
-    int id;
-    AddedEffectInfo( const std::string &element_name_, int layer_index_, int id_ );
-};
+    bool empty() const { return set.empty() && remove.empty(); }
+    size_t GetMemoryUsage() const;
 
-class MovedEffectInfo
-{
-public:
-    std::string element_name;
-    int layer_index;
-    int id;
-    int startTimeMS;
-    int endTimeMS;
-    MovedEffectInfo( const std::string &element_name_, int layer_index_, int id_, int startTimeMS_, int endTimeMS_ );
+    // the changes that take after back to before
+    static UndoSettingsDelta Diff(const SettingsMap& before, const SettingsMap& after);
+    // applies the delta to map and returns the delta that would reverse it
+    UndoSettingsDelta Apply(SettingsMap& map) const;
 };
 
-class ModifiedEffectInfo
+// One captured change to one effect. Which fields are used depends on the action
+//    added    - id
+//    deleted  - name, settings, palette, times, selected, protected
+//    moved    - id, times
+//    modified - id, settings and palette as strings when captured, then once the user action is
+//               complete replaced by deltas against the effect as it was left, effectType >= 0 if
+//               the effect type needs to be restored too
+class UndoRecord
 {
 public:
-    std::string element_name;
-    int layer_index;
-    int id;
+    UNDO_ACTIONS action = UNDO_MARKER;
+    bool isDelta = false;
+    bool isProtected = false;
+    short effectType = -1;
+    uint32_t element = 0;   // index into the group's element names
+    int layer_index = 0;
+    int id = 0;
+    int startTimeMS = 0;
+    int endTimeMS = 0;
+    int selected = 0;
+    std::string name;
     std::string settings;
     std::string palette;
-    std::string effectName;
-    int effectType;
-    
-    ModifiedEffectInfo( const std::string &element_name_, int layer_index_, int id_, const std::string &settings_, const std::string &palette_ );
-    ModifiedEffectInfo( const std::string &element_name_, int layer_index_, Effect *ef);
+    UndoSettingsDelta settingsDelta;
+    UndoSettingsDelta paletteDelta;
+
+    size_t GetMemoryUsage() const;
 };
 
-class UndoStep
+// Everything captured for one user action, undone or redone together
+class UndoGroup
 {
 public:
-    explicit UndoStep( UNDO_ACTIONS action );
-    UndoStep( UNDO_ACTIONS action, DeletedEffectInfo* effect_info );
-    UndoStep( UNDO_ACTIONS action, AddedEffectInfo* effect_info );
-    UndoStep( UNDO_ACTIONS action, MovedEffectInfo* effect_info );
-    UndoStep( UNDO_ACTIONS action, ModifiedEffectInfo* effect_info );
-
-    UNDO_ACTIONS undo_action;
-    std::vector<DeletedEffectInfo*> deleted_effect_info;
-    std::vector<AddedEffectInfo*> added_effect_info;
-    std::vector<MovedEffectInfo*> moved_effect_info;
-    std::vector<ModifiedEffectInfo*> modified_effect_info;
+    std::vector<std::string> elementNames;
+    std::vector<UndoRecord> records;
+    bool sealed = false;
+    size_t memoryUsage = 0;
+
+    uint32_t InternElement(const std::string& element_name);
+    UndoRecord& Add(UNDO_ACTIONS action, const std::string& element_name, int layer_index);
+    UndoRecord& Add(UNDO_ACTIONS action, uint32_t element, int layer_index);
+    void ReleaseIndex() { _elementIndex.clear(); }
+    void UpdateMemoryUsage();
+
+private:
+    std::unordered_map<std::string, uint32_t> _elementIndex;
 };
 
 class UndoManager
@@ -97,7 +102,7 @@ class UndoManager
     public:
         explicit UndoManager(SequenceElements* parent);
         virtual ~UndoManager();
-    
+
         void Clear();
         void ClearRedo();
         void RemoveUnusedMarkers();
@@ -120,13 +125,25 @@ class UndoManager
         void CaptureEffectToBeMoved( const std::string &element_name, int layer_index, int id, int startTimeMS, int endTimeMS );
         void CaptureModifiedEffect( const std::string &element_name, int layer_index, int id, const std::string &settings, const std::string &palette );
         void CaptureModifiedEffect( const std::string &element_name, int layer_index, Effect *ef);
+
+        // Once the undo history grows past this the oldest steps are discarded. Applies to every undo manager.
+        static void SetMemoryLimit(size_t bytes);
+        static size_t GetMemoryLimit();
+        size_t GetMemoryUsage() const;
+
     protected:
-        void ProcessUndoStep(std::vector<UndoStep*> &fromList, std::vector<UndoStep*> &toList);
+        void ProcessUndoStep(std::deque<UndoGroup> &fromList, std::deque<UndoGroup> &toList);
 
     private:
-        std::vector<UndoStep*> mUndoSteps;
-        std::vector<UndoStep*> mRedoSteps;
+        UndoGroup& CurrentGroup();
+        void SealGroup(UndoGroup& group);
+        void EnforceMemoryLimit();
+        Element* GetElement(UndoGroup& group, std::vector<Element*>& cache, uint32_t element);
+        static Effect* FindEffect(EffectLayer* el, int id);
+        static std::string GetStepString(const std::deque<UndoGroup>& steps, const std::string& prefix);
+
+        std::deque<UndoGroup> mUndoSteps;
+        std::deque<UndoGroup> mRedoSteps;
         SequenceElements* mParentSequence;
         bool mCaptureUndo;
-
 };
@@ -2347,6 +2347,15 @@ bool xLightsFrame::TimerRgbSeq(long msec)
     
     RecordTimingCheckpoint();
     int frame = curt / _seqData.FrameTime();
+    if (_seqData.IsFileBacked()) {
+        // keep a couple of seconds ahead of playback paged in so we don't stall on disk reads
+        static int prefetchedTo = -1;
+        int ahead = 1000 / _seqData.FrameTime();
+        if (frame >= prefetchedTo || frame + 2 * ahead < prefetchedTo) {
+            _seqData.PrefetchFrames(frame, frame + 2 * ahead);
+            prefetchedTo = frame + ahead;
+        }
+    }
     if (frame < _seqData.NumFrames()) {
         //have the frame, copy from SeqData
         TimerOutput(frame);
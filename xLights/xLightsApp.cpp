@@ -464,6 +464,7 @@ bool xLightsApp::OnInit()
         { wxCMD_LINE_SWITCH, "h", "help", "displays help on the command line parameters", wxCMD_LINE_VAL_NONE, wxCMD_LINE_OPTION_HELP },
         { wxCMD_LINE_SWITCH, "r", "render", "render files and exit"},
         { wxCMD_LINE_SWITCH, "cs", "checksequence", "run check sequence and exit"},
+        { wxCMD_LINE_OPTION, "ev", "exportvideo", "with render, also export a house preview video of each sequence to this directory" },
         { wxCMD_LINE_OPTION, "m", "media", "specify media directory"},
         { wxCMD_LINE_OPTION, "s", "show", "specify show directory" },
         { wxCMD_LINE_OPTION, "g", "opengl", "specify OpenGL version" },
@@ -629,6 +630,11 @@ bool xLightsApp::OnInit()
     if (parser.Found("r")) {
         logger_base.info("-r: Render mode is ON");
         topFrame->_renderMode = true;
+        wxString videoFolder;
+        if (parser.Found("ev", &videoFolder)) {
+            logger_base.info("-ev: Exporting house preview videos to %s", (const char*)videoFolder.c_str());
+            topFrame->_renderModeVideoFolder = videoFolder;
+        }
         topFrame->CallAfter(&xLightsFrame::OpenRenderAndSaveSequences, sequenceFiles, true);
     }
 
@@ -57,6 +57,7 @@
 #include "HousePreviewPanel.h"
 #include "BatchRenderDialog.h"
 #include "VideoExporter.h"
+#include "PreviewRasterizer.h"
 #include "JukeboxPanel.h"
 #include "FindDataPanel.h"
 #include "EffectAssist.h"
@@ -79,6 +80,7 @@
 #include "outputs/ZCPPOutput.h"
 #include "EffectIconPanel.h"
 #include "models/ViewObject.h"
+#include "models/MeshObject.h"
 #include "models/SubModel.h"
 #include "effects/FacesEffect.h"
 #include "effects/StateEffect.h"
@@ -102,6 +104,7 @@
 #include "GPURenderUtils.h"
 #include "ViewsModelsPanel.h"
 #include "graphics/opengl/xlGLCanvas.h"
+#include "graphics/xlMeshCache.h"
 #include "ColourReplaceDialog.h"
 
 #include "../xSchedule/wxHTTPServer/wxhttpserver.h"
@@ -1520,6 +1523,17 @@ xLightsFrame::xLightsFrame(wxWindow* parent, int ab, wxWindowID id) :
     config->Read("xLightsVideoExportBitrate", &_videoExportBitrate,0);
     logger_base.debug("Video Export Bitrate: %d.", _videoExportBitrate);
 
+    int undoMemoryMB = 256;
+    config->Read("xLightsUndoMemoryMB", &undoMemoryMB, 256);
+    UndoManager::SetMemoryLimit((size_t)std::max(undoMemoryMB, 16) * 1024 * 1024);
+    logger_base.debug("Undo memory limit: %dMB.", undoMemoryMB);
+
+    // 0 lets the sequence data decide from the physical memory size
+    int fileBackedMB = 0;
+    config->Read("xLightsSequenceFileBackedMB", &fileBackedMB, 0);
+    SequenceData::SetFileBackedThresholdMB((size_t)std::max(fileBackedMB, 0));
+    logger_base.debug("Sequence data file backed above: %dMB.", fileBackedMB);
+
     config->Read("xLightsExcludeAudioPkgSeq", &_excludeAudioFromPackagedSequences, false);
     logger_base.debug("Exclude Audio From Packaged Sequences: %s.", toStr( _excludeAudioFromPackagedSequences ));
 
@@ -3197,6 +3211,79 @@ bool xLightsFrame::ExportVideoPreview(wxString const& path)
     return exportStatus;
 }
 
+bool xLightsFrame::ExportPreviewVideo(wxString const& path, int width, int height, int view3d)
+{
+    static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
+
+    if (CurrentSeqXmlFile == nullptr || _seqData.NumFrames() == 0) {
+        return false;
+    }
+
+    // Ensure all pending work is done before we do anything
+    DoAllWork();
+
+    ModelPreview* housePreview = _housePreviewPanel->GetModelPreview();
+    if (housePreview == nullptr) {
+        return false;
+    }
+
+    PreviewRasterizer::Settings settings;
+    settings.is3d = view3d < 0 ? housePreview->Is3D() : view3d != 0;
+    housePreview->GetVirtualCanvasSize(settings.virtualWidth, settings.virtualHeight);
+    if (width <= 0 || height <= 0) {
+        width = settings.virtualWidth;
+        height = settings.virtualHeight;
+    }
+    if (width <= 0 || height <= 0) {
+        width = 1280;
+        height = 720;
+    }
+    // encoders want even sizes
+    settings.width = (width + 1) & ~1;
+    settings.height = (height + 1) & ~1;
+    settings.center2D0 = housePreview->GetDisplay2DCenter0();
+    settings.backgroundImage = housePreview->GetBackgroundImage().ToStdString();
+    settings.scaleBackgroundImage = housePreview->GetScaleBackgroundImage();
+    settings.backgroundBrightness = housePreview->GetBackgroundBrightness();
+    settings.backgroundAlpha = housePreview->GetBackgroundAlpha();
+    settings.camera = housePreview->GetCamera(settings.is3d);
+
+    std::vector<MeshObject*> meshes;
+    if (settings.is3d) {
+        for (const auto& it : AllObjects) {
+            MeshObject* mesh = dynamic_cast<MeshObject*>(it.second);
+            if (mesh != nullptr) {
+                meshes.push_back(mesh);
+            }
+        }
+    }
+
+    int playStatus = GetPlayStatus();
+    SetPlayStatus(PLAY_TYPE_STOPPED);
+
+    wxStopWatch sw;
+    logger_base.debug("Rendering house-preview video to %s.", (const char*)path.c_str());
+
+    std::string emsg;
+    bool exportStatus = false;
+    {
+        PreviewRasterizer rasterizer(settings, housePreview->GetModels(), meshes);
+        exportStatus = rasterizer.ExportVideo(_seqData, CurrentSeqXmlFile->GetMedia(), path.ToStdString(),
+                                              _videoExportCodec.ToStdString(), _videoExportBitrate, emsg);
+    }
+
+    SetPlayStatus(playStatus);
+
+    if (exportStatus) {
+        float elapsedTime = sw.Time() / 1000.0; //msec => sec
+        logger_base.debug("Finished rendering house-preview video in %4.3f sec.", elapsedTime);
+        SetStatusText(wxString::Format("'%s' exported in %4.3f sec.", path.c_str(), elapsedTime));
+    } else {
+        logger_base.error("Rendering house-preview video failed. %s", (const char*)emsg.c_str());
+    }
+    return exportStatus;
+}
+
 void xLightsFrame::OnResize(wxSizeEvent& event)
 {
 }
@@ -4272,6 +4359,9 @@ void xLightsFrame::SetRenderCacheFolder(bool useShow, const std::string& folder)
     }
 
     SetXmlSetting("renderCacheDir", renderCacheDirectory);
+    AudioManager::SetAnalysisCacheFolder(renderCacheDirectory + wxFileName::GetPathSeparator() + "RenderCache" + wxFileName::GetPathSeparator() + "AudioCache");
+    xlMeshCache::Instance().SetSidecarFolder(renderCacheDirectory + wxFileName::GetPathSeparator() + "RenderCache" + wxFileName::GetPathSeparator() + "MeshCache");
+    SequenceData::SetFileBackedFolder(renderCacheDirectory + wxFileName::GetPathSeparator() + "RenderCache" + wxFileName::GetPathSeparator() + "SequenceData");
     UnsavedRgbEffectsChanges = true;
     UpdateLayoutSave();
     UpdateControllerSave();
@@ -51,7 +51,9 @@
 #include <wx/appprogress.h>
 
 #include <unordered_map>
+#include <future>
 #include <map>
+#include <mutex>
 #include <set>
 #include <vector>
 
@@ -90,6 +92,7 @@ class wxDebugReport;
 class ControllerCaps;
 class EffectTreeDialog;
 class ConvertDialog;
+class ConvertParameters;
 class ConvertLogDialog;
 class RenderTreeData;
 class HousePreviewPanel;
@@ -389,6 +392,8 @@ public:
     std::string GetPresetIconFilename(const std::string& preset) const;
     void CreatePresetIcons();
     void ClearSequenceData();
+    void MarkFseqFramesDirty(int startFrame, int endFrame);
+    void InvalidateWrittenFseq() { _fseqWrittenId = 0; }
     void LoadAudioData(xLightsXmlFile& xml_file);
     virtual void CreateDebugReport(xlCrashHandler* crashHandler) override;
     virtual std::string GetCurrentDir() const override { return CurrentDir.ToStdString(); }
@@ -398,6 +403,9 @@ public:
     void AddTraceMessage(const std::string &msg);
     void ClearTraceMessages();
     bool ExportVideoPreview(wxString const& path);
+    // Renders the house preview to video on the CPU without needing the preview window. A width
+    // or height of 0 uses the preview canvas size, view3d < 0 whichever view the preview is showing
+    bool ExportPreviewVideo(wxString const& path, int width = 0, int height = 0, int view3d = -1);
 
 	void SetAudioControls();
     void ImportXLights(const wxFileName &filename);
@@ -1015,6 +1023,27 @@ public:
     bool UnsavedNetworkChanges = false;
     int mSavedChangeCount = 0;
     int mLastAutosaveCount = 0;
+    // the fseq last written from _seqData and the frames rendered since, so a save
+    // only needs to update those frames rather than rewrite the whole file
+    wxString _fseqWrittenFilename;
+    uint64_t _fseqWrittenId = 0;
+    int _fseqDirtyStartFrame = -1;
+    int _fseqDirtyEndFrame = -1;
+    std::mutex _fseqDirtyLock;
+    // batch render overlaps writing the fseq of one sequence with opening and rendering the next
+    struct BatchRenderTimes
+    {
+        std::string sequence;
+        long openMS = 0;
+        long renderMS = 0;
+        long writeMS = -1;
+        bool background = false;
+        std::string writeError;   // set if a background write failed
+    };
+    std::vector<BatchRenderTimes> _batchRenderTimes;
+    std::mutex _batchRenderLock;
+    std::future<void> _batchRenderWrite;
+    std::future<void> _batchRenderPrefetch;
     wxDateTime starttime;
     ModelPreview* modelPreview = nullptr;
     EffectManager effectManager;
@@ -1330,6 +1359,7 @@ public:
     unsigned int modelsChangeCount;
     bool _renderMode = false;
     bool _checkSequenceMode = false;
+    wxString _renderModeVideoFolder; // render mode also exports a house preview video of each sequence here
 
     void SuspendAutoSave(bool dosuspend) { _suspendAutoSave = dosuspend; }
     void ClearLastPeriod();
@@ -1340,6 +1370,7 @@ public:
     void ReadXlightsFile(const wxString& FileName, wxString *mediaFilename = nullptr);
     void ReadFalconFile(const wxString& FileName, ConvertDialog* convertdlg);
     void WriteFalconPiFile(const wxString& filename, bool allowSparse = true); //  Falcon Pi Player *.fseq
+    void AddFalconPiSparseRanges(ConvertParameters& params);
     OutputManager* GetOutputManager() { return &_outputManager; };
     OutputModelManager* GetOutputModelManager() { return&_outputModelManager; }
     void WriteGIFForPreset(const std::string& preset);
@@ -1442,6 +1473,10 @@ protected:
     void BackupDirectory(wxString sourceDir, wxString targetDirName, wxString lastCreatedDirectory, bool forceallfiles, std::string& errors);
     void CreateMissingDirectories(wxString targetDirName, wxString lastCreatedDirectory, std::string& errors);
     void OpenRenderAndSaveSequences(const wxArrayString &filenames, bool exitOnDone);
+    void WriteBatchRenderFseq(const wxString& filename, size_t reportIndex, bool background);
+    void WaitForBatchRenderWork();
+    void PrefetchBatchRenderSequence(const wxString& filename);
+    void LogBatchRenderReport();
     void OpenAndCheckSequence(const wxArrayString& origFilenames, bool exitOnDone);
     std::string OpenAndCheckSequence(const std::string& origFilenames);
     void AddAllModelsToSequence();
@@ -9,6 +9,7 @@
  **************************************************************/
 
 #include <wx/tokenzr.h>
+#include <wx/stopwatch.h>
 #include <wx/regex.h>
 #include <wx/numdlg.h>
 #include <wx/zipstrm.h>
@@ -1034,10 +1035,12 @@ bool xLightsXmlFile::LoadSequence(const wxString& ShowDir, bool ignore_audio)
     static log4cpp::Category& logger_base = log4cpp::Category::getInstance(std::string("log_base"));
     logger_base.info("LoadSequence: Loading sequence " + GetFullPath());
 
+    wxStopWatch sw;
     if (!seqDocument.Load(GetFullPath())) {
         logger_base.error("LoadSequence: XML file load failed.");
         return false;
     }
+    logger_base.debug("LoadSequence: XML parsed in %ldms.", sw.Time());
     is_open = true;
 
     wxXmlNode* root = seqDocument.GetRoot();
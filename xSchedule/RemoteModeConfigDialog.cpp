@@ -21,6 +21,10 @@ const long RemoteModeConfigDialog::ID_STATICTEXT1 = wxNewId();
 const long RemoteModeConfigDialog::ID_SPINCTRL1 = wxNewId();
 const long RemoteModeConfigDialog::ID_STATICTEXT2 = wxNewId();
 const long RemoteModeConfigDialog::ID_SPINCTRL2 = wxNewId();
+const long RemoteModeConfigDialog::ID_STATICTEXT3 = wxNewId();
+const long RemoteModeConfigDialog::ID_SPINCTRL3 = wxNewId();
+const long RemoteModeConfigDialog::ID_STATICTEXT4 = wxNewId();
+const long RemoteModeConfigDialog::ID_SPINCTRL4 = wxNewId();
 //*)
 
 BEGIN_EVENT_TABLE(RemoteModeConfigDialog,wxDialog)
@@ -28,7 +32,7 @@ BEGIN_EVENT_TABLE(RemoteModeConfigDialog,wxDialog)
 	//*)
 END_EVENT_TABLE()
 
-RemoteModeConfigDialog::RemoteModeConfigDialog(wxWindow* parent, int latency, int jitter, wxWindowID id,const wxPoint& pos,const wxSize& size)
+RemoteModeConfigDialog::RemoteModeConfigDialog(wxWindow* parent, int latency, int jitter, int hardResync, int maxSlew, wxWindowID id,const wxPoint& pos,const wxSize& size)
 {
 	//(*Initialize(RemoteModeConfigDialog)
 	wxFlexGridSizer* FlexGridSizer1;
@@ -48,6 +52,16 @@ RemoteModeConfigDialog::RemoteModeConfigDialog(wxWindow* parent, int latency, in
 	SpinCtrl_AcceptableJitter = new wxSpinCtrl(this, ID_SPINCTRL2, _T("0"), wxDefaultPosition, wxDefaultSize, 0, 0, 1000, 0, _T("ID_SPINCTRL2"));
 	SpinCtrl_AcceptableJitter->SetValue(_T("0"));
 	FlexGridSizer1->Add(SpinCtrl_AcceptableJitter, 1, wxALL|wxEXPAND, 5);
+	StaticText3 = new wxStaticText(this, ID_STATICTEXT3, _("Hard Resync (milliseconds):"), wxDefaultPosition, wxDefaultSize, 0, _T("ID_STATICTEXT3"));
+	FlexGridSizer1->Add(StaticText3, 1, wxALL|wxALIGN_LEFT|wxALIGN_CENTER_VERTICAL, 5);
+	SpinCtrl_HardResync = new wxSpinCtrl(this, ID_SPINCTRL3, _T("1000"), wxDefaultPosition, wxDefaultSize, 0, 50, 10000, 1000, _T("ID_SPINCTRL3"));
+	SpinCtrl_HardResync->SetValue(_T("1000"));
+	FlexGridSizer1->Add(SpinCtrl_HardResync, 1, wxALL|wxEXPAND, 5);
+	StaticText4 = new wxStaticText(this, ID_STATICTEXT4, _("Max Catch Up Speed (%):"), wxDefaultPosition, wxDefaultSize, 0, _T("ID_STATICTEXT4"));
+	FlexGridSizer1->Add(StaticText4, 1, wxALL|wxALIGN_LEFT|wxALIGN_CENTER_VERTICAL, 5);
+	SpinCtrl_MaxSlew = new wxSpinCtrl(this, ID_SPINCTRL4, _T("5"), wxDefaultPosition, wxDefaultSize, 0, 1, 50, 5, _T("ID_SPINCTRL4"));
+	SpinCtrl_MaxSlew->SetValue(_T("5"));
+	FlexGridSizer1->Add(SpinCtrl_MaxSlew, 1, wxALL|wxEXPAND, 5);
 	FlexGridSizer1->Add(0,0,1, wxALL|wxALIGN_CENTER_HORIZONTAL|wxALIGN_CENTER_VERTICAL, 5);
 	StdDialogButtonSizer1 = new wxStdDialogButtonSizer();
 	StdDialogButtonSizer1->AddButton(new wxButton(this, wxID_OK, wxEmptyString));
@@ -61,6 +75,8 @@ RemoteModeConfigDialog::RemoteModeConfigDialog(wxWindow* parent, int latency, in
 
     SpinCtrl_Adjust->SetValue(latency);
     SpinCtrl_AcceptableJitter->SetValue(jitter);
+    SpinCtrl_HardResync->SetValue(hardResync);
+    SpinCtrl_MaxSlew->SetValue(maxSlew);
 }
 
 RemoteModeConfigDialog::~RemoteModeConfigDialog()
@@ -77,4 +93,14 @@ int RemoteModeConfigDialog::GetLatency() const
 int RemoteModeConfigDialog::GetJitter() const
 {
     return SpinCtrl_AcceptableJitter->GetValue();
+}
+
+int RemoteModeConfigDialog::GetHardResync() const
+{
+    return SpinCtrl_HardResync->GetValue();
+}
+
+int RemoteModeConfigDialog::GetMaxSlew() const
+{
+    return SpinCtrl_MaxSlew->GetValue();
 }
\ No newline at end of file
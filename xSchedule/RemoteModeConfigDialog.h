@@ -21,16 +21,22 @@ class RemoteModeConfigDialog: public wxDialog
 {
 	public:
 
-		RemoteModeConfigDialog(wxWindow* parent, int latency, int jitter, wxWindowID id = wxID_ANY, const wxPoint& pos = wxDefaultPosition, const wxSize& size = wxDefaultSize);
+		RemoteModeConfigDialog(wxWindow* parent, int latency, int jitter, int hardResync, int maxSlew, wxWindowID id = wxID_ANY, const wxPoint& pos = wxDefaultPosition, const wxSize& size = wxDefaultSize);
 		virtual ~RemoteModeConfigDialog();
         int GetLatency() const;
         int GetJitter() const;
+        int GetHardResync() const;
+        int GetMaxSlew() const;
 
 		//(*Declarations(RemoteModeConfigDialog)
 		wxSpinCtrl* SpinCtrl_AcceptableJitter;
 		wxSpinCtrl* SpinCtrl_Adjust;
+		wxSpinCtrl* SpinCtrl_HardResync;
+		wxSpinCtrl* SpinCtrl_MaxSlew;
 		wxStaticText* StaticText1;
 		wxStaticText* StaticText2;
+		wxStaticText* StaticText3;
+		wxStaticText* StaticText4;
 		//*)
 
 	protected:
@@ -40,6 +46,10 @@ class RemoteModeConfigDialog: public wxDialog
 		static const long ID_SPINCTRL1;
 		static const long ID_STATICTEXT2;
 		static const long ID_SPINCTRL2;
+		static const long ID_STATICTEXT3;
+		static const long ID_SPINCTRL3;
+		static const long ID_STATICTEXT4;
+		static const long ID_SPINCTRL4;
 		//*)
 
 	private:
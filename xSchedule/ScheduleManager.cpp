@@ -248,6 +248,22 @@ int ScheduleManager::Sync(const std::string& filename, long ms)
     return 50; // this is a problem
 }
 
+// Called on the listener threads as each remote sync packet arrives so the time it was
+// received isn't skewed by how long the event takes to get through to DoSync
+void ScheduleManager::AddSyncSample(const std::string& filename, long ms)
+{
+    // stop, pause and unpause are not positions
+    if ((uint32_t)ms >= 0xFFFFFFFD)
+    {
+        if ((uint32_t)ms == 0xFFFFFFFF)
+        {
+            _syncClock.Reset();
+        }
+        return;
+    }
+    _syncClock.AddSample(filename, (uint32_t)ms, SyncClock::LocalMS());
+}
+
 int ScheduleManager::DoSync(const std::string& filename, long ms)
 {
     static log4cpp::Category &logger_sync = log4cpp::Category::getInstance(std::string("log_sync"));
@@ -256,6 +272,18 @@ int ScheduleManager::DoSync(const std::string& filename, long ms)
     PlayList* pl = GetRunningPlayList();
     PlayListStep* pls = nullptr;
 
+    // play to the recovered master clock rather than the time in this packet so network jitter
+    // doesn't move us around
+    if ((uint32_t)ms < 0xFFFFFFFD)
+    {
+        _syncClock.Configure(GetOptions()->GetRemoteHardResync(), GetOptions()->GetRemoteMaxSlew());
+        uint32_t masterMS = 0;
+        if (_syncClock.GetMasterMS(filename, SyncClock::LocalMS(), masterMS))
+        {
+            ms = masterMS;
+        }
+    }
+
     // adjust the time we received by the desired latency
     ms += GetOptions()->GetRemoteLatency();
 
@@ -3835,7 +3863,7 @@ bool ScheduleManager::Query(const wxString& command, const wxString& parameters,
                 "\",\"autooutputtolights\":\"" + (_manualOTL ? "false" : "true") +
                 "\",\"passwordset\":\"" + (_scheduleOptions->GetPassword() == "" ? "false" : "true") +
                 "\",\"outputtolights\":\"" + std::string(_outputManager->IsOutputting() ? "true" : "false") + 
-                "\"," + GetPingStatus() + "}";
+                "\"," + GetRemoteSyncStatus() + GetPingStatus() + "}";
             //static log4cpp::Category &logger_base = log4cpp::Category::getInstance(std::string("log_base"));
             //logger_base.info("%s", (const char*)data.c_str());
         }
@@ -3880,6 +3908,20 @@ void ScheduleManager::DisableRemoteOutputs()
     }
 }
 
+std::string ScheduleManager::GetRemoteSyncStatus()
+{
+    if (!IsSlave())
+    {
+        return "";
+    }
+
+    auto stats = _syncClock.GetStats();
+    return "\"remotesync\":{\"jitterms\":\"" + wxString::Format("%.1f", stats.jitterMS).ToStdString() +
+        "\",\"offsetms\":\"" + wxString::Format("%.1f", stats.offsetMS).ToStdString() +
+        "\",\"driftppm\":\"" + wxString::Format("%.0f", stats.driftPPM).ToStdString() +
+        "\",\"resyncs\":\"" + wxString::Format("%u", stats.resyncs).ToStdString() + "\"},";
+}
+
 std::string ScheduleManager::GetPingStatus()
 {
     std::string res = "\"pingstatus\":[";
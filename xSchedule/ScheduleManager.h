@@ -20,6 +20,7 @@
 #include "wxMIDI/src/wxMidi.h"
 #include "Blend.h"
 #include "SyncManager.h"
+#include "SyncClock.h"
 
 class PlayListItemText;
 class ScheduleOptions;
@@ -106,9 +107,11 @@ class ScheduleManager
     bool _webRequestToggle = false;
     Pinger* _pinger = nullptr;
     std::unique_ptr<SyncManager> _syncManager = nullptr;
+    SyncClock _syncClock;
 
     void DisableRemoteOutputs();
     std::string GetPingStatus();
+    std::string GetRemoteSyncStatus();
     std::string FormatTime(size_t timems);
     void CreateBrightnessArray();
     void ManageBackground();
@@ -224,6 +227,7 @@ class ScheduleManager
         void StartListeners();
         int Sync(const std::string& filename, long ms);
         int DoSync(const std::string& filename, long ms);
+        void AddSyncSample(const std::string& filename, long ms);
         bool IsSlave() const;
         bool IsFPPRemoteOrMaster() const;
         bool IsTest() const;
@@ -49,6 +49,8 @@ ScheduleOptions::ScheduleOptions(OutputManager* outputManager, wxXmlNode* node,
     _remoteLatency = wxAtoi(node->GetAttribute("RemoteLatency", "0"));
     _SMPTEMode = wxAtoi(node->GetAttribute("SMPTEMode", "3"));
     _remoteAcceptableJitter = wxAtoi(node->GetAttribute("RemoteAcceptableJitter", "20"));
+    _remoteHardResync = wxAtoi(node->GetAttribute("RemoteHardResync", "1000"));
+    _remoteMaxSlew = wxAtoi(node->GetAttribute("RemoteMaxSlew", "5"));
     _sync = node->GetAttribute("Sync", "FALSE") == "TRUE";
     _advancedMode = node->GetAttribute("AdvancedMode", "FALSE") == "TRUE";
     _webAPIOnly = node->GetAttribute("APIOnly", "FALSE") == "TRUE";
@@ -269,6 +271,8 @@ ScheduleOptions::ScheduleOptions()
 #endif
     _remoteLatency = 0;
     _remoteAcceptableJitter = 20;
+    _remoteHardResync = 1000;
+    _remoteMaxSlew = 5;
     _webAPIOnly = false;
     _changeCount = 1;
     _lastSavedChangeCount = 0;
@@ -327,6 +331,8 @@ wxXmlNode* ScheduleOptions::Save()
     res->AddAttribute("City", _city);
     res->AddAttribute("RemoteLatency", wxString::Format("%d", _remoteLatency));
     res->AddAttribute("RemoteAcceptableJitter", wxString::Format("%d", _remoteAcceptableJitter));
+    res->AddAttribute("RemoteHardResync", wxString::Format("%d", _remoteHardResync));
+    res->AddAttribute("RemoteMaxSlew", wxString::Format("%d", _remoteMaxSlew));
     res->AddAttribute("SMPTEMode", wxString::Format("%d", _SMPTEMode));
     res->AddAttribute("DefaultVideoSize", SerialisePair(_defaultVideoSize.x, _defaultVideoSize.y));
     res->AddAttribute("DefaultVideoPos", SerialisePair(_defaultVideoPos.x, _defaultVideoPos.y));
@@ -175,6 +175,8 @@ class ScheduleOptions
     int _port = 80;
     int _remoteLatency = 0;
     int _remoteAcceptableJitter = 20;
+    int _remoteHardResync = 1000;
+    int _remoteMaxSlew = 5;
     std::string _wwwRoot;
     std::string _password;
     std::string _defaultPage = "index.html";
@@ -298,6 +300,8 @@ public:
     bool GetAPIOnly() const { return _webAPIOnly; }
     int GetRemoteLatency() const { return _remoteLatency; }
     int GetRemoteAcceptableJitter() const { return _remoteAcceptableJitter; }
+    int GetRemoteHardResync() const { return _remoteHardResync; }
+    int GetRemoteMaxSlew() const { return _remoteMaxSlew; }
     std::string GetPassword() const { return _password; }
     std::string GetDefaultPage() const { return _defaultPage; }
     bool GetAllowUnauth() const { return _allowUnauth; }
@@ -306,6 +310,8 @@ public:
     void SetAPIOnly(bool apiOnly) { if (_webAPIOnly != apiOnly) { _webAPIOnly = apiOnly; _changeCount++; } }
     void SetRemoteLatency(int remoteLatency) { if (remoteLatency != _remoteLatency) { _remoteLatency = remoteLatency; _changeCount++; } }
     void SetRemoteAcceptableJitter(int remoteAcceptableJitter) { if (remoteAcceptableJitter != _remoteAcceptableJitter) { _remoteAcceptableJitter = remoteAcceptableJitter; _changeCount++; } }
+    void SetRemoteHardResync(int remoteHardResync) { if (remoteHardResync != _remoteHardResync) { _remoteHardResync = remoteHardResync; _changeCount++; } }
+    void SetRemoteMaxSlew(int remoteMaxSlew) { if (remoteMaxSlew != _remoteMaxSlew) { _remoteMaxSlew = remoteMaxSlew; _changeCount++; } }
     void SetPasswordTimeout(int passwordTimeout) { if (_passwordTimeout != passwordTimeout) { _passwordTimeout = passwordTimeout; _changeCount++; } }
     void SetPassword(const std::string& password) { if (_password != password) { _password = password; _changeCount++; } }
     void SetDefaultPage(const std::string& defaultPage) { if (_defaultPage != defaultPage) { _defaultPage = defaultPage; _changeCount++; } }
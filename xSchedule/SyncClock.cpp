@@ -0,0 +1,163 @@
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include "SyncClock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include <log4cpp/Category.hh>
+
+// Filter gains. Alpha is the fraction of each packet's error taken into the phase, beta is
+// the critically damped rate gain for it ... alpha^2 / (2 - alpha).
+#define SYNC_CLOCK_ALPHA 0.1
+#define SYNC_CLOCK_BETA (SYNC_CLOCK_ALPHA * SYNC_CLOCK_ALPHA / (2.0 - SYNC_CLOCK_ALPHA))
+
+// nobody's clock is out by more than this, anything beyond it is noise getting into the rate
+#define SYNC_CLOCK_MAX_DRIFT 0.02
+
+// errors are never clipped below this however steady the packets have been
+#define SYNC_CLOCK_MIN_ERROR_LIMIT 10.0
+
+// this many clipped errors in a row in the same direction is a step not noise
+#define SYNC_CLOCK_STEP_OUTLIERS 4
+
+// log the clock stats every this many samples
+#define SYNC_CLOCK_LOG_INTERVAL 200
+
+int64_t SyncClock::LocalMS()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SyncClock::Configure(uint32_t hardResyncMS, uint32_t maxSlewPercent)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _hardResyncMS = std::max(hardResyncMS, (uint32_t)1);
+    _maxSlew = std::clamp((double)maxSlewPercent / 100.0, 0.0, 1.0);
+}
+
+void SyncClock::Reset()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _timeline = "";
+    _locked = false;
+    _outputValid = false;
+    _stats = Stats();
+}
+
+SyncClock::Stats SyncClock::GetStats() const
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    return _stats;
+}
+
+void SyncClock::HardResync(uint32_t masterMS, int64_t localMS)
+{
+    _masterMS = masterMS;
+    _localMS = localMS;
+    _rate = 1.0;
+    _outliers = 0;
+    _locked = true;
+    _outputValid = false;
+    _stats.jitterMS = 0;
+    _stats.driftPPM = 0;
+    _stats.resyncs++;
+}
+
+void SyncClock::AddSample(const std::string& timeline, uint32_t masterMS, int64_t localMS)
+{
+    static log4cpp::Category& logger_sync = log4cpp::Category::getInstance(std::string("log_sync"));
+    std::unique_lock<std::mutex> lock(_lock);
+
+    _stats.samples++;
+
+    if (!_locked || timeline != _timeline) {
+        _timeline = timeline;
+        HardResync(masterMS, localMS);
+        return;
+    }
+
+    double dt = (double)(localMS - _localMS);
+    double predicted = _masterMS + _rate * dt;
+    double error = (double)masterMS - predicted;
+
+    if (std::abs(error) > _hardResyncMS || dt < 0) {
+        logger_sync.debug("SyncClock: master at %u is %.0fms from the estimate, resyncing.", masterMS, error);
+        HardResync(masterMS, localMS);
+        return;
+    }
+
+    // a packet held up somewhere along the way shouldn't drag the estimate with it so clip
+    // the error to a few times the jitter seen so far before filtering it
+    double limit = std::max(3.0 * _stats.jitterMS, SYNC_CLOCK_MIN_ERROR_LIMIT);
+    double filtered = std::clamp(error, -limit, limit);
+
+    // but a run of them all out the same way is the master having moved
+    if (filtered != error) {
+        int sign = error > 0 ? 1 : -1;
+        _outliers = (_outliers * sign > 0) ? _outliers + sign : sign;
+        if (std::abs(_outliers) >= SYNC_CLOCK_STEP_OUTLIERS) {
+            logger_sync.debug("SyncClock: master has stepped %.0fms, resyncing.", error);
+            HardResync(masterMS, localMS);
+            return;
+        }
+    } else {
+        _outliers = 0;
+    }
+
+    // RFC 3550 style running jitter
+    _stats.jitterMS += (std::abs(error) - _stats.jitterMS) / 16.0;
+
+    _masterMS = predicted + SYNC_CLOCK_ALPHA * filtered;
+    _localMS = localMS;
+    if (dt > 0) {
+        // packets in a burst arrive with dt near 0 and would otherwise blow the rate out
+        _rate += SYNC_CLOCK_BETA * filtered / std::max(dt, 10.0);
+        _rate = std::clamp(_rate, 1.0 - SYNC_CLOCK_MAX_DRIFT, 1.0 + SYNC_CLOCK_MAX_DRIFT);
+    }
+    _stats.driftPPM = (_rate - 1.0) * 1000000.0;
+
+    if (_stats.samples % SYNC_CLOCK_LOG_INTERVAL == 0) {
+        logger_sync.debug("SyncClock: jitter %.1fms offset %.1fms drift %.0fppm resyncs %u.",
+                          _stats.jitterMS, _stats.offsetMS, _stats.driftPPM, _stats.resyncs);
+    }
+}
+
+bool SyncClock::GetMasterMS(const std::string& timeline, int64_t localMS, uint32_t& masterMS)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+
+    if (!_locked || timeline != _timeline) {
+        return false;
+    }
+
+    double target = _masterMS + _rate * (double)(localMS - _localMS);
+
+    if (_outputValid && localMS >= _outputLocalMS) {
+        // carry on at our own rate and slew towards the estimate
+        double elapsed = (double)(localMS - _outputLocalMS);
+        double natural = _outputMS + elapsed;
+        double correction = target - natural;
+        if (std::abs(correction) <= _hardResyncMS) {
+            double limit = _maxSlew * elapsed;
+            target = natural + std::clamp(correction, -limit, limit);
+        }
+    }
+
+    _outputValid = true;
+    _outputMS = std::max(target, 0.0);
+    _outputLocalMS = localMS;
+    _stats.offsetMS = _masterMS + _rate * (double)(localMS - _localMS) - _outputMS;
+
+    masterMS = (uint32_t)std::lround(_outputMS);
+    return true;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+/***************************************************************
+ * This source files comes from the xLights project
+ * https://www.xlights.org
+ * https://github.com/smeighan/xLights
+ * See the github commit history for a record of contributing
+ * developers.
+ * Copyright claimed based on commit dates recorded in Github
+ * License: https://github.com/smeighan/xLights/blob/master/License.txt
+ **************************************************************/
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+// Recovers the master's playback clock from the sync packets received as a remote.
+// Each packet is a sample of master position against our monotonic clock at the moment it
+// arrived. An alpha-beta filter (a steady state Kalman filter tracking phase and rate) turns
+// those into a smooth estimate of master position at any local time, so network jitter and
+// bursts of packets no longer feed straight into the playback position. The position handed
+// out is slewed towards that estimate by at most a fraction of the elapsed time rather than
+// jumping, unless it is further out than the hard resync threshold, such as when the master
+// seeks or starts a new step.
+// All methods are thread safe, samples arrive on the listener threads and the position is
+// read on the main thread.
+class SyncClock
+{
+public:
+    struct Stats
+    {
+        double jitterMS = 0;    // smoothed absolute deviation of packets from the estimate
+        double offsetMS = 0;    // estimate minus the position last handed out, ie correction still being slewed in
+        double driftPPM = 0;    // master clock rate relative to ours
+        uint32_t samples = 0;
+        uint32_t resyncs = 0;
+    };
+
+    SyncClock() {}
+    virtual ~SyncClock() {}
+
+    // hardResyncMS - errors larger than this jump rather than being filtered and slewed
+    // maxSlewPercent - most the handed out position may run fast or slow to catch up
+    void Configure(uint32_t hardResyncMS, uint32_t maxSlewPercent);
+
+    // A sync packet putting the master at masterMS on timeline (the step or fseq being
+    // synced to) at local time localMS. A different timeline starts again from scratch.
+    void AddSample(const std::string& timeline, uint32_t masterMS, int64_t localMS);
+
+    // Master position on timeline at localMS. Returns false if there is no estimate for it
+    // in which case masterMS is unchanged.
+    bool GetMasterMS(const std::string& timeline, int64_t localMS, uint32_t& masterMS);
+
+    void Reset();
+    Stats GetStats() const;
+
+    // milliseconds from a monotonic clock, the local time base samples should use
+    static int64_t LocalMS();
+
+private:
+    void HardResync(uint32_t masterMS, int64_t localMS);
+
+    mutable std::mutex _lock;
+    uint32_t _hardResyncMS = 1000;
+    double _maxSlew = 0.05;
+
+    std::string _timeline;
+    bool _locked = false;
+
+    // filter state, master is at _masterMS + _rate * (t - _localMS)
+    double _masterMS = 0;
+    int64_t _localMS = 0;
+    double _rate = 1.0;
+    int _outliers = 0;          // run of clipped errors, signed by direction
+
+    // last position handed out
+    bool _outputValid = false;
+    double _outputMS = 0;
+    int64_t _outputLocalMS = 0;
+
+    Stats _stats;
+};
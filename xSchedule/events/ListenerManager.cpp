@@ -756,13 +756,17 @@ int ListenerManager::Sync(const std::string filename, long ms, const std::string
 {
     if ((_sync == 1 && type == "FPP") || (_sync == 6 && type == "FPP CSV"))
     {
-        _lastFrameMS = _scheduleManager->Sync(_scheduleManager->FindStepForFSEQ(filename), ms);
+        std::string step = _scheduleManager->FindStepForFSEQ(filename);
+        _scheduleManager->AddSyncSample(step, ms);
+        _lastFrameMS = _scheduleManager->Sync(step, ms);
     }
     else if ((_sync == 3 && type == "ARTNet") ||
         (_sync == 2 && type == "OSC") ||
         (_sync == 5 && type == "MIDI") ||
         (_sync == 7 && type == "SMPTE"))
     {
+        // every packet goes to the sync clock, only the position updates are throttled
+        _scheduleManager->AddSyncSample(filename, ms);
 		if (_lastSyncMS < 0 || _lastSyncMS >= ms || ms > _lastSyncMS + MIN_SYNC_INTERVAL_MS)
 		{
 			_lastFrameMS = _scheduleManager->Sync(filename, ms);
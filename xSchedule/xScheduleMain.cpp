@@ -3647,10 +3647,13 @@ void xScheduleFrame::OnMenuItem_UsexLightsFolderSelected(wxCommandEvent& event)
 
 void xScheduleFrame::OnMenuItem_RemoteLatencySelected(wxCommandEvent& event)
 {
-    RemoteModeConfigDialog dlg(this, __schedule->GetOptions()->GetRemoteLatency(), __schedule->GetOptions()->GetRemoteAcceptableJitter());
+    RemoteModeConfigDialog dlg(this, __schedule->GetOptions()->GetRemoteLatency(), __schedule->GetOptions()->GetRemoteAcceptableJitter(),
+                               __schedule->GetOptions()->GetRemoteHardResync(), __schedule->GetOptions()->GetRemoteMaxSlew());
     if (dlg.ShowModal() == wxID_OK) {
         __schedule->GetOptions()->SetRemoteLatency(dlg.GetLatency());
         __schedule->GetOptions()->SetRemoteAcceptableJitter(dlg.GetJitter());
+        __schedule->GetOptions()->SetRemoteHardResync(dlg.GetHardResync());
+        __schedule->GetOptions()->SetRemoteMaxSlew(dlg.GetMaxSlew());
     }
 }
 